@@ -1,7 +1,9 @@
 // This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
 #pragma once
 
+#include <functional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Luau
@@ -13,4 +15,8 @@ struct Comment;
 std::string toJson(AstNode* node);
 std::string toJson(AstNode* node, const std::vector<Comment>& commentLocations);
 
+// Streaming versions that pass the encoding to the output in chunks of up to a few tens of KB instead of building the entire string in memory
+void toJson(AstNode* node, const std::function<void(std::string_view)>& output);
+void toJson(AstNode* node, const std::vector<Comment>& commentLocations, const std::function<void(std::string_view)>& output);
+
 } // namespace Luau
@@ -63,6 +63,12 @@ private:
     AstLocal* local = nullptr;
 };
 
+struct AstLocationIndex;
+
+// Builds an index of the nodes of the tree by their location. When it's stored in SourceModule::locationIndex, findAstAncestryOfPosition and
+// findNodeAtPosition (and the queries built on them) search the index in logarithmic time instead of traversing the tree on every call.
+std::shared_ptr<AstLocationIndex> buildAstLocationIndex(AstStatBlock* root);
+
 std::vector<AstNode*> findAncestryAtPositionForAutocomplete(const SourceModule& source, Position pos);
 std::vector<AstNode*> findAstAncestryOfPosition(const SourceModule& source, Position pos, bool includeTypes = false);
 AstNode* findNodeAtPosition(const SourceModule& source, Position pos);
@@ -1,7 +1,9 @@
 // This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
 #pragma once
 
+#include <memory>
 #include <string>
+#include <string_view>
 #include <optional>
 
 namespace Luau
@@ -23,6 +25,18 @@ struct SourceCode
 
     std::string source;
     Type type;
+
+    // When set, the source is read from `view` instead of `source`, which lets resolvers provide source that lives elsewhere, such as in a memory-mapped
+    // file, without a copy; `source` is left empty. The storage keeps that memory alive; the AST doesn't refer to the source, so it only needs to
+    // live until the module is parsed.
+    std::shared_ptr<const void> storage;
+    std::string_view view;
+
+    // Preferred way to read the source text, since it works for both forms above
+    std::string_view text() const
+    {
+        return storage ? view : std::string_view(source);
+    }
 };
 
 struct ModuleInfo
@@ -90,6 +90,19 @@ struct FrontendOptions
     // If not empty, randomly shuffle the constraint set before attempting to
     // solve.  Use this value to seed the random number generator.
     std::optional<unsigned> randomizeConstraintResolutionSeed;
+
+    // When true, an index of the AST by location is built for every parsed
+    // module.  This speeds up repeated position queries from editors at the
+    // cost of some memory per AST node.
+    bool indexAstLocations = false;
+
+    // Number of threads used to typecheck modules that don't depend on each
+    // other; a module is checked as soon as all modules it requires are.
+    // When this is more than 1, getHumanReadableModuleName of the file
+    // resolver, TypeChecker::prepareModuleScope and the internal error
+    // callback can be called from worker threads.  Autocomplete and the
+    // deferred constraint solver always check modules one at a time.
+    unsigned int typecheckThreads = 1;
 };
 
 struct CheckResult
@@ -170,6 +183,9 @@ private:
 
     bool parseGraph(std::vector<ModuleName>& buildQueue, const ModuleName& root, bool forAutocomplete);
 
+    void checkBuildQueueParallel(
+        const std::vector<ModuleName>& buildQueue, bool cycleDetected, const FrontendOptions& frontendOptions, CheckResult& checkResult);
+
     static LintResult classifyLints(const std::vector<LintWarning>& warnings, const Config& config);
 
     ScopePtr getModuleEnvironment(const SourceModule& module, const Config& config, bool forAutocomplete);
@@ -17,6 +17,7 @@ namespace Luau
 {
 
 struct Module;
+struct AstLocationIndex;
 
 using ScopePtr = std::shared_ptr<struct Scope>;
 using ModulePtr = std::shared_ptr<Module>;
@@ -42,6 +43,9 @@ struct SourceModule
     std::vector<HotComment> hotcomments;
     std::vector<Comment> commentLocations;
 
+    // Optional index used to speed up position queries, see buildAstLocationIndex
+    std::shared_ptr<AstLocationIndex> locationIndex;
+
     SourceModule()
         : allocator(new Allocator)
         , names(new AstNameTable(*allocator))
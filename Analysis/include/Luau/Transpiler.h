@@ -4,7 +4,9 @@
 #include "Luau/Location.h"
 #include "Luau/ParseOptions.h"
 
+#include <functional>
 #include <string>
+#include <string_view>
 
 namespace Luau
 {
@@ -25,6 +27,10 @@ void dump(AstNode* node);
 std::string transpile(AstStatBlock& ast);
 std::string transpileWithTypes(AstStatBlock& block);
 
+// Streaming versions that pass the code to the output in chunks of up to a few tens of KB instead of building the entire string in memory
+void transpile(AstStatBlock& block, const std::function<void(std::string_view)>& output);
+void transpileWithTypes(AstStatBlock& block, const std::function<void(std::string_view)>& output);
+
 // Only fails when parsing fails
 TranspileResult transpile(std::string_view source, ParseOptions options = ParseOptions{}, bool withTypes = false);
 
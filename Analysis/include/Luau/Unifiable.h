@@ -3,6 +3,7 @@
 
 #include "Luau/Variant.h"
 
+#include <atomic>
 #include <string>
 
 namespace Luau
@@ -139,7 +140,7 @@ struct Error
     int index;
 
 private:
-    static int nextIndex;
+    static std::atomic<int> nextIndex;
 };
 
 template<typename Id, typename... Value>
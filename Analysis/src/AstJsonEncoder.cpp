@@ -3,28 +3,43 @@
 
 #include "Luau/Ast.h"
 #include "Luau/ParseResult.h"
-#include "Luau/StringUtils.h"
 #include "Luau/Common.h"
 
 #include <math.h>
+#include <stdio.h>
 
 namespace Luau
 {
 
 struct AstJsonEncoder : public AstVisitor
 {
-    static constexpr int CHUNK_SIZE = 1024;
-    std::vector<std::string> chunks;
+    // output is accumulated in a buffer that is flushed whenever it grows past this size
+    static constexpr size_t FLUSH_SIZE = 64 * 1024;
+
+    std::string buffer;
+    const std::function<void(std::string_view)>* output = nullptr;
     bool comma = false;
 
-    AstJsonEncoder()
+    AstJsonEncoder() = default;
+
+    explicit AstJsonEncoder(const std::function<void(std::string_view)>& output)
+        : output(&output)
     {
-        newChunk();
+        buffer.reserve(FLUSH_SIZE * 2);
     }
 
     std::string str()
     {
-        return join(chunks, "");
+        return std::move(buffer);
+    }
+
+    void flush()
+    {
+        if (output && !buffer.empty())
+        {
+            (*output)(buffer);
+            buffer.clear();
+        }
     }
 
     bool pushComma()
@@ -39,43 +54,17 @@ struct AstJsonEncoder : public AstVisitor
         comma = c;
     }
 
-    void newChunk()
-    {
-        chunks.emplace_back();
-        chunks.back().reserve(CHUNK_SIZE);
-    }
-
-    void appendChunk(std::string_view sv)
-    {
-        if (sv.size() > CHUNK_SIZE)
-        {
-            chunks.emplace_back(sv);
-            newChunk();
-            return;
-        }
-
-        auto& chunk = chunks.back();
-        if (chunk.size() + sv.size() < CHUNK_SIZE)
-        {
-            chunk.append(sv.data(), sv.size());
-            return;
-        }
-
-        size_t prefix = CHUNK_SIZE - chunk.size();
-        chunk.append(sv.data(), prefix);
-        newChunk();
-
-        chunks.back().append(sv.data() + prefix, sv.size() - prefix);
-    }
-
     void writeRaw(std::string_view sv)
     {
-        appendChunk(sv);
+        buffer.append(sv.data(), sv.size());
+
+        if (output && buffer.size() >= FLUSH_SIZE)
+            flush();
     }
 
     void writeRaw(char c)
     {
-        writeRaw(std::string_view{&c, 1});
+        buffer.push_back(c);
     }
 
     void writeType(std::string_view propValue)
@@ -123,8 +112,8 @@ struct AstJsonEncoder : public AstVisitor
         case FP_ZERO:
         default:
             char b[32];
-            snprintf(b, sizeof(b), "%.17g", d);
-            writeRaw(b);
+            int len = snprintf(b, sizeof(b), "%.17g", d);
+            writeRaw(std::string_view(b, len));
             break;
         }
     }
@@ -132,52 +121,87 @@ struct AstJsonEncoder : public AstVisitor
     void writeString(std::string_view sv)
     {
         // TODO escape more accurately?
-        writeRaw("\"");
+        writeRaw('"');
+
+        size_t start = 0;
 
-        for (char c : sv)
+        for (size_t i = 0; i < sv.size(); ++i)
         {
+            char c = sv[i];
+
+            if (c != '"' && c != '\\' && c >= ' ')
+                continue;
+
+            // characters that don't need escaping are written in runs
+            writeRaw(sv.substr(start, i - start));
+            start = i + 1;
+
             if (c == '"')
+            {
                 writeRaw("\\\"");
+            }
             else if (c == '\\')
+            {
                 writeRaw("\\\\");
-            else if (c < ' ')
-                writeRaw(format("\\u%04x", c));
-            else if (c == '\n')
-                writeRaw("\\n");
+            }
             else
-                writeRaw(c);
+            {
+                char b[16];
+                int len = snprintf(b, sizeof(b), "\\u%04x", c);
+                writeRaw(std::string_view(b, len));
+            }
         }
 
-        writeRaw("\"");
+        writeRaw(sv.substr(start));
+        writeRaw('"');
     }
 
     void write(char c)
     {
         writeString(std::string_view(&c, 1));
     }
+
+    void writeInteger(unsigned long long value, bool negative)
+    {
+        char b[24];
+        char* end = b + sizeof(b);
+        char* p = end;
+
+        do
+        {
+            *--p = char('0' + value % 10);
+            value /= 10;
+        } while (value);
+
+        if (negative)
+            *--p = '-';
+
+        writeRaw(std::string_view(p, end - p));
+    }
+
     void write(int i)
     {
-        writeRaw(std::to_string(i));
+        write((long long)i);
     }
     void write(long i)
     {
-        writeRaw(std::to_string(i));
+        write((long long)i);
     }
     void write(long long i)
     {
-        writeRaw(std::to_string(i));
+        writeInteger(i < 0 ? 0ull - (unsigned long long)i : (unsigned long long)i, i < 0);
     }
     void write(unsigned int i)
     {
-        writeRaw(std::to_string(i));
+        writeInteger(i, false);
     }
     void write(unsigned long i)
     {
-        writeRaw(std::to_string(i));
+        writeInteger(i, false);
     }
     void write(unsigned long long i)
     {
-        writeRaw(std::to_string(i));
+        writeInteger(i, false);
     }
     void write(std::nullptr_t)
     {
@@ -1181,10 +1205,10 @@ struct AstJsonEncoder : public AstVisitor
         return false;
     }
 
-    void writeComments(std::vector<Comment> commentLocations)
+    void writeComments(const std::vector<Comment>& commentLocations)
     {
         bool commentComma = false;
-        for (Comment comment : commentLocations)
+        for (const Comment& comment : commentLocations)
         {
             if (commentComma)
             {
@@ -1235,4 +1259,22 @@ std::string toJson(AstNode* node, const std::vector<Comment>& commentLocations)
     return encoder.str();
 }
 
+void toJson(AstNode* node, const std::function<void(std::string_view)>& output)
+{
+    AstJsonEncoder encoder(output);
+    node->visit(&encoder);
+    encoder.flush();
+}
+
+void toJson(AstNode* node, const std::vector<Comment>& commentLocations, const std::function<void(std::string_view)>& output)
+{
+    AstJsonEncoder encoder(output);
+    encoder.writeRaw(R"({"root":)");
+    node->visit(&encoder);
+    encoder.writeRaw(R"(,"commentLocations":[)");
+    encoder.writeComments(commentLocations);
+    encoder.writeRaw("]}");
+    encoder.flush();
+}
+
 } // namespace Luau
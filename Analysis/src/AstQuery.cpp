@@ -17,6 +17,32 @@ LUAU_FASTFLAGVARIABLE(SupportTypeAliasGoToDeclaration, false);
 namespace Luau
 {
 
+struct AstLocationIndex
+{
+    struct Entry
+    {
+        AstNode* node;
+
+        // covers the locations of the node and all of its descendants
+        Location extent;
+
+        // entries are stored in traversal order, so the descendants of a node are the entries up to subtreeEnd
+        uint32_t subtreeEnd = 0;
+
+        // range of the direct children in the children array
+        uint32_t childrenBegin = 0;
+        uint32_t childrenEnd = 0;
+
+        // when the extents of the children are ordered, the children that include a position can be found with a binary search
+        bool sortedChildren = false;
+    };
+
+    AstStatBlock* root = nullptr;
+
+    std::vector<Entry> entries;
+    std::vector<uint32_t> children;
+};
+
 namespace
 {
 
@@ -229,8 +255,141 @@ struct FindFullAncestry final : public AstVisitor
     }
 };
 
+struct BuildLocationIndex : public AstVisitor
+{
+    AstLocationIndex& index;
+    AstNode* current = nullptr;
+
+    explicit BuildLocationIndex(AstLocationIndex& index)
+        : index(index)
+    {
+    }
+
+    bool visit(AstNode* node) override
+    {
+        // node->visit below visits the node a second time before traversing its children
+        if (node == current)
+            return true;
+
+        size_t self = index.entries.size();
+        index.entries.push_back({node, node->location});
+
+        AstNode* parent = current;
+        current = node;
+        node->visit(this);
+        current = parent;
+
+        index.entries[self].subtreeEnd = uint32_t(index.entries.size());
+        return false;
+    }
+
+    // types are indexed so that they can be included in the ancestry on request, while type packs are never part of a query result
+    bool visit(AstType* type) override
+    {
+        return visit(static_cast<AstNode*>(type));
+    }
+
+    bool visit(AstTypePack* typePack) override
+    {
+        return false;
+    }
+};
+
+bool matchesPosition(AstNode* node, Position pos, Position documentEnd)
+{
+    // Edge case: If we ask for the node at the position that is the very end of the document
+    // return the innermost AST element that ends at that position.
+    return node->location.contains(pos) || (node->location.end == documentEnd && pos >= documentEnd);
+}
+
+// Produces the same nodes in the same order as FindFullAncestry (or FindNode when descendIntoBlocks is set) without visiting subtrees that can't
+// contain the position
+void findAncestryInIndex(const AstLocationIndex& index, uint32_t i, Position pos, Position documentEnd, bool includeTypes, bool descendIntoBlocks,
+    std::vector<AstNode*>& result)
+{
+    const AstLocationIndex::Entry& entry = index.entries[i];
+
+    if (!includeTypes && entry.node->asType())
+        return;
+
+    if (matchesPosition(entry.node, pos, documentEnd))
+        result.push_back(entry.node);
+    else if (!descendIntoBlocks || !entry.node->is<AstStatBlock>())
+        return;
+
+    const uint32_t* begin = index.children.data() + entry.childrenBegin;
+    const uint32_t* end = index.children.data() + entry.childrenEnd;
+
+    if (entry.sortedChildren)
+    {
+        // child extents are ordered by both ends, so the ones that include the position form a contiguous range
+        begin = std::lower_bound(begin, end, pos, [&](uint32_t child, const Position& p) {
+            return index.entries[child].extent.end < p;
+        });
+        end = std::upper_bound(begin, end, pos, [&](const Position& p, uint32_t child) {
+            return p < index.entries[child].extent.begin;
+        });
+    }
+
+    for (const uint32_t* child = begin; child != end; ++child)
+    {
+        if (index.entries[*child].extent.containsClosed(pos))
+            findAncestryInIndex(index, *child, pos, documentEnd, includeTypes, descendIntoBlocks, result);
+    }
+}
+
 } // namespace
 
+std::shared_ptr<AstLocationIndex> buildAstLocationIndex(AstStatBlock* root)
+{
+    std::shared_ptr<AstLocationIndex> index = std::make_shared<AstLocationIndex>();
+    index->root = root;
+
+    BuildLocationIndex builder{*index};
+    root->visit(&builder);
+
+    std::vector<AstLocationIndex::Entry>& entries = index->entries;
+    index->children.reserve(entries.size());
+
+    for (uint32_t i = 0; i < entries.size(); ++i)
+    {
+        entries[i].childrenBegin = uint32_t(index->children.size());
+
+        for (uint32_t child = i + 1; child < entries[i].subtreeEnd; child = entries[child].subtreeEnd)
+            index->children.push_back(child);
+
+        entries[i].childrenEnd = uint32_t(index->children.size());
+    }
+
+    // children come after their parents, so extents are computed bottom-up in reverse order
+    for (size_t i = entries.size(); i > 0; --i)
+    {
+        AstLocationIndex::Entry& entry = entries[i - 1];
+
+        // locations of error nodes are not always well-formed, but the extent has to include both ends
+        entry.extent.begin = std::min(entry.extent.begin, entry.extent.end);
+        entry.sortedChildren = true;
+
+        for (uint32_t j = entry.childrenBegin; j < entry.childrenEnd; ++j)
+        {
+            const Location& extent = entries[index->children[j]].extent;
+
+            entry.extent.begin = std::min(entry.extent.begin, extent.begin);
+            entry.extent.end = std::max(entry.extent.end, extent.end);
+
+            if (j > entry.childrenBegin)
+            {
+                const Location& previous = entries[index->children[j - 1]].extent;
+
+                if (extent.begin < previous.begin || extent.end < previous.end)
+                    entry.sortedChildren = false;
+            }
+        }
+    }
+
+    return index;
+}
+
 std::vector<AstNode*> findAncestryAtPositionForAutocomplete(const SourceModule& source, Position pos)
 {
     AutocompleteNodeFinder finder{pos, source.root};
@@ -244,6 +403,14 @@ std::vector<AstNode*> findAstAncestryOfPosition(const SourceModule& source, Posi
     if (pos > end)
         pos = end;
 
+    if (source.locationIndex && source.locationIndex->root == source.root)
+    {
+        std::vector<AstNode*> nodes;
+        findAncestryInIndex(*source.locationIndex, 0, pos, end, includeTypes && FFlag::SupportTypeAliasGoToDeclaration,
+            /* descendIntoBlocks= */ false, nodes);
+        return nodes;
+    }
+
     FindFullAncestry finder(pos, end, includeTypes);
     source.root->visit(&finder);
     return finder.nodes;
@@ -258,6 +425,13 @@ AstNode* findNodeAtPosition(const SourceModule& source, Position pos)
     if (pos > end)
         pos = end;
 
+    if (source.locationIndex && source.locationIndex->root == source.root)
+    {
+        std::vector<AstNode*> nodes;
+        findAncestryInIndex(*source.locationIndex, 0, pos, end, /* includeTypes= */ false, /* descendIntoBlocks= */ true, nodes);
+        return nodes.empty() ? nullptr : nodes.back();
+    }
+
     FindNode findNode{pos, end};
     findNode.visit(source.root);
     return findNode.best;
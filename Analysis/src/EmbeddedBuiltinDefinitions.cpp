@@ -180,6 +180,7 @@ declare table: {
 declare debug: {
     info: (<R...>(thread: thread, level: number, options: string) -> R...) & (<R...>(level: number, options: string) -> R...) & (<A..., R1..., R2...>(func: (A...) -> R1..., options: string) -> R2...),
     traceback: ((message: string?, level: number?) -> string) & ((thread: thread, message: string?, level: number?) -> string),
+    capture: ((level: number?) -> any) & ((thread: thread, level: number?) -> any),
 }
 
 declare utf8: {
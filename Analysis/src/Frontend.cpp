@@ -1,6 +1,7 @@
 // This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
 #include "Luau/Frontend.h"
 
+#include "Luau/AstQuery.h"
 #include "Luau/BuiltinDefinitions.h"
 #include "Luau/Clone.h"
 #include "Luau/Common.h"
@@ -21,8 +22,12 @@
 
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
 
 LUAU_FASTINT(LuauTypeInferIterationLimit)
 LUAU_FASTINT(LuauTarjanChildLimit)
@@ -413,6 +418,125 @@ double getTimestamp()
     return double(duration_cast<nanoseconds>(high_resolution_clock::now().time_since_epoch()).count()) / 1e9;
 }
 
+// Discards the parts of the type graph that aren't retained and adds the errors that the type checker doesn't report itself
+void finishModule(Module& module, const ModuleName& moduleName, const SourceModule& sourceModule, Mode mode,
+    const std::vector<RequireCycle>& requireCycles, bool retainFullTypeGraphs)
+{
+    if (!retainFullTypeGraphs)
+    {
+        // copyErrors needs to allocate into interfaceTypes as it copies
+        // types out of internalTypes, so we unfreeze it here.
+        unfreeze(module.interfaceTypes);
+        copyErrors(module.errors, module.interfaceTypes);
+        freeze(module.interfaceTypes);
+
+        module.internalTypes.clear();
+
+        if (FFlag::LuauScopelessModule)
+        {
+            module.astTypes.clear();
+            module.astTypePacks.clear();
+            module.astExpectedTypes.clear();
+            module.astOriginalCallTypes.clear();
+            module.astOverloadResolvedTypes.clear();
+            module.astResolvedTypes.clear();
+            module.astResolvedTypePacks.clear();
+            module.astScopes.clear();
+
+            module.scopes.clear();
+        }
+        else
+        {
+            module.astTypes.clear();
+            module.astExpectedTypes.clear();
+            module.astOriginalCallTypes.clear();
+            module.astResolvedTypes.clear();
+            module.astResolvedTypePacks.clear();
+            module.scopes.resize(1);
+        }
+    }
+
+    if (mode != Mode::NoCheck)
+    {
+        for (const RequireCycle& cyc : requireCycles)
+        {
+            TypeError te{cyc.location, moduleName, ModuleHasCyclicDependency{cyc.path}};
+
+            module.errors.push_back(te);
+        }
+    }
+
+    ErrorVec parseErrors;
+
+    for (const ParseError& pe : sourceModule.parseErrors)
+        parseErrors.push_back(TypeError{pe.getLocation(), moduleName, SyntaxError{pe.what()}});
+
+    module.errors.insert(module.errors.begin(), parseErrors.begin(), parseErrors.end());
+}
+
+// A module that is typechecked on a worker thread; everything that reads the state of the frontend is prepared before the workers start
+struct ParallelCheckItem
+{
+    ModuleName name;
+    SourceNode* sourceNode = nullptr;
+    const SourceModule* sourceModule = nullptr;
+    Mode mode = Mode::NoCheck;
+    ScopePtr environmentScope;
+    std::vector<RequireCycle> requireCycles;
+
+    // items that require this one, and the number of items this one requires that haven't been checked yet
+    std::vector<size_t> dependents;
+    size_t pendingDependencies = 0;
+
+    ModulePtr module;
+    double duration = 0.0;
+    std::exception_ptr exception;
+};
+
+// Resolves requires of the item that a worker is checking.  Required items resolve to the modules that were just produced for them, and
+// everything else is looked up in the frontend, which isn't modified until all workers are done; this is what a sequential check would see.
+struct ParallelCheckModuleResolver : ModuleResolver
+{
+    ParallelCheckModuleResolver(FrontendModuleResolver& frontendResolver, const std::vector<ParallelCheckItem>& items,
+        const std::unordered_map<ModuleName, size_t>& itemIndices)
+        : frontendResolver(frontendResolver)
+        , items(items)
+        , itemIndices(itemIndices)
+    {
+    }
+
+    std::optional<ModuleInfo> resolveModuleInfo(const ModuleName& currentModuleName, const AstExpr& pathExpr) override
+    {
+        return frontendResolver.resolveModuleInfo(currentModuleName, pathExpr);
+    }
+
+    const ModulePtr getModule(const ModuleName& moduleName) const override
+    {
+        // items that come later in the build queue are only required through cycles and aren't waited for
+        auto it = itemIndices.find(moduleName);
+        if (it != itemIndices.end() && it->second < current && items[current].sourceNode->requireSet.count(moduleName))
+            return items[it->second].module;
+
+        return frontendResolver.getModule(moduleName);
+    }
+
+    bool moduleExists(const ModuleName& moduleName) const override
+    {
+        return frontendResolver.moduleExists(moduleName);
+    }
+
+    std::string getHumanReadableModuleName(const ModuleName& moduleName) const override
+    {
+        return frontendResolver.getHumanReadableModuleName(moduleName);
+    }
+
+    FrontendModuleResolver& frontendResolver;
+    const std::vector<ParallelCheckItem>& items;
+    const std::unordered_map<ModuleName, size_t>& itemIndices;
+
+    size_t current = 0;
+};
+
 } // namespace
 
 Frontend::Frontend(FileResolver* fileResolver, ConfigResolver* configResolver, const FrontendOptions& options)
@@ -465,6 +589,12 @@ CheckResult Frontend::check(const ModuleName& name, std::optional<FrontendOption
     std::vector<ModuleName> buildQueue;
     bool cycleDetected = parseGraph(buildQueue, name, frontendOptions.forAutocomplete);
 
+    if (frontendOptions.typecheckThreads > 1 && !frontendOptions.forAutocomplete && !FFlag::DebugLuauDeferredConstraintResolution)
+    {
+        checkBuildQueueParallel(buildQueue, cycleDetected, frontendOptions, checkResult);
+        return checkResult;
+    }
+
     for (const ModuleName& moduleName : buildQueue)
     {
         LUAU_ASSERT(sourceNodes.count(moduleName));
@@ -561,64 +691,183 @@ CheckResult Frontend::check(const ModuleName& name, std::optional<FrontendOption
         if (module == nullptr)
             throw InternalCompilerError("Frontend::check produced a nullptr module for " + moduleName, moduleName);
 
-        if (!frontendOptions.retainFullTypeGraphs)
-        {
-            // copyErrors needs to allocate into interfaceTypes as it copies
-            // types out of internalTypes, so we unfreeze it here.
-            unfreeze(module->interfaceTypes);
-            copyErrors(module->errors, module->interfaceTypes);
-            freeze(module->interfaceTypes);
+        finishModule(*module, moduleName, sourceModule, mode, requireCycles, frontendOptions.retainFullTypeGraphs);
 
-            module->internalTypes.clear();
+        checkResult.errors.insert(checkResult.errors.end(), module->errors.begin(), module->errors.end());
 
-            if (FFlag::LuauScopelessModule)
-            {
-                module->astTypes.clear();
-                module->astTypePacks.clear();
-                module->astExpectedTypes.clear();
-                module->astOriginalCallTypes.clear();
-                module->astOverloadResolvedTypes.clear();
-                module->astResolvedTypes.clear();
-                module->astResolvedTypePacks.clear();
-                module->astScopes.clear();
-
-                module->scopes.clear();
-            }
-            else
+        moduleResolver.modules[moduleName] = std::move(module);
+        sourceNode.dirtyModule = false;
+    }
+
+    return checkResult;
+}
+
+void Frontend::checkBuildQueueParallel(
+    const std::vector<ModuleName>& buildQueue, bool cycleDetected, const FrontendOptions& frontendOptions, CheckResult& checkResult)
+{
+    LUAU_TIMETRACE_SCOPE("Frontend::checkBuildQueueParallel", "Frontend");
+
+    std::vector<ParallelCheckItem> items;
+    std::unordered_map<ModuleName, size_t> itemIndices;
+
+    for (const ModuleName& moduleName : buildQueue)
+    {
+        LUAU_ASSERT(sourceNodes.count(moduleName));
+        SourceNode& sourceNode = sourceNodes[moduleName];
+
+        if (!sourceNode.hasDirtyModule(/* forAutocomplete */ false))
+            continue;
+
+        LUAU_ASSERT(sourceModules.count(moduleName));
+        SourceModule& sourceModule = sourceModules[moduleName];
+
+        const Config& config = configResolver->getConfig(moduleName);
+
+        ParallelCheckItem item;
+        item.name = moduleName;
+        item.sourceNode = &sourceNode;
+        item.sourceModule = &sourceModule;
+        item.mode = sourceModule.mode.value_or(config.mode);
+        item.environmentScope = getModuleEnvironment(sourceModule, config, /* forAutocomplete */ false);
+
+        if (cycleDetected)
+            item.requireCycles = getRequireCycles(fileResolver, sourceNodes, &sourceNode, item.mode == Mode::NoCheck);
+
+        sourceModule.cyclic = !item.requireCycles.empty();
+
+        // the build queue is in topological order, so the item waits for all modules it requires that are checked before it
+        for (const ModuleName& dep : sourceNode.requireSet)
+        {
+            auto it = itemIndices.find(dep);
+            if (it != itemIndices.end())
             {
-                module->astTypes.clear();
-                module->astExpectedTypes.clear();
-                module->astOriginalCallTypes.clear();
-                module->astResolvedTypes.clear();
-                module->astResolvedTypePacks.clear();
-                module->scopes.resize(1);
+                items[it->second].dependents.push_back(items.size());
+                item.pendingDependencies++;
             }
         }
 
-        if (mode != Mode::NoCheck)
+        itemIndices[moduleName] = items.size();
+        items.push_back(std::move(item));
+    }
+
+    std::mutex mutex;
+    std::condition_variable readyChanged;
+
+    // items are taken from the back, so the ones that come first in the queue are started first
+    std::vector<size_t> ready;
+    for (size_t i = items.size(); i > 0; --i)
+        if (items[i - 1].pendingDependencies == 0)
+            ready.push_back(i - 1);
+
+    size_t remaining = items.size();
+    bool failed = false;
+
+    auto worker = [&]() {
+        // every worker has its own type checker, so that the arenas, the normalizer and the unifier caches are never shared between threads
+        InternalErrorReporter workerIceHandler = iceHandler;
+        ParallelCheckModuleResolver workerResolver{moduleResolver, items, itemIndices};
+
+        TypeChecker workerTypeChecker(&workerResolver, builtinTypes, &workerIceHandler);
+        workerTypeChecker.globalScope = typeChecker.globalScope;
+        workerTypeChecker.prepareModuleScope = typeChecker.prepareModuleScope;
+        workerTypeChecker.finishTime = typeChecker.finishTime;
+        workerTypeChecker.instantiationChildLimit = typeChecker.instantiationChildLimit;
+        workerTypeChecker.unifierIterationLimit = typeChecker.unifierIterationLimit;
+
+        std::unique_lock<std::mutex> lock(mutex);
+
+        for (;;)
         {
-            for (const RequireCycle& cyc : requireCycles)
+            readyChanged.wait(lock, [&] {
+                return failed || remaining == 0 || !ready.empty();
+            });
+
+            if (failed || ready.empty())
+                break;
+
+            size_t index = ready.back();
+            ready.pop_back();
+
+            lock.unlock();
+
+            ParallelCheckItem& item = items[index];
+
+            try
+            {
+                double timestamp = getTimestamp();
+
+                workerResolver.current = index;
+                workerTypeChecker.requireCycles = item.requireCycles;
+
+                ModulePtr module = workerTypeChecker.check(*item.sourceModule, item.mode, item.environmentScope);
+
+                if (module == nullptr)
+                    throw InternalCompilerError("Frontend::check produced a nullptr module for " + item.name, item.name);
+
+                finishModule(*module, item.name, *item.sourceModule, item.mode, item.requireCycles, frontendOptions.retainFullTypeGraphs);
+
+                item.module = std::move(module);
+                item.duration = getTimestamp() - timestamp;
+            }
+            catch (...)
             {
-                TypeError te{cyc.location, moduleName, ModuleHasCyclicDependency{cyc.path}};
+                item.exception = std::current_exception();
+            }
+
+            lock.lock();
 
-                module->errors.push_back(te);
+            remaining--;
+
+            if (item.exception)
+                failed = true;
+            else
+            {
+                for (size_t dependent : item.dependents)
+                    if (--items[dependent].pendingDependencies == 0)
+                        ready.push_back(dependent);
             }
-        }
 
-        ErrorVec parseErrors;
+            readyChanged.notify_all();
+        }
+    };
 
-        for (const ParseError& pe : sourceModule.parseErrors)
-            parseErrors.push_back(TypeError{pe.getLocation(), moduleName, SyntaxError{pe.what()}});
+    unsigned int threads = unsigned(std::min(size_t(frontendOptions.typecheckThreads), items.size()));
 
-        module->errors.insert(module->errors.begin(), parseErrors.begin(), parseErrors.end());
+    if (threads <= 1)
+    {
+        worker();
+    }
+    else
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
 
-        checkResult.errors.insert(checkResult.errors.end(), module->errors.begin(), module->errors.end());
+        for (unsigned int i = 0; i < threads; ++i)
+            workers.emplace_back(worker);
 
-        moduleResolver.modules[moduleName] = std::move(module);
-        sourceNode.dirtyModule = false;
+        for (std::thread& thread : workers)
+            thread.join();
     }
 
-    return checkResult;
+    // results are committed in the order of the build queue, so errors are reported in the same order as when checking sequentially;
+    // if a module failed, the modules that come before it are committed and the first failure is rethrown
+    for (ParallelCheckItem& item : items)
+    {
+        if (item.exception)
+            std::rethrow_exception(item.exception);
+
+        if (!item.module)
+            continue;
+
+        stats.timeCheck += item.duration;
+        stats.filesStrict += item.mode == Mode::Strict;
+        stats.filesNonstrict += item.mode == Mode::Nonstrict;
+
+        checkResult.errors.insert(checkResult.errors.end(), item.module->errors.begin(), item.module->errors.end());
+
+        moduleResolver.modules[item.name] = std::move(item.module);
+        item.sourceNode->dirtyModule = false;
+    }
 }
 
 bool Frontend::parseGraph(std::vector<ModuleName>& buildQueue, const ModuleName& root, bool forAutocomplete)
@@ -886,7 +1135,7 @@ ModulePtr Frontend::check(
         std::optional<SourceCode> source = fileResolver->readSource(sourceModule.name);
         if (source)
         {
-            logger->captureSource(source->source);
+            logger->captureSource(std::string(source->text()));
         }
     }
 
@@ -983,7 +1232,7 @@ std::pair<SourceNode*, SourceModule*> Frontend::getSourceNode(const ModuleName&
     const Config& config = configResolver->getConfig(name);
     ParseOptions opts = config.parseOptions;
     opts.captureComments = true;
-    SourceModule result = parse(name, source->source, opts);
+    SourceModule result = parse(name, source->text(), opts);
     result.type = source->type;
 
     RequireTraceResult& require = requireTrace[name];
@@ -1058,6 +1307,9 @@ SourceModule Frontend::parse(const ModuleName& name, std::string_view src, const
 
     sourceModule.name = name;
 
+    if (options.indexAstLocations)
+        sourceModule.locationIndex = buildAstLocationIndex(sourceModule.root);
+
     if (parseOptions.captureComments)
     {
         sourceModule.commentLocations = std::move(parseResult.commentLocations);
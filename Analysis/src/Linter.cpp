@@ -1725,7 +1725,7 @@ private:
                 if (const char* error = checkStringFormat(fmt->value.data, fmt->value.size))
                     emitWarning(*context, LintWarning::Code_FormatString, fmt->location, "Invalid format string: %s", error);
         }
-        else if (name == "pack" || name == "packsize" || name == "unpack")
+        else if (name == "pack" || name == "packsize" || name == "unpack" || name == "unpackmany")
         {
             if (AstExprConstantString* fmt = self->as<AstExprConstantString>())
                 if (const char* error = checkStringPack(fmt->value.data, fmt->value.size, name == "packsize"))
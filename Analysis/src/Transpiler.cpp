@@ -53,22 +53,48 @@ struct Writer
 
 struct StringWriter : Writer
 {
+    // when writing to an output, the code is accumulated in a buffer that is flushed whenever it grows past this size
+    static constexpr size_t kFlushSize = 64 * 1024;
+
     std::string ss;
     Position pos{0, 0};
     char lastChar = '\0'; // used to determine whether we need to inject an extra space to preserve grammatical correctness.
 
+    const std::function<void(std::string_view)>* output = nullptr;
+
+    StringWriter() = default;
+
+    explicit StringWriter(const std::function<void(std::string_view)>& output)
+        : output(&output)
+    {
+        ss.reserve(kFlushSize * 2);
+    }
+
     const std::string& str() const
     {
         return ss;
     }
 
+    void flush()
+    {
+        if (output && !ss.empty())
+        {
+            (*output)(ss);
+            ss.clear();
+        }
+    }
+
     void advance(const Position& newPos) override
     {
         while (pos.line < newPos.line)
             newline();
 
         if (pos.column < newPos.column)
-            write(std::string(newPos.column - pos.column, ' '));
+        {
+            ss.append(newPos.column - pos.column, ' ');
+            pos.column = newPos.column;
+            lastChar = ' ';
+        }
     }
 
     void maybeSpace(const Position& newPos, int reserve) override
@@ -100,6 +126,9 @@ struct StringWriter : Writer
         ss.append(s.data(), s.size());
         pos.column += unsigned(s.size());
         lastChar = s[s.size() - 1];
+
+        if (output && ss.size() >= kFlushSize)
+            flush();
     }
 
     void write(char c)
@@ -157,7 +186,15 @@ struct StringWriter : Writer
             quote = '\"';
 
         write(quote);
-        write(escape(s));
+
+        // most strings don't have any characters that need to be escaped, so they are written without a temporary copy
+        if (std::any_of(s.begin(), s.end(), [](char c) {
+                return uint8_t(c) < ' ' || c == '\\' || c == '\'' || c == '\"' || c == '`' || c == '{';
+            }))
+            write(escape(s));
+        else
+            write(s);
+
         write(quote);
     }
 };
@@ -324,14 +361,10 @@ struct Printer
                 writer.literal("0/0");
             else
             {
-                if (isIntegerish(a->value))
-                    writer.literal(std::to_string(int(a->value)));
-                else
-                {
-                    char buffer[100];
-                    size_t len = snprintf(buffer, sizeof(buffer), "%.17g", a->value);
-                    writer.literal(std::string_view{buffer, len});
-                }
+                char buffer[100];
+                size_t len = isIntegerish(a->value) ? snprintf(buffer, sizeof(buffer), "%d", int(a->value))
+                                                    : snprintf(buffer, sizeof(buffer), "%.17g", a->value);
+                writer.literal(std::string_view{buffer, len});
             }
         }
         else if (const auto& a = expr.as<AstExprConstantString>())
@@ -371,7 +404,7 @@ struct Printer
         else if (const auto& a = expr.as<AstExprIndexName>())
         {
             visualize(*a->expr);
-            writer.symbol(std::string(1, a->op));
+            writer.symbol(std::string_view(&a->op, 1));
             writer.write(a->index.value);
         }
         else if (const auto& a = expr.as<AstExprIndexExpr>())
@@ -1205,6 +1238,22 @@ std::string transpileWithTypes(AstStatBlock& block)
     return writer.str();
 }
 
+void transpile(AstStatBlock& block, const std::function<void(std::string_view)>& output)
+{
+    StringWriter writer(output);
+    Printer(writer).visualizeBlock(block);
+    writer.flush();
+}
+
+void transpileWithTypes(AstStatBlock& block, const std::function<void(std::string_view)>& output)
+{
+    StringWriter writer(output);
+    Printer printer(writer);
+    printer.writeTypes = true;
+    printer.visualizeBlock(block);
+    writer.flush();
+}
+
 TranspileResult transpile(std::string_view source, ParseOptions options, bool withTypes)
 {
     auto allocator = Allocator{};
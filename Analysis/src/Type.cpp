@@ -850,6 +850,10 @@ TypeId BuiltinTypes::makeStringMetatable()
         {"upper", {stringToStringType}},
         {"split", {makeFunction(*arena, stringType, {}, {}, {optionalString}, {},
                       {arena->addType(TableType{{}, TableIndexer{numberType, stringType}, TypeLevel{}, TableState::Sealed})})}},
+        {"base64encode", {stringToStringType}},
+        {"base64decode", {makeFunction(*arena, stringType, {}, {}, {}, {}, {optionalString})}},
+        {"hexencode", {stringToStringType}},
+        {"hexdecode", {makeFunction(*arena, stringType, {}, {}, {}, {}, {optionalString})}},
         {"pack", {arena->addType(FunctionType{
                      arena->addTypePack(TypePack{{stringType}, anyTypePack}),
                      oneStringPack,
@@ -859,6 +863,8 @@ TypeId BuiltinTypes::makeStringMetatable()
                        arena->addTypePack(TypePack{{stringType, stringType, optionalNumber}}),
                        anyTypePack,
                    })}},
+        {"unpackmany", {makeFunction(*arena, stringType, {}, {}, {stringType, numberType, optionalNumber}, {},
+                           {arena->addType(TableType{{}, TableIndexer{numberType, anyType}, TypeLevel{}, TableState::Sealed}), numberType})}},
     };
 
     assignPropDocumentationSymbols(stringLib, "@luau/global/string");
@@ -6,7 +6,8 @@ namespace Luau
 namespace Unifiable
 {
 
-static int nextIndex = 0;
+// types can be created by several threads when modules are typechecked in parallel
+static std::atomic<int> nextIndex{0};
 
 Free::Free(TypeLevel level)
     : index(++nextIndex)
@@ -78,7 +79,7 @@ Error::Error()
 {
 }
 
-int Error::nextIndex = 0;
+std::atomic<int> Error::nextIndex{0};
 
 } // namespace Unifiable
 } // namespace Luau
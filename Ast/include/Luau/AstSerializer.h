@@ -0,0 +1,24 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#pragma once
+
+#include "Luau/Lexer.h"
+#include "Luau/ParseResult.h"
+
+#include <optional>
+#include <string>
+
+namespace Luau
+{
+
+// Encodes the result of a parse in a compact binary format that can be cached between runs and decoded much faster than the source is parsed.
+// The data includes a hash of the source it was parsed from, so that a stale cache is rejected when it's decoded. Results with skipped function
+// bodies can't be encoded.
+std::string serializeParseResult(const ParseResult& result, const char* source, size_t sourceSize);
+
+// Decodes a parse result encoded by serializeParseResult; the tree is allocated in the allocator and the names are added to the name table.
+// Returns std::nullopt if the data is corrupted, was encoded by a different version or was encoded for a different source; trees that are
+// nested deeper than the parser's recursion limit allows are rejected as corrupted.
+std::optional<ParseResult> deserializeParseResult(
+    const char* data, size_t dataSize, const char* source, size_t sourceSize, AstNameTable& names, Allocator& allocator);
+
+} // namespace Luau
@@ -6,6 +6,7 @@
 #include "Luau/DenseHash.h"
 #include "Luau/Common.h"
 
+#include <mutex>
 #include <vector>
 
 namespace Luau
@@ -141,6 +142,10 @@ class AstNameTable
 public:
     AstNameTable(Allocator& allocator);
 
+    // Creates a table that adds new names to the shared table, locking the mutex while the shared table is accessed; all tables that share
+    // a table produce the same AstName for the same string, so multiple threads can parse sources with names that compare across sources
+    AstNameTable(Allocator& allocator, AstNameTable& shared, std::mutex& sharedMutex);
+
     AstName addStatic(const char* name, Lexeme::Type type = Lexeme::Name);
 
     std::pair<AstName, Lexeme::Type> getOrAddWithType(const char* name, size_t length);
@@ -167,6 +172,9 @@ private:
     DenseHashSet<Entry, EntryHash> data;
 
     Allocator& allocator;
+
+    AstNameTable* shared = nullptr;
+    std::mutex* sharedMutex = nullptr;
 };
 
 class Lexer
@@ -186,6 +194,9 @@ public:
     const Lexeme& next(bool skipComments, bool updatePrevLocation);
     void nextline();
 
+    // Restarts lexing at the specified position, which must be at a lexeme boundary outside of strings, comments and interpolated expressions
+    void seek(const Position& position);
+
     Lexeme lookahead();
 
     const Lexeme& current() const
@@ -18,6 +18,10 @@ struct ParseOptions
     bool supportContinueStatement = true;
     bool allowDeclarationSyntax = false;
     bool captureComments = false;
+
+    // function bodies are skipped with a scan that balances keywords and brackets instead of being parsed; they are recorded in
+    // ParseResult::skippedFunctions and can be parsed on demand with Parser::parseSkippedFunction
+    bool skipFunctionBodies = false;
 };
 
 } // namespace Luau
@@ -10,6 +10,8 @@ namespace Luau
 {
 
 class AstStatBlock;
+class AstExprFunction;
+class AstLocal;
 
 class ParseError : public std::exception
 {
@@ -55,6 +57,15 @@ struct Comment
     Location location;
 };
 
+// A function that has an empty body because ParseOptions::skipFunctionBodies was set
+struct SkippedFunction
+{
+    AstExprFunction* function;
+
+    // locals that are visible at the start of the function body (including its arguments), in declaration order
+    AstArray<AstLocal*> scope;
+};
+
 struct ParseResult
 {
     AstStatBlock* root;
@@ -64,6 +75,8 @@ struct ParseResult
     std::vector<ParseError> errors;
 
     std::vector<Comment> commentLocations;
+
+    std::vector<SkippedFunction> skippedFunctions;
 };
 
 static constexpr const char* kParseNameError = "%error-id%";
@@ -10,7 +10,9 @@
 #include "Luau/Common.h"
 
 #include <initializer_list>
+#include <memory>
 #include <optional>
+#include <string_view>
 #include <tuple>
 
 namespace Luau
@@ -51,12 +53,46 @@ private:
     size_t size_;
 };
 
+// Text in [begin, oldEnd) of the previously parsed source was replaced with text that spans [begin, newEnd) in the new source
+struct ParseEdit
+{
+    Position begin;
+    Position oldEnd;
+    Position newEnd;
+};
+
+// A source parsed by Parser::parseBatch with the allocator that owns its tree; the name table is null when the names are in a shared table
+struct BatchParseResult
+{
+    std::unique_ptr<Allocator> allocator;
+    std::unique_ptr<AstNameTable> names;
+
+    ParseResult result;
+};
+
 class Parser
 {
 public:
     static ParseResult parse(
         const char* buffer, std::size_t bufferSize, AstNameTable& names, Allocator& allocator, ParseOptions options = ParseOptions());
 
+    // Parses the source after an edit, reusing the tree of the previous parse; only the statements of the innermost block enclosing the edit are
+    // parsed again. The previous tree is updated in place, so it must have been produced with the same name table, allocator and options.
+    // Falls back to a full parse when the previous result had errors or when the edited statements can't be parsed in isolation.
+    static ParseResult reparse(const char* buffer, std::size_t bufferSize, ParseResult& previous, const ParseEdit& edit, AstNameTable& names,
+        Allocator& allocator, ParseOptions options = ParseOptions());
+
+    // Parses the body of a function that was skipped with ParseOptions::skipFunctionBodies and stores it in the function. Parse errors are
+    // appended to the result; when options skip function bodies as well, the bodies of nested functions are appended to the skipped list.
+    static void parseSkippedFunction(const char* buffer, std::size_t bufferSize, ParseResult& result, SkippedFunction skipped,
+        AstNameTable& names, Allocator& allocator, ParseOptions options = ParseOptions());
+
+    // Parses each source with its own allocator using up to the specified number of threads; the results are in the order of the sources.
+    // When a shared name table is provided, the names of all sources are added to it, so that names can be compared across sources;
+    // otherwise each source gets its own name table. The shared table must not be used by other threads until the batch is parsed.
+    static std::vector<BatchParseResult> parseBatch(const std::vector<std::string_view>& sources, unsigned int threads,
+        AstNameTable* sharedNames = nullptr, ParseOptions options = ParseOptions());
+
 private:
     struct Name;
     struct Binding;
@@ -73,6 +109,13 @@ private:
 
     AstStatBlock* parseBlockNoScope();
 
+    // skips a function body without parsing it; returns an empty block that spans the body
+    AstStatBlock* skipFunctionBody();
+
+    std::optional<ParseResult> reparseBlock(const char* buffer, std::size_t bufferSize, ParseResult& previous, const ParseEdit& edit);
+
+    void bindLocal(AstLocal* local);
+
     // stat ::=
     // varlist `=' explist |
     // functioncall |
@@ -390,6 +433,8 @@ private:
 
     std::vector<ParseError> parseErrors;
 
+    std::vector<SkippedFunction> skippedFunctions;
+
     std::vector<unsigned int> matchRecoveryStopOnToken;
 
     std::vector<AstStat*> scratchStat;
@@ -409,6 +454,7 @@ private:
     std::vector<AstGenericType> scratchGenericTypes;
     std::vector<AstGenericTypePack> scratchGenericTypePacks;
     std::vector<std::optional<AstArgumentName>> scratchOptArgName;
+    std::vector<Lexeme::Type> scratchSkip;
     std::string scratchData;
 };
 
@@ -0,0 +1,1651 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#include "Luau/AstSerializer.h"
+
+#include "Luau/Ast.h"
+#include "Luau/DenseHash.h"
+#include "Luau/TimeTrace.h"
+
+#include <string.h>
+
+LUAU_FASTINT(LuauRecursionLimit)
+
+namespace Luau
+{
+
+// The encoding isn't compatible between versions; any change to the format or to the AST classes requires a new version
+static const char kSerializedMagic[4] = {'L', 'A', 'S', 'T'};
+static const uint8_t kSerializedVersion = 1;
+
+// magic, version, source size and source hash
+static const size_t kSerializedHeaderSize = 4 + 1 + 8 + 8;
+
+// hash of everything before it
+static const size_t kSerializedTrailerSize = 8;
+
+// the parser limits its recursion depth and produces at most a few nested nodes per level, e.g. function, block and statement
+static const int kSerializedNodesPerRecursionLevel = 4;
+
+enum class SerializedNode : uint8_t
+{
+    Null,
+
+    ExprGroup,
+    ExprConstantNil,
+    ExprConstantBool,
+    ExprConstantNumber,
+    ExprConstantString,
+    ExprLocal,
+    ExprGlobal,
+    ExprVarargs,
+    ExprCall,
+    ExprIndexName,
+    ExprIndexExpr,
+    ExprFunction,
+    ExprTable,
+    ExprUnary,
+    ExprBinary,
+    ExprTypeAssertion,
+    ExprIfElse,
+    ExprInterpString,
+    ExprError,
+
+    StatBlock,
+    StatIf,
+    StatWhile,
+    StatRepeat,
+    StatBreak,
+    StatContinue,
+    StatReturn,
+    StatExpr,
+    StatLocal,
+    StatFor,
+    StatForIn,
+    StatAssign,
+    StatCompoundAssign,
+    StatFunction,
+    StatLocalFunction,
+    StatTypeAlias,
+    StatDeclareGlobal,
+    StatDeclareFunction,
+    StatDeclareClass,
+    StatError,
+
+    TypeReference,
+    TypeTable,
+    TypeFunction,
+    TypeTypeof,
+    TypeUnion,
+    TypeIntersection,
+    TypeSingletonBool,
+    TypeSingletonString,
+    TypeError,
+
+    TypePackExplicit,
+    TypePackVariadic,
+    TypePackGeneric,
+
+    Count
+};
+
+// FNV-1a applied to 8-byte words; the data is only hashed to detect changes, so this trades some hash quality for speed
+static uint64_t hashData(const char* data, size_t size)
+{
+    uint64_t hash = 14695981039346656037ull ^ size;
+
+    size_t i = 0;
+
+    for (; i + 8 <= size; i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+
+        hash ^= word;
+        hash *= 1099511628211ull;
+    }
+
+    for (; i < size; ++i)
+    {
+        hash ^= uint8_t(data[i]);
+        hash *= 1099511628211ull;
+    }
+
+    return hash ^ (hash >> 32);
+}
+
+static void writeFixed(std::string& out, uint64_t value)
+{
+    for (int i = 0; i < 8; ++i)
+        out.push_back(char(uint8_t(value >> (i * 8))));
+}
+
+static uint64_t readFixed(const char* data)
+{
+    uint64_t result = 0;
+
+    for (int i = 0; i < 8; ++i)
+        result |= uint64_t(uint8_t(data[i])) << (i * 8);
+
+    return result;
+}
+
+struct AstSerializer
+{
+    std::string& out;
+
+    DenseHashMap<const char*, uint32_t> names{nullptr};
+    DenseHashMap<AstLocal*, uint32_t> locals{nullptr};
+
+    // positions are encoded relative to the beginning of the last location
+    Position position{0, 0};
+
+    explicit AstSerializer(std::string& out)
+        : out(out)
+    {
+    }
+
+    void writeByte(uint8_t value)
+    {
+        out.push_back(char(value));
+    }
+
+    void writeBool(bool value)
+    {
+        out.push_back(char(value));
+    }
+
+    void writeVarInt(uint64_t value)
+    {
+        do
+        {
+            uint8_t byte = value & 127;
+            value >>= 7;
+
+            out.push_back(char(byte | (value ? 128 : 0)));
+        } while (value);
+    }
+
+    void writeSigned(int64_t value)
+    {
+        writeVarInt((uint64_t(value) << 1) ^ uint64_t(value >> 63));
+    }
+
+    void writeDouble(double value)
+    {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+
+        writeFixed(out, bits);
+    }
+
+    void writeString(const char* data, size_t size)
+    {
+        writeVarInt(size);
+        out.append(data, size);
+    }
+
+    void writeLocation(const Location& location)
+    {
+        writeSigned(int64_t(location.begin.line) - int64_t(position.line));
+        writeVarInt(location.begin.column);
+        writeVarInt(location.end.line - location.begin.line);
+        writeVarInt(location.end.column);
+
+        position = location.begin;
+    }
+
+    void writeLocation(const std::optional<Location>& location)
+    {
+        writeBool(location.has_value());
+
+        if (location)
+            writeLocation(*location);
+    }
+
+    // names and locals are encoded by their index; the first occurrence is followed by the definition
+    void writeName(const AstName& name)
+    {
+        if (!name.value)
+        {
+            writeVarInt(0);
+            return;
+        }
+
+        if (const uint32_t* index = names.find(name.value))
+        {
+            writeVarInt(*index + 1);
+            return;
+        }
+
+        uint32_t index = uint32_t(names.size());
+        names[name.value] = index;
+
+        writeVarInt(index + 1);
+        writeString(name.value, strlen(name.value));
+    }
+
+    void writeName(const std::optional<AstName>& name)
+    {
+        writeBool(name.has_value());
+
+        if (name)
+            writeName(*name);
+    }
+
+    void writeLocal(AstLocal* local)
+    {
+        if (!local)
+        {
+            writeVarInt(0);
+            return;
+        }
+
+        if (const uint32_t* index = locals.find(local))
+        {
+            writeVarInt(*index + 1);
+            return;
+        }
+
+        uint32_t index = uint32_t(locals.size());
+        locals[local] = index;
+
+        writeVarInt(index + 1);
+        writeName(local->name);
+        writeLocation(local->location);
+        writeLocal(local->shadow);
+        writeVarInt(local->functionDepth);
+        writeVarInt(local->loopDepth);
+        writeNode(local->annotation);
+    }
+
+    void writeLocals(const AstArray<AstLocal*>& array)
+    {
+        writeVarInt(array.size);
+
+        for (AstLocal* local : array)
+            writeLocal(local);
+    }
+
+    template<typename T>
+    void writeNodes(const AstArray<T*>& array)
+    {
+        writeVarInt(array.size);
+
+        for (T* node : array)
+            writeNode(node);
+    }
+
+    void writeTypeList(const AstTypeList& list)
+    {
+        writeNodes(list.types);
+        writeNode(list.tailType);
+    }
+
+    void writeGenerics(const AstArray<AstGenericType>& generics, const AstArray<AstGenericTypePack>& genericPacks)
+    {
+        writeVarInt(generics.size);
+
+        for (const AstGenericType& generic : generics)
+        {
+            writeName(generic.name);
+            writeLocation(generic.location);
+            writeNode(generic.defaultValue);
+        }
+
+        writeVarInt(genericPacks.size);
+
+        for (const AstGenericTypePack& generic : genericPacks)
+        {
+            writeName(generic.name);
+            writeLocation(generic.location);
+            writeNode(generic.defaultValue);
+        }
+    }
+
+    void writeHeader(SerializedNode tag, AstNode* node)
+    {
+        writeByte(uint8_t(tag));
+        writeLocation(node->location);
+    }
+
+    void writeHeader(SerializedNode tag, AstStat* node)
+    {
+        writeByte(uint8_t(tag));
+        writeLocation(node->location);
+        writeBool(node->hasSemicolon);
+    }
+
+    void writeNode(AstNode* node)
+    {
+        if (!node)
+        {
+            writeByte(uint8_t(SerializedNode::Null));
+        }
+        else if (AstExprGroup* expr = node->as<AstExprGroup>())
+        {
+            writeHeader(SerializedNode::ExprGroup, expr);
+            writeNode(expr->expr);
+        }
+        else if (AstExprConstantNil* expr = node->as<AstExprConstantNil>())
+        {
+            writeHeader(SerializedNode::ExprConstantNil, expr);
+        }
+        else if (AstExprConstantBool* expr = node->as<AstExprConstantBool>())
+        {
+            writeHeader(SerializedNode::ExprConstantBool, expr);
+            writeBool(expr->value);
+        }
+        else if (AstExprConstantNumber* expr = node->as<AstExprConstantNumber>())
+        {
+            writeHeader(SerializedNode::ExprConstantNumber, expr);
+            writeDouble(expr->value);
+            writeByte(uint8_t(expr->parseResult));
+        }
+        else if (AstExprConstantString* expr = node->as<AstExprConstantString>())
+        {
+            writeHeader(SerializedNode::ExprConstantString, expr);
+            writeString(expr->value.data, expr->value.size);
+        }
+        else if (AstExprLocal* expr = node->as<AstExprLocal>())
+        {
+            writeHeader(SerializedNode::ExprLocal, expr);
+            writeLocal(expr->local);
+            writeBool(expr->upvalue);
+        }
+        else if (AstExprGlobal* expr = node->as<AstExprGlobal>())
+        {
+            writeHeader(SerializedNode::ExprGlobal, expr);
+            writeName(expr->name);
+        }
+        else if (AstExprVarargs* expr = node->as<AstExprVarargs>())
+        {
+            writeHeader(SerializedNode::ExprVarargs, expr);
+        }
+        else if (AstExprCall* expr = node->as<AstExprCall>())
+        {
+            writeHeader(SerializedNode::ExprCall, expr);
+            writeNode(expr->func);
+            writeNodes(expr->args);
+            writeBool(expr->self);
+            writeLocation(expr->argLocation);
+        }
+        else if (AstExprIndexName* expr = node->as<AstExprIndexName>())
+        {
+            writeHeader(SerializedNode::ExprIndexName, expr);
+            writeNode(expr->expr);
+            writeName(expr->index);
+            writeLocation(expr->indexLocation);
+            writeLocation(Location(expr->opPosition, expr->opPosition));
+            writeByte(uint8_t(expr->op));
+        }
+        else if (AstExprIndexExpr* expr = node->as<AstExprIndexExpr>())
+        {
+            writeHeader(SerializedNode::ExprIndexExpr, expr);
+            writeNode(expr->expr);
+            writeNode(expr->index);
+        }
+        else if (AstExprFunction* expr = node->as<AstExprFunction>())
+        {
+            writeHeader(SerializedNode::ExprFunction, expr);
+            writeGenerics(expr->generics, expr->genericPacks);
+            writeLocal(expr->self);
+            writeLocals(expr->args);
+            writeBool(expr->returnAnnotation.has_value());
+            if (expr->returnAnnotation)
+                writeTypeList(*expr->returnAnnotation);
+            writeBool(expr->vararg);
+            writeLocation(expr->varargLocation);
+            writeNode(expr->varargAnnotation);
+            writeNode(expr->body);
+            writeVarInt(expr->functionDepth);
+            writeName(expr->debugname);
+            writeBool(expr->hasEnd);
+            writeLocation(expr->argLocation);
+        }
+        else if (AstExprTable* expr = node->as<AstExprTable>())
+        {
+            writeHeader(SerializedNode::ExprTable, expr);
+            writeVarInt(expr->items.size);
+
+            for (const AstExprTable::Item& item : expr->items)
+            {
+                writeByte(uint8_t(item.kind));
+                writeNode(item.key);
+                writeNode(item.value);
+            }
+        }
+        else if (AstExprUnary* expr = node->as<AstExprUnary>())
+        {
+            writeHeader(SerializedNode::ExprUnary, expr);
+            writeByte(uint8_t(expr->op));
+            writeNode(expr->expr);
+        }
+        else if (AstExprBinary* expr = node->as<AstExprBinary>())
+        {
+            writeHeader(SerializedNode::ExprBinary, expr);
+            writeByte(uint8_t(expr->op));
+            writeNode(expr->left);
+            writeNode(expr->right);
+        }
+        else if (AstExprTypeAssertion* expr = node->as<AstExprTypeAssertion>())
+        {
+            writeHeader(SerializedNode::ExprTypeAssertion, expr);
+            writeNode(expr->expr);
+            writeNode(expr->annotation);
+        }
+        else if (AstExprIfElse* expr = node->as<AstExprIfElse>())
+        {
+            writeHeader(SerializedNode::ExprIfElse, expr);
+            writeNode(expr->condition);
+            writeBool(expr->hasThen);
+            writeNode(expr->trueExpr);
+            writeBool(expr->hasElse);
+            writeNode(expr->falseExpr);
+        }
+        else if (AstExprInterpString* expr = node->as<AstExprInterpString>())
+        {
+            writeHeader(SerializedNode::ExprInterpString, expr);
+            writeVarInt(expr->strings.size);
+
+            for (const AstArray<char>& string : expr->strings)
+                writeString(string.data, string.size);
+
+            writeNodes(expr->expressions);
+        }
+        else if (AstExprError* expr = node->as<AstExprError>())
+        {
+            writeHeader(SerializedNode::ExprError, expr);
+            writeNodes(expr->expressions);
+            writeVarInt(expr->messageIndex);
+        }
+        else if (AstStatBlock* stat = node->as<AstStatBlock>())
+        {
+            writeHeader(SerializedNode::StatBlock, stat);
+            writeNodes(stat->body);
+        }
+        else if (AstStatIf* stat = node->as<AstStatIf>())
+        {
+            writeHeader(SerializedNode::StatIf, stat);
+            writeNode(stat->condition);
+            writeNode(stat->thenbody);
+            writeNode(stat->elsebody);
+            writeLocation(stat->thenLocation);
+            writeLocation(stat->elseLocation);
+            writeBool(stat->hasEnd);
+        }
+        else if (AstStatWhile* stat = node->as<AstStatWhile>())
+        {
+            writeHeader(SerializedNode::StatWhile, stat);
+            writeNode(stat->condition);
+            writeNode(stat->body);
+            writeBool(stat->hasDo);
+            writeLocation(stat->doLocation);
+            writeBool(stat->hasEnd);
+        }
+        else if (AstStatRepeat* stat = node->as<AstStatRepeat>())
+        {
+            writeHeader(SerializedNode::StatRepeat, stat);
+            writeNode(stat->condition);
+            writeNode(stat->body);
+            writeBool(stat->hasUntil);
+        }
+        else if (AstStatBreak* stat = node->as<AstStatBreak>())
+        {
+            writeHeader(SerializedNode::StatBreak, stat);
+        }
+        else if (AstStatContinue* stat = node->as<AstStatContinue>())
+        {
+            writeHeader(SerializedNode::StatContinue, stat);
+        }
+        else if (AstStatReturn* stat = node->as<AstStatReturn>())
+        {
+            writeHeader(SerializedNode::StatReturn, stat);
+            writeNodes(stat->list);
+        }
+        else if (AstStatExpr* stat = node->as<AstStatExpr>())
+        {
+            writeHeader(SerializedNode::StatExpr, stat);
+            writeNode(stat->expr);
+        }
+        else if (AstStatLocal* stat = node->as<AstStatLocal>())
+        {
+            writeHeader(SerializedNode::StatLocal, stat);
+            writeLocals(stat->vars);
+            writeNodes(stat->values);
+            writeLocation(stat->equalsSignLocation);
+        }
+        else if (AstStatFor* stat = node->as<AstStatFor>())
+        {
+            writeHeader(SerializedNode::StatFor, stat);
+            writeLocal(stat->var);
+            writeNode(stat->from);
+            writeNode(stat->to);
+            writeNode(stat->step);
+            writeNode(stat->body);
+            writeBool(stat->hasDo);
+            writeLocation(stat->doLocation);
+            writeBool(stat->hasEnd);
+        }
+        else if (AstStatForIn* stat = node->as<AstStatForIn>())
+        {
+            writeHeader(SerializedNode::StatForIn, stat);
+            writeLocals(stat->vars);
+            writeNodes(stat->values);
+            writeNode(stat->body);
+            writeBool(stat->hasIn);
+            writeLocation(stat->inLocation);
+            writeBool(stat->hasDo);
+            writeLocation(stat->doLocation);
+            writeBool(stat->hasEnd);
+        }
+        else if (AstStatAssign* stat = node->as<AstStatAssign>())
+        {
+            writeHeader(SerializedNode::StatAssign, stat);
+            writeNodes(stat->vars);
+            writeNodes(stat->values);
+        }
+        else if (AstStatCompoundAssign* stat = node->as<AstStatCompoundAssign>())
+        {
+            writeHeader(SerializedNode::StatCompoundAssign, stat);
+            writeByte(uint8_t(stat->op));
+            writeNode(stat->var);
+            writeNode(stat->value);
+        }
+        else if (AstStatFunction* stat = node->as<AstStatFunction>())
+        {
+            writeHeader(SerializedNode::StatFunction, stat);
+            writeNode(stat->name);
+            writeNode(stat->func);
+        }
+        else if (AstStatLocalFunction* stat = node->as<AstStatLocalFunction>())
+        {
+            writeHeader(SerializedNode::StatLocalFunction, stat);
+            writeLocal(stat->name);
+            writeNode(stat->func);
+        }
+        else if (AstStatTypeAlias* stat = node->as<AstStatTypeAlias>())
+        {
+            writeHeader(SerializedNode::StatTypeAlias, stat);
+            writeName(stat->name);
+            writeLocation(stat->nameLocation);
+            writeGenerics(stat->generics, stat->genericPacks);
+            writeNode(stat->type);
+            writeBool(stat->exported);
+        }
+        else if (AstStatDeclareGlobal* stat = node->as<AstStatDeclareGlobal>())
+        {
+            writeHeader(SerializedNode::StatDeclareGlobal, stat);
+            writeName(stat->name);
+            writeNode(stat->type);
+        }
+        else if (AstStatDeclareFunction* stat = node->as<AstStatDeclareFunction>())
+        {
+            writeHeader(SerializedNode::StatDeclareFunction, stat);
+            writeName(stat->name);
+            writeGenerics(stat->generics, stat->genericPacks);
+            writeTypeList(stat->params);
+            writeVarInt(stat->paramNames.size);
+
+            for (const AstArgumentName& name : stat->paramNames)
+            {
+                writeName(name.first);
+                writeLocation(name.second);
+            }
+
+            writeTypeList(stat->retTypes);
+        }
+        else if (AstStatDeclareClass* stat = node->as<AstStatDeclareClass>())
+        {
+            writeHeader(SerializedNode::StatDeclareClass, stat);
+            writeName(stat->name);
+            writeName(stat->superName);
+            writeVarInt(stat->props.size);
+
+            for (const AstDeclaredClassProp& prop : stat->props)
+            {
+                writeName(prop.name);
+                writeNode(prop.ty);
+                writeBool(prop.isMethod);
+            }
+        }
+        else if (AstStatError* stat = node->as<AstStatError>())
+        {
+            writeHeader(SerializedNode::StatError, stat);
+            writeNodes(stat->expressions);
+            writeNodes(stat->statements);
+            writeVarInt(stat->messageIndex);
+        }
+        else if (AstTypeReference* type = node->as<AstTypeReference>())
+        {
+            writeHeader(SerializedNode::TypeReference, type);
+            writeBool(type->hasParameterList);
+            writeName(type->prefix);
+            writeName(type->name);
+            writeVarInt(type->parameters.size);
+
+            for (const AstTypeOrPack& parameter : type->parameters)
+            {
+                writeNode(parameter.type);
+                writeNode(parameter.typePack);
+            }
+        }
+        else if (AstTypeTable* type = node->as<AstTypeTable>())
+        {
+            writeHeader(SerializedNode::TypeTable, type);
+            writeVarInt(type->props.size);
+
+            for (const AstTableProp& prop : type->props)
+            {
+                writeName(prop.name);
+                writeLocation(prop.location);
+                writeNode(prop.type);
+            }
+
+            writeBool(type->indexer != nullptr);
+
+            if (type->indexer)
+            {
+                writeNode(type->indexer->indexType);
+                writeNode(type->indexer->resultType);
+                writeLocation(type->indexer->location);
+            }
+        }
+        else if (AstTypeFunction* type = node->as<AstTypeFunction>())
+        {
+            writeHeader(SerializedNode::TypeFunction, type);
+            writeGenerics(type->generics, type->genericPacks);
+            writeTypeList(type->argTypes);
+            writeVarInt(type->argNames.size);
+
+            for (const std::optional<AstArgumentName>& name : type->argNames)
+            {
+                writeBool(name.has_value());
+
+                if (name)
+                {
+                    writeName(name->first);
+                    writeLocation(name->second);
+                }
+            }
+
+            writeTypeList(type->returnTypes);
+        }
+        else if (AstTypeTypeof* type = node->as<AstTypeTypeof>())
+        {
+            writeHeader(SerializedNode::TypeTypeof, type);
+            writeNode(type->expr);
+        }
+        else if (AstTypeUnion* type = node->as<AstTypeUnion>())
+        {
+            writeHeader(SerializedNode::TypeUnion, type);
+            writeNodes(type->types);
+        }
+        else if (AstTypeIntersection* type = node->as<AstTypeIntersection>())
+        {
+            writeHeader(SerializedNode::TypeIntersection, type);
+            writeNodes(type->types);
+        }
+        else if (AstTypeSingletonBool* type = node->as<AstTypeSingletonBool>())
+        {
+            writeHeader(SerializedNode::TypeSingletonBool, type);
+            writeBool(type->value);
+        }
+        else if (AstTypeSingletonString* type = node->as<AstTypeSingletonString>())
+        {
+            writeHeader(SerializedNode::TypeSingletonString, type);
+            writeString(type->value.data, type->value.size);
+        }
+        else if (AstTypeError* type = node->as<AstTypeError>())
+        {
+            writeHeader(SerializedNode::TypeError, type);
+            writeNodes(type->types);
+            writeBool(type->isMissing);
+            writeVarInt(type->messageIndex);
+        }
+        else if (AstTypePackExplicit* pack = node->as<AstTypePackExplicit>())
+        {
+            writeHeader(SerializedNode::TypePackExplicit, pack);
+            writeTypeList(pack->typeList);
+        }
+        else if (AstTypePackVariadic* pack = node->as<AstTypePackVariadic>())
+        {
+            writeHeader(SerializedNode::TypePackVariadic, pack);
+            writeNode(pack->variadicType);
+        }
+        else if (AstTypePackGeneric* pack = node->as<AstTypePackGeneric>())
+        {
+            writeHeader(SerializedNode::TypePackGeneric, pack);
+            writeName(pack->genericName);
+        }
+        else
+        {
+            LUAU_ASSERT(!"Unknown AST node type");
+        }
+    }
+};
+
+struct AstDeserializer
+{
+    const char* data;
+    size_t size;
+    size_t offset = 0;
+
+    // the data is checked with a hash before decoding, so this is only expected to happen when the format doesn't match
+    bool failed = false;
+
+    AstNameTable& names;
+    Allocator& allocator;
+
+    std::vector<AstName> nameList;
+    std::vector<AstLocal*> localList;
+
+    Position position{0, 0};
+
+    // decoding recurses once per nested node, so the data can't be nested deeper than a parse result could be
+    unsigned int recursionCounter = 0;
+    unsigned int recursionLimit = 0;
+
+    AstDeserializer(const char* data, size_t size, AstNameTable& names, Allocator& allocator)
+        : data(data)
+        , size(size)
+        , names(names)
+        , allocator(allocator)
+    {
+    }
+
+    uint8_t readByte()
+    {
+        if (offset >= size)
+        {
+            failed = true;
+            return 0;
+        }
+
+        return uint8_t(data[offset++]);
+    }
+
+    bool readBool()
+    {
+        return readByte() != 0;
+    }
+
+    uint64_t readVarInt()
+    {
+        uint64_t result = 0;
+
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            uint8_t byte = readByte();
+            result |= uint64_t(byte & 127) << shift;
+
+            if (!(byte & 128))
+                return result;
+        }
+
+        failed = true;
+        return 0;
+    }
+
+    int64_t readSigned()
+    {
+        uint64_t value = readVarInt();
+        return int64_t(value >> 1) ^ -int64_t(value & 1);
+    }
+
+    unsigned int readUnsigned()
+    {
+        return unsigned(readVarInt());
+    }
+
+    double readDouble()
+    {
+        if (size - offset < 8)
+        {
+            failed = true;
+            return 0;
+        }
+
+        uint64_t bits = readFixed(data + offset);
+        offset += 8;
+
+        double result;
+        memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+    // element counts are checked against the remaining size, since every element takes at least one byte
+    size_t readCount()
+    {
+        uint64_t count = readVarInt();
+
+        if (count > size - offset)
+        {
+            failed = true;
+            return 0;
+        }
+
+        return size_t(count);
+    }
+
+    template<typename T>
+    AstArray<T> allocateArray(size_t count)
+    {
+        AstArray<T> result;
+        result.data = count ? static_cast<T*>(allocator.allocate(sizeof(T) * count)) : nullptr;
+        result.size = count;
+        return result;
+    }
+
+    AstArray<char> readString()
+    {
+        size_t length = readCount();
+
+        AstArray<char> result = allocateArray<char>(length);
+
+        if (length)
+        {
+            memcpy(result.data, data + offset, length);
+            offset += length;
+        }
+
+        return result;
+    }
+
+    Location readLocation()
+    {
+        Location result;
+        result.begin.line = unsigned(int64_t(position.line) + readSigned());
+        result.begin.column = readUnsigned();
+        result.end.line = result.begin.line + readUnsigned();
+        result.end.column = readUnsigned();
+
+        position = result.begin;
+
+        return result;
+    }
+
+    std::optional<Location> readOptionalLocation()
+    {
+        if (!readBool())
+            return std::nullopt;
+
+        return readLocation();
+    }
+
+    AstName readName()
+    {
+        uint64_t index = readVarInt();
+
+        if (index == 0)
+            return AstName();
+
+        if (index <= nameList.size())
+            return nameList[index - 1];
+
+        if (index != nameList.size() + 1)
+        {
+            failed = true;
+            return AstName();
+        }
+
+        size_t length = readCount();
+
+        AstName name = names.getOrAddWithType(data + offset, length).first;
+        offset += length;
+
+        nameList.push_back(name);
+        return name;
+    }
+
+    std::optional<AstName> readOptionalName()
+    {
+        if (!readBool())
+            return std::nullopt;
+
+        return readName();
+    }
+
+    AstLocal* readLocal()
+    {
+        uint64_t index = readVarInt();
+
+        if (index == 0)
+            return nullptr;
+
+        if (index <= localList.size())
+            return localList[index - 1];
+
+        if (index != localList.size() + 1)
+        {
+            failed = true;
+            return nullptr;
+        }
+
+        // the slot is reserved before the definition is read, since the annotation can declare locals of its own
+        localList.push_back(nullptr);
+
+        AstName name = readName();
+        Location location = readLocation();
+        AstLocal* shadow = readLocal();
+        size_t functionDepth = size_t(readVarInt());
+        size_t loopDepth = size_t(readVarInt());
+        AstType* annotation = readType();
+
+        AstLocal* local = allocator.alloc<AstLocal>(name, location, shadow, functionDepth, loopDepth, annotation);
+        localList[index - 1] = local;
+
+        return local;
+    }
+
+    AstArray<AstLocal*> readLocals()
+    {
+        AstArray<AstLocal*> result = allocateArray<AstLocal*>(readCount());
+
+        for (size_t i = 0; i < result.size; ++i)
+            result.data[i] = readLocal();
+
+        return result;
+    }
+
+    template<typename T>
+    T* readNodeAs()
+    {
+        AstNode* node = readNode();
+
+        if (!node)
+            return nullptr;
+
+        if (T* result = node->as<T>())
+            return result;
+
+        failed = true;
+        return nullptr;
+    }
+
+    AstExpr* readExpr()
+    {
+        AstNode* node = readNode();
+
+        if (node && !node->asExpr())
+        {
+            failed = true;
+            return nullptr;
+        }
+
+        return static_cast<AstExpr*>(node);
+    }
+
+    AstStat* readStat()
+    {
+        AstNode* node = readNode();
+
+        if (node && !node->asStat())
+        {
+            failed = true;
+            return nullptr;
+        }
+
+        return static_cast<AstStat*>(node);
+    }
+
+    AstType* readType()
+    {
+        AstNode* node = readNode();
+
+        if (node && !node->asType())
+        {
+            failed = true;
+            return nullptr;
+        }
+
+        return static_cast<AstType*>(node);
+    }
+
+    AstTypePack* readTypePack()
+    {
+        AstNode* node = readNode();
+
+        if (node && !node->is<AstTypePackExplicit>() && !node->is<AstTypePackVariadic>() && !node->is<AstTypePackGeneric>())
+        {
+            failed = true;
+            return nullptr;
+        }
+
+        return static_cast<AstTypePack*>(node);
+    }
+
+    AstArray<AstExpr*> readExprs()
+    {
+        AstArray<AstExpr*> result = allocateArray<AstExpr*>(readCount());
+
+        for (size_t i = 0; i < result.size; ++i)
+            result.data[i] = readExpr();
+
+        return result;
+    }
+
+    AstArray<AstStat*> readStats()
+    {
+        AstArray<AstStat*> result = allocateArray<AstStat*>(readCount());
+
+        for (size_t i = 0; i < result.size; ++i)
+            result.data[i] = readStat();
+
+        return result;
+    }
+
+    AstArray<AstType*> readTypes()
+    {
+        AstArray<AstType*> result = allocateArray<AstType*>(readCount());
+
+        for (size_t i = 0; i < result.size; ++i)
+            result.data[i] = readType();
+
+        return result;
+    }
+
+    AstTypeList readTypeList()
+    {
+        AstTypeList result;
+        result.types = readTypes();
+        result.tailType = readTypePack();
+        return result;
+    }
+
+    void readGenerics(AstArray<AstGenericType>& generics, AstArray<AstGenericTypePack>& genericPacks)
+    {
+        generics = allocateArray<AstGenericType>(readCount());
+
+        for (size_t i = 0; i < generics.size; ++i)
+        {
+            AstGenericType& generic = generics.data[i];
+            generic.name = readName();
+            generic.location = readLocation();
+            generic.defaultValue = readType();
+        }
+
+        genericPacks = allocateArray<AstGenericTypePack>(readCount());
+
+        for (size_t i = 0; i < genericPacks.size; ++i)
+        {
+            AstGenericTypePack& generic = genericPacks.data[i];
+            generic.name = readName();
+            generic.location = readLocation();
+            generic.defaultValue = readTypePack();
+        }
+    }
+
+    template<typename T, typename... Args>
+    T* stat(const Location& location, bool hasSemicolon, Args&&... args)
+    {
+        T* result = allocator.alloc<T>(location, std::forward<Args>(args)...);
+        result->hasSemicolon = hasSemicolon;
+        return result;
+    }
+
+    AstNode* readNode()
+    {
+        if (recursionCounter >= recursionLimit)
+        {
+            failed = true;
+            return nullptr;
+        }
+
+        recursionCounter++;
+        AstNode* result = readNodeImpl();
+        recursionCounter--;
+
+        return result;
+    }
+
+    AstNode* readNodeImpl()
+    {
+        uint8_t tag = readByte();
+
+        if (tag == uint8_t(SerializedNode::Null) || tag >= uint8_t(SerializedNode::Count) || failed)
+        {
+            failed |= tag >= uint8_t(SerializedNode::Count);
+            return nullptr;
+        }
+
+        Location location = readLocation();
+        bool hasSemicolon = tag >= uint8_t(SerializedNode::StatBlock) && tag <= uint8_t(SerializedNode::StatError) ? readBool() : false;
+
+        switch (SerializedNode(tag))
+        {
+        case SerializedNode::ExprGroup:
+            return allocator.alloc<AstExprGroup>(location, readExpr());
+
+        case SerializedNode::ExprConstantNil:
+            return allocator.alloc<AstExprConstantNil>(location);
+
+        case SerializedNode::ExprConstantBool:
+            return allocator.alloc<AstExprConstantBool>(location, readBool());
+
+        case SerializedNode::ExprConstantNumber:
+        {
+            double value = readDouble();
+            ConstantNumberParseResult parseResult = ConstantNumberParseResult(readByte());
+            return allocator.alloc<AstExprConstantNumber>(location, value, parseResult);
+        }
+
+        case SerializedNode::ExprConstantString:
+            return allocator.alloc<AstExprConstantString>(location, readString());
+
+        case SerializedNode::ExprLocal:
+        {
+            AstLocal* local = readLocal();
+            bool upvalue = readBool();
+            return allocator.alloc<AstExprLocal>(location, local, upvalue);
+        }
+
+        case SerializedNode::ExprGlobal:
+            return allocator.alloc<AstExprGlobal>(location, readName());
+
+        case SerializedNode::ExprVarargs:
+            return allocator.alloc<AstExprVarargs>(location);
+
+        case SerializedNode::ExprCall:
+        {
+            AstExpr* func = readExpr();
+            AstArray<AstExpr*> args = readExprs();
+            bool self = readBool();
+            Location argLocation = readLocation();
+            return allocator.alloc<AstExprCall>(location, func, args, self, argLocation);
+        }
+
+        case SerializedNode::ExprIndexName:
+        {
+            AstExpr* expr = readExpr();
+            AstName index = readName();
+            Location indexLocation = readLocation();
+            Position opPosition = readLocation().begin;
+            char op = char(readByte());
+            return allocator.alloc<AstExprIndexName>(location, expr, index, indexLocation, opPosition, op);
+        }
+
+        case SerializedNode::ExprIndexExpr:
+        {
+            AstExpr* expr = readExpr();
+            AstExpr* index = readExpr();
+            return allocator.alloc<AstExprIndexExpr>(location, expr, index);
+        }
+
+        case SerializedNode::ExprFunction:
+        {
+            AstArray<AstGenericType> generics;
+            AstArray<AstGenericTypePack> genericPacks;
+            readGenerics(generics, genericPacks);
+
+            AstLocal* self = readLocal();
+            AstArray<AstLocal*> args = readLocals();
+
+            std::optional<AstTypeList> returnAnnotation;
+            if (readBool())
+                returnAnnotation = readTypeList();
+
+            bool vararg = readBool();
+            Location varargLocation = readLocation();
+            AstTypePack* varargAnnotation = readTypePack();
+            AstStatBlock* body = readNodeAs<AstStatBlock>();
+            size_t functionDepth = size_t(readVarInt());
+            AstName debugname = readName();
+            bool hasEnd = readBool();
+            std::optional<Location> argLocation = readOptionalLocation();
+
+            return allocator.alloc<AstExprFunction>(location, generics, genericPacks, self, args, vararg, varargLocation, body, functionDepth,
+                debugname, returnAnnotation, varargAnnotation, hasEnd, argLocation);
+        }
+
+        case SerializedNode::ExprTable:
+        {
+            AstArray<AstExprTable::Item> items = allocateArray<AstExprTable::Item>(readCount());
+
+            for (size_t i = 0; i < items.size; ++i)
+            {
+                AstExprTable::Item& item = items.data[i];
+                item.kind = AstExprTable::Item::Kind(readByte());
+                item.key = readExpr();
+                item.value = readExpr();
+            }
+
+            return allocator.alloc<AstExprTable>(location, items);
+        }
+
+        case SerializedNode::ExprUnary:
+        {
+            AstExprUnary::Op op = AstExprUnary::Op(readByte());
+            return allocator.alloc<AstExprUnary>(location, op, readExpr());
+        }
+
+        case SerializedNode::ExprBinary:
+        {
+            AstExprBinary::Op op = AstExprBinary::Op(readByte());
+            AstExpr* left = readExpr();
+            AstExpr* right = readExpr();
+            return allocator.alloc<AstExprBinary>(location, op, left, right);
+        }
+
+        case SerializedNode::ExprTypeAssertion:
+        {
+            AstExpr* expr = readExpr();
+            AstType* annotation = readType();
+            return allocator.alloc<AstExprTypeAssertion>(location, expr, annotation);
+        }
+
+        case SerializedNode::ExprIfElse:
+        {
+            AstExpr* condition = readExpr();
+            bool hasThen = readBool();
+            AstExpr* trueExpr = readExpr();
+            bool hasElse = readBool();
+            AstExpr* falseExpr = readExpr();
+            return allocator.alloc<AstExprIfElse>(location, condition, hasThen, trueExpr, hasElse, falseExpr);
+        }
+
+        case SerializedNode::ExprInterpString:
+        {
+            AstArray<AstArray<char>> strings = allocateArray<AstArray<char>>(readCount());
+
+            for (size_t i = 0; i < strings.size; ++i)
+                strings.data[i] = readString();
+
+            AstArray<AstExpr*> expressions = readExprs();
+            return allocator.alloc<AstExprInterpString>(location, strings, expressions);
+        }
+
+        case SerializedNode::ExprError:
+        {
+            AstArray<AstExpr*> expressions = readExprs();
+            return allocator.alloc<AstExprError>(location, expressions, readUnsigned());
+        }
+
+        case SerializedNode::StatBlock:
+            return stat<AstStatBlock>(location, hasSemicolon, readStats());
+
+        case SerializedNode::StatIf:
+        {
+            AstExpr* condition = readExpr();
+            AstStatBlock* thenbody = readNodeAs<AstStatBlock>();
+            AstStat* elsebody = readStat();
+            std::optional<Location> thenLocation = readOptionalLocation();
+            std::optional<Location> elseLocation = readOptionalLocation();
+            bool hasEnd = readBool();
+            return stat<AstStatIf>(location, hasSemicolon, condition, thenbody, elsebody, thenLocation, elseLocation, hasEnd);
+        }
+
+        case SerializedNode::StatWhile:
+        {
+            AstExpr* condition = readExpr();
+            AstStatBlock* body = readNodeAs<AstStatBlock>();
+            bool hasDo = readBool();
+            Location doLocation = readLocation();
+            bool hasEnd = readBool();
+            return stat<AstStatWhile>(location, hasSemicolon, condition, body, hasDo, doLocation, hasEnd);
+        }
+
+        case SerializedNode::StatRepeat:
+        {
+            AstExpr* condition = readExpr();
+            AstStatBlock* body = readNodeAs<AstStatBlock>();
+            bool hasUntil = readBool();
+            return stat<AstStatRepeat>(location, hasSemicolon, condition, body, hasUntil);
+        }
+
+        case SerializedNode::StatBreak:
+            return stat<AstStatBreak>(location, hasSemicolon);
+
+        case SerializedNode::StatContinue:
+            return stat<AstStatContinue>(location, hasSemicolon);
+
+        case SerializedNode::StatReturn:
+            return stat<AstStatReturn>(location, hasSemicolon, readExprs());
+
+        case SerializedNode::StatExpr:
+            return stat<AstStatExpr>(location, hasSemicolon, readExpr());
+
+        case SerializedNode::StatLocal:
+        {
+            AstArray<AstLocal*> vars = readLocals();
+            AstArray<AstExpr*> values = readExprs();
+            std::optional<Location> equalsSignLocation = readOptionalLocation();
+            return stat<AstStatLocal>(location, hasSemicolon, vars, values, equalsSignLocation);
+        }
+
+        case SerializedNode::StatFor:
+        {
+            AstLocal* var = readLocal();
+            AstExpr* from = readExpr();
+            AstExpr* to = readExpr();
+            AstExpr* step = readExpr();
+            AstStatBlock* body = readNodeAs<AstStatBlock>();
+            bool hasDo = readBool();
+            Location doLocation = readLocation();
+            bool hasEnd = readBool();
+            return stat<AstStatFor>(location, hasSemicolon, var, from, to, step, body, hasDo, doLocation, hasEnd);
+        }
+
+        case SerializedNode::StatForIn:
+        {
+            AstArray<AstLocal*> vars = readLocals();
+            AstArray<AstExpr*> values = readExprs();
+            AstStatBlock* body = readNodeAs<AstStatBlock>();
+            bool hasIn = readBool();
+            Location inLocation = readLocation();
+            bool hasDo = readBool();
+            Location doLocation = readLocation();
+            bool hasEnd = readBool();
+            return stat<AstStatForIn>(location, hasSemicolon, vars, values, body, hasIn, inLocation, hasDo, doLocation, hasEnd);
+        }
+
+        case SerializedNode::StatAssign:
+        {
+            AstArray<AstExpr*> vars = readExprs();
+            AstArray<AstExpr*> values = readExprs();
+            return stat<AstStatAssign>(location, hasSemicolon, vars, values);
+        }
+
+        case SerializedNode::StatCompoundAssign:
+        {
+            AstExprBinary::Op op = AstExprBinary::Op(readByte());
+            AstExpr* var = readExpr();
+            AstExpr* value = readExpr();
+            return stat<AstStatCompoundAssign>(location, hasSemicolon, op, var, value);
+        }
+
+        case SerializedNode::StatFunction:
+        {
+            AstExpr* name = readExpr();
+            AstExprFunction* func = readNodeAs<AstExprFunction>();
+            return stat<AstStatFunction>(location, hasSemicolon, name, func);
+        }
+
+        case SerializedNode::StatLocalFunction:
+        {
+            AstLocal* name = readLocal();
+            AstExprFunction* func = readNodeAs<AstExprFunction>();
+            return stat<AstStatLocalFunction>(location, hasSemicolon, name, func);
+        }
+
+        case SerializedNode::StatTypeAlias:
+        {
+            AstName name = readName();
+            Location nameLocation = readLocation();
+
+            AstArray<AstGenericType> generics;
+            AstArray<AstGenericTypePack> genericPacks;
+            readGenerics(generics, genericPacks);
+
+            AstType* type = readType();
+            bool exported = readBool();
+            return stat<AstStatTypeAlias>(location, hasSemicolon, name, nameLocation, generics, genericPacks, type, exported);
+        }
+
+        case SerializedNode::StatDeclareGlobal:
+        {
+            AstName name = readName();
+            AstType* type = readType();
+            return stat<AstStatDeclareGlobal>(location, hasSemicolon, name, type);
+        }
+
+        case SerializedNode::StatDeclareFunction:
+        {
+            AstName name = readName();
+
+            AstArray<AstGenericType> generics;
+            AstArray<AstGenericTypePack> genericPacks;
+            readGenerics(generics, genericPacks);
+
+            AstTypeList params = readTypeList();
+            AstArray<AstArgumentName> paramNames = allocateArray<AstArgumentName>(readCount());
+
+            for (size_t i = 0; i < paramNames.size; ++i)
+            {
+                AstName paramName = readName();
+                paramNames.data[i] = AstArgumentName(paramName, readLocation());
+            }
+
+            AstTypeList retTypes = readTypeList();
+            return stat<AstStatDeclareFunction>(location, hasSemicolon, name, generics, genericPacks, params, paramNames, retTypes);
+        }
+
+        case SerializedNode::StatDeclareClass:
+        {
+            AstName name = readName();
+            std::optional<AstName> superName = readOptionalName();
+            AstArray<AstDeclaredClassProp> props = allocateArray<AstDeclaredClassProp>(readCount());
+
+            for (size_t i = 0; i < props.size; ++i)
+            {
+                AstDeclaredClassProp& prop = props.data[i];
+                prop.name = readName();
+                prop.ty = readType();
+                prop.isMethod = readBool();
+            }
+
+            return stat<AstStatDeclareClass>(location, hasSemicolon, name, superName, props);
+        }
+
+        case SerializedNode::StatError:
+        {
+            AstArray<AstExpr*> expressions = readExprs();
+            AstArray<AstStat*> statements = readStats();
+            return stat<AstStatError>(location, hasSemicolon, expressions, statements, readUnsigned());
+        }
+
+        case SerializedNode::TypeReference:
+        {
+            bool hasParameterList = readBool();
+            std::optional<AstName> prefix = readOptionalName();
+            AstName name = readName();
+            AstArray<AstTypeOrPack> parameters = allocateArray<AstTypeOrPack>(readCount());
+
+            for (size_t i = 0; i < parameters.size; ++i)
+            {
+                AstTypeOrPack& parameter = parameters.data[i];
+                parameter.type = readType();
+                parameter.typePack = readTypePack();
+            }
+
+            return allocator.alloc<AstTypeReference>(location, prefix, name, hasParameterList, parameters);
+        }
+
+        case SerializedNode::TypeTable:
+        {
+            AstArray<AstTableProp> props = allocateArray<AstTableProp>(readCount());
+
+            for (size_t i = 0; i < props.size; ++i)
+            {
+                AstTableProp& prop = props.data[i];
+                prop.name = readName();
+                prop.location = readLocation();
+                prop.type = readType();
+            }
+
+            AstTableIndexer* indexer = nullptr;
+
+            if (readBool())
+            {
+                AstType* indexType = readType();
+                AstType* resultType = readType();
+                indexer = allocator.alloc<AstTableIndexer>(AstTableIndexer{indexType, resultType, readLocation()});
+            }
+
+            return allocator.alloc<AstTypeTable>(location, props, indexer);
+        }
+
+        case SerializedNode::TypeFunction:
+        {
+            AstArray<AstGenericType> generics;
+            AstArray<AstGenericTypePack> genericPacks;
+            readGenerics(generics, genericPacks);
+
+            AstTypeList argTypes = readTypeList();
+            AstArray<std::optional<AstArgumentName>> argNames = allocateArray<std::optional<AstArgumentName>>(readCount());
+
+            for (size_t i = 0; i < argNames.size; ++i)
+            {
+                new (&argNames.data[i]) std::optional<AstArgumentName>();
+
+                if (readBool())
+                {
+                    AstName argName = readName();
+                    argNames.data[i] = AstArgumentName(argName, readLocation());
+                }
+            }
+
+            AstTypeList returnTypes = readTypeList();
+            return allocator.alloc<AstTypeFunction>(location, generics, genericPacks, argTypes, argNames, returnTypes);
+        }
+
+        case SerializedNode::TypeTypeof:
+            return allocator.alloc<AstTypeTypeof>(location, readExpr());
+
+        case SerializedNode::TypeUnion:
+            return allocator.alloc<AstTypeUnion>(location, readTypes());
+
+        case SerializedNode::TypeIntersection:
+            return allocator.alloc<AstTypeIntersection>(location, readTypes());
+
+        case SerializedNode::TypeSingletonBool:
+            return allocator.alloc<AstTypeSingletonBool>(location, readBool());
+
+        case SerializedNode::TypeSingletonString:
+            return allocator.alloc<AstTypeSingletonString>(location, readString());
+
+        case SerializedNode::TypeError:
+        {
+            AstArray<AstType*> types = readTypes();
+            bool isMissing = readBool();
+            return allocator.alloc<AstTypeError>(location, types, isMissing, readUnsigned());
+        }
+
+        case SerializedNode::TypePackExplicit:
+            return allocator.alloc<AstTypePackExplicit>(location, readTypeList());
+
+        case SerializedNode::TypePackVariadic:
+            return allocator.alloc<AstTypePackVariadic>(location, readType());
+
+        case SerializedNode::TypePackGeneric:
+            return allocator.alloc<AstTypePackGeneric>(location, readName());
+
+        case SerializedNode::Null:
+        case SerializedNode::Count:
+            break;
+        }
+
+        failed = true;
+        return nullptr;
+    }
+};
+
+std::string serializeParseResult(const ParseResult& result, const char* source, size_t sourceSize)
+{
+    LUAU_TIMETRACE_SCOPE("serializeParseResult", "Parser");
+
+    LUAU_ASSERT(result.skippedFunctions.empty());
+
+    std::string out;
+    out.reserve(sourceSize);
+
+    out.append(kSerializedMagic, sizeof(kSerializedMagic));
+    out.push_back(char(kSerializedVersion));
+    writeFixed(out, sourceSize);
+    writeFixed(out, hashData(source, sourceSize));
+
+    AstSerializer serializer(out);
+
+    serializer.writeVarInt(result.lines);
+
+    serializer.writeVarInt(result.hotcomments.size());
+
+    for (const HotComment& hotcomment : result.hotcomments)
+    {
+        serializer.writeBool(hotcomment.header);
+        serializer.writeLocation(hotcomment.location);
+        serializer.writeString(hotcomment.content.data(), hotcomment.content.size());
+    }
+
+    serializer.writeVarInt(result.errors.size());
+
+    for (const ParseError& error : result.errors)
+    {
+        serializer.writeLocation(error.getLocation());
+        serializer.writeString(error.getMessage().data(), error.getMessage().size());
+    }
+
+    serializer.writeVarInt(result.commentLocations.size());
+
+    for (const Comment& comment : result.commentLocations)
+    {
+        serializer.writeVarInt(comment.type);
+        serializer.writeLocation(comment.location);
+    }
+
+    serializer.writeNode(result.root);
+
+    writeFixed(out, hashData(out.data(), out.size()));
+
+    return out;
+}
+
+std::optional<ParseResult> deserializeParseResult(
+    const char* data, size_t dataSize, const char* source, size_t sourceSize, AstNameTable& names, Allocator& allocator)
+{
+    LUAU_TIMETRACE_SCOPE("deserializeParseResult", "Parser");
+
+    if (dataSize < kSerializedHeaderSize + kSerializedTrailerSize)
+        return std::nullopt;
+
+    if (memcmp(data, kSerializedMagic, sizeof(kSerializedMagic)) != 0 || uint8_t(data[4]) != kSerializedVersion)
+        return std::nullopt;
+
+    if (readFixed(data + 5) != sourceSize || readFixed(data + 13) != hashData(source, sourceSize))
+        return std::nullopt;
+
+    size_t payloadSize = dataSize - kSerializedTrailerSize;
+
+    if (readFixed(data + payloadSize) != hashData(data, payloadSize))
+        return std::nullopt;
+
+    AstDeserializer deserializer(data, payloadSize, names, allocator);
+    deserializer.offset = kSerializedHeaderSize;
+    deserializer.recursionLimit = unsigned(FInt::LuauRecursionLimit * kSerializedNodesPerRecursionLevel);
+
+    ParseResult result;
+    result.lines = size_t(deserializer.readVarInt());
+
+    for (size_t i = 0, count = deserializer.readCount(); i < count && !deserializer.failed; ++i)
+    {
+        HotComment hotcomment;
+        hotcomment.header = deserializer.readBool();
+        hotcomment.location = deserializer.readLocation();
+
+        AstArray<char> content = deserializer.readString();
+        hotcomment.content.assign(content.data, content.size);
+
+        result.hotcomments.push_back(std::move(hotcomment));
+    }
+
+    for (size_t i = 0, count = deserializer.readCount(); i < count && !deserializer.failed; ++i)
+    {
+        Location location = deserializer.readLocation();
+        AstArray<char> message = deserializer.readString();
+
+        result.errors.push_back(ParseError(location, std::string(message.data, message.size)));
+    }
+
+    for (size_t i = 0, count = deserializer.readCount(); i < count && !deserializer.failed; ++i)
+    {
+        Lexeme::Type type = Lexeme::Type(deserializer.readVarInt());
+        result.commentLocations.push_back(Comment{type, deserializer.readLocation()});
+    }
+
+    result.root = deserializer.readNodeAs<AstStatBlock>();
+
+    if (deserializer.failed || deserializer.offset != payloadSize)
+        return std::nullopt;
+
+    return result;
+}
+
+} // namespace Luau
@@ -4,7 +4,10 @@
 #include "Luau/Confusables.h"
 #include "Luau/StringUtils.h"
 
+#include <algorithm>
+
 #include <limits.h>
+#include <string.h>
 
 namespace Luau
 {
@@ -243,6 +246,13 @@ AstNameTable::AstNameTable(Allocator& allocator)
         addStatic(kReserved[i - Lexeme::Reserved_BEGIN], static_cast<Lexeme::Type>(i));
 }
 
+AstNameTable::AstNameTable(Allocator& allocator, AstNameTable& shared, std::mutex& sharedMutex)
+    : AstNameTable(allocator)
+{
+    this->shared = &shared;
+    this->sharedMutex = &sharedMutex;
+}
+
 AstName AstNameTable::addStatic(const char* name, Lexeme::Type type)
 {
     AstNameTable::Entry entry = {AstName(name), uint32_t(strlen(name)), type};
@@ -262,6 +272,18 @@ std::pair<AstName, Lexeme::Type> AstNameTable::getOrAddWithType(const char* name
     if (entry.type != Lexeme::Eof)
         return std::make_pair(entry.value, entry.type);
 
+    // the name is taken from the shared table instead; the entry stays valid since both names have the same hash
+    if (shared)
+    {
+        std::unique_lock<std::mutex> lock(*sharedMutex);
+        std::pair<AstName, Lexeme::Type> result = shared->getOrAddWithType(name, length);
+
+        const_cast<Entry&>(entry).value = result.first;
+        const_cast<Entry&>(entry).type = result.second;
+
+        return result;
+    }
+
     // we just inserted an entry with a non-owned pointer into the map
     // we need to correct it, *but* we need to be careful about not disturbing the hash value
     char* nameData = static_cast<char*>(allocator.allocate(length + 1));
@@ -280,6 +302,13 @@ std::pair<AstName, Lexeme::Type> AstNameTable::getWithType(const char* name, siz
     {
         return std::make_pair(entry->value, entry->type);
     }
+
+    if (shared)
+    {
+        std::unique_lock<std::mutex> lock(*sharedMutex);
+        return shared->getWithType(name, length);
+    }
+
     return std::make_pair(AstName(), Lexeme::Name);
 }
 
@@ -315,6 +344,49 @@ inline bool isNewline(char ch)
     return ch == '\n';
 }
 
+// Comment bodies and long strings are often long runs of characters that don't need special handling, so they are scanned a word at a
+// time; the helpers below classify all 8 bytes of a word at once using portable integer arithmetic (SWAR)
+const size_t kWordSize = 8;
+
+const uint64_t kLowBits = 0x0101010101010101ull;
+const uint64_t kHighBits = 0x8080808080808080ull;
+
+inline uint64_t loadWord(const char* data)
+{
+    uint64_t result;
+    memcpy(&result, data, sizeof(result));
+    return result;
+}
+
+// returns a mask with the high bit set in every byte of the word that is zero
+inline uint64_t zeroBytes(uint64_t w)
+{
+    return ~(((w & ~kHighBits) + ~kHighBits) | w) & kHighBits;
+}
+
+// returns a mask with the high bit set in every byte of the word that is equal to ch
+inline uint64_t matchBytes(uint64_t w, char ch)
+{
+    return zeroBytes(w ^ (kLowBits * uint8_t(ch)));
+}
+
+inline int countBytes(uint64_t mask)
+{
+    return int(((mask >> 7) * kLowBits) >> 56);
+}
+
+// returns the index of the first byte in memory order that has the high bit set in the mask; the mask must not be zero
+inline unsigned int firstByte(uint64_t mask)
+{
+#if defined(LUAU_BIG_ENDIAN)
+    return __builtin_clzll(mask) >> 3;
+#elif defined(_MSC_VER)
+    return countBytes(((mask & (0 - mask)) - 1) & kHighBits);
+#else
+    return __builtin_ctzll(mask) >> 3;
+#endif
+}
+
 static char unescape(char ch)
 {
     switch (ch)
@@ -393,6 +465,30 @@ void Lexer::nextline()
     next();
 }
 
+void Lexer::seek(const Position& position)
+{
+    unsigned int lineStart = 0;
+
+    for (unsigned int i = 0; i < position.line; ++i)
+    {
+        const char* newline = static_cast<const char*>(memchr(buffer + lineStart, '\n', bufferSize - lineStart));
+
+        if (!newline)
+            break;
+
+        lineStart = unsigned(newline - buffer) + 1;
+    }
+
+    offset = std::min(lineStart + position.column, unsigned(bufferSize));
+    line = position.line;
+    lineOffset = lineStart;
+
+    lexeme = Lexeme(Location(position, 0), Lexeme::Eof);
+    prevLocation = lexeme.location;
+
+    braceStack.clear();
+}
+
 Lexeme Lexer::lookahead()
 {
     unsigned int currentOffset = offset;
@@ -470,6 +566,19 @@ Lexeme Lexer::readCommentBody()
     }
 
     // fall back to single-line comment
+    while (offset + kWordSize <= bufferSize)
+    {
+        uint64_t w = loadWord(&buffer[offset]);
+
+        if (uint64_t mask = zeroBytes(w) | matchBytes(w, '\r') | matchBytes(w, '\n'))
+        {
+            offset += firstByte(mask);
+            break;
+        }
+
+        offset += kWordSize;
+    }
+
     while (peekch() != 0 && peekch() != '\r' && !isNewline(peekch()))
         consume();
 
@@ -509,6 +618,28 @@ Lexeme Lexer::readLongString(const Position& start, int sep, Lexeme::Type ok, Le
 
     while (peekch())
     {
+        // skip words without closing brackets, counting the newlines in them
+        while (offset + kWordSize <= bufferSize)
+        {
+            uint64_t w = loadWord(&buffer[offset]);
+
+            if (zeroBytes(w) | matchBytes(w, ']'))
+                break;
+
+            if (uint64_t newlines = matchBytes(w, '\n'))
+            {
+                unsigned int last = offset + kWordSize - 1;
+
+                while (!isNewline(buffer[last]))
+                    last--;
+
+                line += countBytes(newlines);
+                lineOffset = last + 1;
+            }
+
+            offset += kWordSize;
+        }
+
         if (peekch() == ']')
         {
             if (skipLongSeparator() == sep)
@@ -4,6 +4,8 @@
 #include "Luau/TimeTrace.h"
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
 
 #include <errno.h>
 #include <limits.h>
@@ -158,10 +160,25 @@ ParseResult Parser::parse(const char* buffer, size_t bufferSize, AstNameTable& n
         AstStatBlock* root = p.parseChunk();
         size_t lines = p.lexer.current().location.end.line + (bufferSize > 0 && buffer[bufferSize - 1] != '\n');
 
-        return ParseResult{root, lines, std::move(p.hotcomments), std::move(p.parseErrors), std::move(p.commentLocations)};
+        // skipped bodies are matched with a token scan that doesn't check the syntax, so a body with a syntax error could be matched with the
+        // wrong 'end'; this is only possible when the rest of the source fails to parse, in which case we parse everything to report it accurately
+        if (options.skipFunctionBodies && !p.parseErrors.empty())
+        {
+            options.skipFunctionBodies = false;
+            return parse(buffer, bufferSize, names, allocator, options);
+        }
+
+        return ParseResult{
+            root, lines, std::move(p.hotcomments), std::move(p.parseErrors), std::move(p.commentLocations), std::move(p.skippedFunctions)};
     }
     catch (ParseError& err)
     {
+        if (options.skipFunctionBodies)
+        {
+            options.skipFunctionBodies = false;
+            return parse(buffer, bufferSize, names, allocator, options);
+        }
+
         // when catching a fatal error, append it to the list of non-fatal errors and return
         p.parseErrors.push_back(err);
 
@@ -169,6 +186,57 @@ ParseResult Parser::parse(const char* buffer, size_t bufferSize, AstNameTable& n
     }
 }
 
+std::vector<BatchParseResult> Parser::parseBatch(
+    const std::vector<std::string_view>& sources, unsigned int threads, AstNameTable* sharedNames, ParseOptions options)
+{
+    LUAU_TIMETRACE_SCOPE("Parser::parseBatch", "Parser");
+
+    std::vector<BatchParseResult> results(sources.size());
+
+    // sources are parsed independently, so workers only need to share the next source index and the shared name table
+    std::atomic<size_t> nextSource{0};
+    std::mutex sharedMutex;
+
+    auto worker = [&]() {
+        // each worker looks up the shared names it has seen in its own table to avoid taking the lock for every name
+        Allocator workerAllocator;
+        std::unique_ptr<AstNameTable> workerNames = sharedNames ? std::make_unique<AstNameTable>(workerAllocator, *sharedNames, sharedMutex) : nullptr;
+
+        for (size_t i = nextSource++; i < sources.size(); i = nextSource++)
+        {
+            BatchParseResult& result = results[i];
+
+            result.allocator = std::make_unique<Allocator>();
+
+            if (!workerNames)
+                result.names = std::make_unique<AstNameTable>(*result.allocator);
+
+            AstNameTable& names = workerNames ? *workerNames : *result.names;
+
+            result.result = parse(sources[i].data(), sources[i].size(), names, *result.allocator, options);
+        }
+    };
+
+    threads = std::min(threads, unsigned(sources.size()));
+
+    if (threads <= 1)
+    {
+        worker();
+        return results;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (unsigned int i = 0; i < threads; ++i)
+        workers.emplace_back(worker);
+
+    for (std::thread& thread : workers)
+        thread.join();
+
+    return results;
+}
+
 Parser::Parser(const char* buffer, size_t bufferSize, AstNameTable& names, Allocator& allocator, const ParseOptions& options)
     : options(options)
     , lexer(buffer, bufferSize, names)
@@ -183,9 +251,10 @@ Parser::Parser(const char* buffer, size_t bufferSize, AstNameTable& names, Alloc
     functionStack.reserve(8);
     functionStack.push_back(top);
 
-    nameSelf = names.addStatic("self");
-    nameNumber = names.addStatic("number");
-    nameError = names.addStatic(kParseNameError);
+    // note: the name table may be shared between multiple parses, for example when compiling a bundle of modules
+    nameSelf = names.getOrAdd("self");
+    nameNumber = names.getOrAdd("number");
+    nameError = names.getOrAdd(kParseNameError);
     nameNil = names.getOrAdd("nil"); // nil is a reserved keyword
 
     matchRecoveryStopOnToken.assign(Lexeme::Type::Reserved_END, 0);
@@ -276,6 +345,641 @@ AstStatBlock* Parser::parseBlockNoScope()
     return allocator.alloc<AstStatBlock>(location, copy(body));
 }
 
+// Collects the nodes that enclose the edited range in traversal order; type annotations can't contain blocks and are skipped
+struct ReparseEnclosingVisitor : AstVisitor
+{
+    Position begin;
+    Position end;
+
+    std::vector<AstNode*> nodes;
+
+    ReparseEnclosingVisitor(const Position& begin, const Position& end)
+        : begin(begin)
+        , end(end)
+    {
+    }
+
+    bool visit(AstNode* node) override
+    {
+        if (node->location.begin <= begin && end <= node->location.end)
+        {
+            nodes.push_back(node);
+            return true;
+        }
+
+        return false;
+    }
+};
+
+struct ReparseChildVisitor : AstVisitor
+{
+    AstNode* parent;
+    AstNode* child;
+
+    bool found = false;
+
+    ReparseChildVisitor(AstNode* parent, AstNode* child)
+        : parent(parent)
+        , child(child)
+    {
+    }
+
+    bool visit(AstNode* node) override
+    {
+        if (node == parent)
+            return true;
+
+        found |= node == child;
+        return false;
+    }
+};
+
+// Moves the locations that follow the edited range to their positions in the new source
+struct ReparseShiftVisitor : AstVisitor
+{
+    Position oldEnd;
+    Position newEnd;
+
+    // locals of the replaced statements that are referenced by the statements after them, mapped to their reparsed counterparts
+    DenseHashMap<AstLocal*, AstLocal*> locals;
+
+    ReparseShiftVisitor(const Position& oldEnd, const Position& newEnd)
+        : oldEnd(oldEnd)
+        , newEnd(newEnd)
+        , locals(nullptr)
+    {
+    }
+
+    void shift(Position& position)
+    {
+        position.shift(oldEnd, oldEnd, newEnd);
+    }
+
+    void shift(Location& location)
+    {
+        location.shift(oldEnd, oldEnd, newEnd);
+    }
+
+    void shift(AstLocal* local)
+    {
+        shift(local->location);
+
+        if (AstLocal** shadow = locals.find(local->shadow))
+            local->shadow = *shadow;
+    }
+
+    void shift(const AstArray<AstGenericType>& generics, const AstArray<AstGenericTypePack>& genericPacks)
+    {
+        for (size_t i = 0; i < generics.size; ++i)
+            shift(generics.data[i].location);
+
+        for (size_t i = 0; i < genericPacks.size; ++i)
+            shift(genericPacks.data[i].location);
+    }
+
+    bool visit(AstNode* node) override
+    {
+        // nodes are enclosed by their parents, so nothing needs to move in subtrees that end before the edit
+        if (node->location.end < oldEnd)
+            return false;
+
+        shift(node->location);
+        return true;
+    }
+
+    bool visit(AstType* node) override
+    {
+        return visit(static_cast<AstNode*>(node));
+    }
+
+    bool visit(AstTypePack* node) override
+    {
+        return visit(static_cast<AstNode*>(node));
+    }
+
+    bool visit(AstExprLocal* node) override
+    {
+        if (AstLocal** local = locals.find(node->local))
+            node->local = *local;
+
+        return visit(static_cast<AstNode*>(node));
+    }
+
+    bool visit(AstExprCall* node) override
+    {
+        if (!visit(static_cast<AstNode*>(node)))
+            return false;
+
+        shift(node->argLocation);
+        return true;
+    }
+
+    bool visit(AstExprIndexName* node) override
+    {
+        if (!visit(static_cast<AstNode*>(node)))
+            return false;
+
+        shift(node->indexLocation);
+        shift(node->opPosition);
+        return true;
+    }
+
+    bool visit(AstExprFunction* node) override
+    {
+        if (!visit(static_cast<AstNode*>(node)))
+            return false;
+
+        shift(node->generics, node->genericPacks);
+
+        if (node->self)
+            shift(node->self);
+
+        for (AstLocal* arg : node->args)
+            shift(arg);
+
+        shift(node->varargLocation);
+
+        if (node->argLocation)
+            shift(*node->argLocation);
+
+        return true;
+    }
+
+    bool visit(AstStatIf* node) override
+    {
+        if (!visit(static_cast<AstNode*>(node)))
+            return false;
+
+        if (node->thenLocation)
+            shift(*node->thenLocation);
+
+        if (node->elseLocation)
+            shift(*node->elseLocation);
+
+        return true;
+    }
+
+    bool visit(AstStatWhile* node) override
+    {
+        if (!visit(static_cast<AstNode*>(node)))
+            return false;
+
+        shift(node->doLocation);
+        return true;
+    }
+
+    bool visit(AstStatLocal* node) override
+    {
+        if (!visit(static_cast<AstNode*>(node)))
+            return false;
+
+        for (AstLocal* var : node->vars)
+            shift(var);
+
+        if (node->equalsSignLocation)
+            shift(*node->equalsSignLocation);
+
+        return true;
+    }
+
+    bool visit(AstStatFor* node) override
+    {
+        if (!visit(static_cast<AstNode*>(node)))
+            return false;
+
+        shift(node->var);
+        shift(node->doLocation);
+        return true;
+    }
+
+    bool visit(AstStatForIn* node) override
+    {
+        if (!visit(static_cast<AstNode*>(node)))
+            return false;
+
+        for (AstLocal* var : node->vars)
+            shift(var);
+
+        shift(node->inLocation);
+        shift(node->doLocation);
+        return true;
+    }
+
+    bool visit(AstStatLocalFunction* node) override
+    {
+        if (!visit(static_cast<AstNode*>(node)))
+            return false;
+
+        shift(node->name);
+        return true;
+    }
+
+    bool visit(AstStatTypeAlias* node) override
+    {
+        if (!visit(static_cast<AstNode*>(node)))
+            return false;
+
+        shift(node->nameLocation);
+        shift(node->generics, node->genericPacks);
+        return true;
+    }
+
+    bool visit(AstStatDeclareFunction* node) override
+    {
+        if (!visit(static_cast<AstNode*>(node)))
+            return false;
+
+        shift(node->generics, node->genericPacks);
+
+        for (size_t i = 0; i < node->paramNames.size; ++i)
+            shift(node->paramNames.data[i].second);
+
+        return true;
+    }
+
+    bool visit(AstTypeTable* node) override
+    {
+        if (!visit(static_cast<AstNode*>(node)))
+            return false;
+
+        for (size_t i = 0; i < node->props.size; ++i)
+            shift(node->props.data[i].location);
+
+        if (node->indexer)
+            shift(node->indexer->location);
+
+        return true;
+    }
+
+    bool visit(AstTypeFunction* node) override
+    {
+        if (!visit(static_cast<AstNode*>(node)))
+            return false;
+
+        shift(node->generics, node->genericPacks);
+
+        for (size_t i = 0; i < node->argNames.size; ++i)
+            if (node->argNames.data[i])
+                shift(node->argNames.data[i]->second);
+
+        return true;
+    }
+};
+
+static void collectLocals(AstStat* stat, std::vector<AstLocal*>& result)
+{
+    if (AstStatLocal* local = stat->as<AstStatLocal>())
+        result.insert(result.end(), local->vars.begin(), local->vars.end());
+    else if (AstStatLocalFunction* function = stat->as<AstStatLocalFunction>())
+        result.push_back(function->name);
+}
+
+static bool sameLocalNames(const std::vector<AstLocal*>& lhs, const std::vector<AstLocal*>& rhs)
+{
+    if (lhs.size() != rhs.size())
+        return false;
+
+    for (size_t i = 0; i < lhs.size(); ++i)
+        if (lhs[i]->name != rhs[i]->name)
+            return false;
+
+    return true;
+}
+
+ParseResult Parser::reparse(const char* buffer, size_t bufferSize, ParseResult& previous, const ParseEdit& edit, AstNameTable& names,
+    Allocator& allocator, ParseOptions options)
+{
+    LUAU_TIMETRACE_SCOPE("Parser::reparse", "Parser");
+
+    // skipped function bodies aren't tracked through edits
+    if (previous.root && previous.errors.empty() && previous.skippedFunctions.empty() && !options.skipFunctionBodies &&
+        edit.begin <= edit.oldEnd && edit.begin <= edit.newEnd)
+    {
+        Parser p(buffer, bufferSize, names, allocator, options);
+
+        try
+        {
+            if (std::optional<ParseResult> result = p.reparseBlock(buffer, bufferSize, previous, edit))
+                return std::move(*result);
+        }
+        catch (ParseError&)
+        {
+            // fatal errors are reported by the full parse below
+        }
+    }
+
+    return parse(buffer, bufferSize, names, allocator, options);
+}
+
+std::optional<ParseResult> Parser::reparseBlock(const char* buffer, size_t bufferSize, ParseResult& previous, const ParseEdit& edit)
+{
+    ReparseEnclosingVisitor enclosing(edit.begin, edit.oldEnd);
+    previous.root->visit(&enclosing);
+
+    const std::vector<AstNode*>& nodes = enclosing.nodes;
+
+    // nodes that enclose a given node precede it in traversal order
+    auto findParent = [&](size_t index) -> size_t {
+        for (size_t i = index; i > 0; --i)
+            if (nodes[i - 1]->location.encloses(nodes[index]->location))
+                return i - 1;
+
+        return index;
+    };
+
+    // find the innermost block that encloses the edit without touching the lexeme that starts the block
+    AstStatBlock* block = nullptr;
+    Position blockBegin(0, 0);
+    std::vector<AstNode*> path;
+
+    for (size_t i = nodes.size(); i > 0 && !block; --i)
+    {
+        AstStatBlock* candidate = nodes[i - 1]->as<AstStatBlock>();
+
+        if (!candidate)
+            continue;
+
+        size_t parent = findParent(i - 1);
+
+        // locals declared in repeat blocks are visible in the loop condition that follows the block
+        if (parent != i - 1 && nodes[parent]->is<AstStatRepeat>())
+            continue;
+
+        Position begin = candidate->location.begin;
+
+        // do blocks start at the 'do' keyword instead of the end of the preceding lexeme
+        if (parent != i - 1 && nodes[parent]->is<AstStatBlock>())
+            begin.column += 2;
+
+        // the module block doesn't start with a lexeme, so it can be edited from the very beginning
+        if ((begin < edit.begin || candidate == previous.root) && edit.oldEnd <= candidate->location.end)
+        {
+            block = candidate;
+            blockBegin = begin;
+
+            for (size_t node = i - 1;; node = findParent(node))
+            {
+                path.push_back(nodes[node]);
+
+                if (findParent(node) == node)
+                    break;
+            }
+        }
+    }
+
+    if (!block)
+        return std::nullopt;
+
+    std::reverse(path.begin(), path.end());
+
+    if (path[0] != previous.root)
+        return std::nullopt;
+
+    for (size_t i = 0; i + 1 < path.size(); ++i)
+    {
+        ReparseChildVisitor child(path[i], path[i + 1]);
+        path[i]->visit(&child);
+
+        if (!child.found)
+            return std::nullopt;
+    }
+
+    // the edited statement is reparsed with the one before it if the edit starts in the space between them
+    const AstArray<AstStat*>& body = block->body;
+
+    size_t start = 0;
+    while (start < body.size && body.data[start]->location.end < edit.begin)
+        start++;
+
+    Position startPosition = blockBegin;
+
+    if (start < body.size && body.data[start]->location.begin <= edit.begin)
+        startPosition = body.data[start]->location.begin;
+    else if (start > 0)
+        startPosition = body.data[--start]->location.begin;
+
+    // restore the scope of the parser at the first reparsed statement
+    std::vector<AstLocal*> declared;
+
+    for (size_t i = 0; i < path.size(); ++i)
+    {
+        AstNode* node = path[i];
+        AstNode* next = i + 1 < path.size() ? path[i + 1] : nullptr;
+
+        if (AstStatBlock* stat = node->as<AstStatBlock>())
+        {
+            size_t count = next ? std::find(stat->body.begin(), stat->body.end(), next) - stat->body.begin() : start;
+
+            declared.clear();
+
+            for (size_t s = 0; s < count; ++s)
+                collectLocals(stat->body.data[s], declared);
+
+            for (AstLocal* local : declared)
+                bindLocal(local);
+        }
+        else if (AstExprFunction* stat = node->as<AstExprFunction>())
+        {
+            Function function;
+            function.vararg = stat->vararg;
+            functionStack.push_back(function);
+
+            if (stat->self)
+                bindLocal(stat->self);
+
+            for (AstLocal* arg : stat->args)
+                bindLocal(arg);
+        }
+        else if (AstStatLocalFunction* stat = node->as<AstStatLocalFunction>())
+        {
+            bindLocal(stat->name);
+        }
+        else if (AstStatFor* stat = node->as<AstStatFor>())
+        {
+            if (next == stat->body)
+            {
+                functionStack.back().loopDepth++;
+                bindLocal(stat->var);
+            }
+        }
+        else if (AstStatForIn* stat = node->as<AstStatForIn>())
+        {
+            if (next == stat->body)
+            {
+                functionStack.back().loopDepth++;
+
+                for (AstLocal* var : stat->vars)
+                    bindLocal(var);
+            }
+        }
+        else if (AstStatWhile* stat = node->as<AstStatWhile>())
+        {
+            if (next == stat->body)
+                functionStack.back().loopDepth++;
+        }
+        else if (AstStatRepeat* stat = node->as<AstStatRepeat>())
+        {
+            if (next == stat->body)
+            {
+                functionStack.back().loopDepth++;
+            }
+            else
+            {
+                declared.clear();
+
+                for (AstStat* s : stat->body->body)
+                    collectLocals(s, declared);
+
+                for (AstLocal* local : declared)
+                    bindLocal(local);
+            }
+        }
+    }
+
+    // comments before the first reparsed lexeme were captured by the constructor and are taken from the previous result instead
+    lexer.seek(startPosition);
+    commentLocations.clear();
+    hotcomments.clear();
+
+    // hot comments before the first statement of the module are header directives
+    hotcommentHeader = block == previous.root && start == 0;
+    nextLexeme();
+    hotcommentHeader = false;
+
+    auto shifted = [&](Position position) {
+        position.shift(edit.oldEnd, edit.oldEnd, edit.newEnd);
+        return position;
+    };
+
+    // statements after the edit are reused once the parser reaches one of them, as long as the locals that are in scope at that point match
+    size_t resume = start;
+    while (resume < body.size && body.data[resume]->location.begin < edit.oldEnd)
+        resume++;
+
+    size_t replaced = start;
+    std::vector<AstLocal*> oldLocals;
+    std::vector<AstLocal*> newLocals;
+    bool reused = false;
+
+    TempVector<AstStat*> stats(scratchStat);
+
+    while (!blockFollow(lexer.current()))
+    {
+        unsigned int recursionCounterOld = recursionCounter;
+
+        incrementRecursionCounter("block");
+
+        AstStat* stat = parseStat();
+
+        recursionCounter = recursionCounterOld;
+
+        if (lexer.current().type == ';')
+        {
+            nextLexeme();
+            stat->hasSemicolon = true;
+        }
+
+        stats.push_back(stat);
+        collectLocals(stat, newLocals);
+
+        if (isStatLast(stat))
+            break;
+
+        Position next = lexer.current().location.begin;
+
+        while (resume < body.size && shifted(body.data[resume]->location.begin) < next)
+            resume++;
+
+        if (resume < body.size && shifted(body.data[resume]->location.begin) == next)
+        {
+            for (; replaced < resume; ++replaced)
+                collectLocals(body.data[replaced], oldLocals);
+
+            if (sameLocalNames(oldLocals, newLocals))
+            {
+                reused = true;
+                break;
+            }
+        }
+    }
+
+    // error recovery depends on the enclosing constructs, so edits that introduce errors are handled by a full parse
+    if (!parseErrors.empty())
+        return std::nullopt;
+
+    // the edit must not change the lexeme that ends the block
+    if (!reused && lexer.current().location.begin != shifted(block->location.end))
+        return std::nullopt;
+
+    if (!reused)
+        resume = body.size;
+
+    Position stopPosition = resume < body.size ? body.data[resume]->location.begin : block->location.end;
+
+    ReparseShiftVisitor shift(edit.oldEnd, edit.newEnd);
+
+    if (reused)
+    {
+        for (size_t i = 0; i < oldLocals.size(); ++i)
+            shift.locals[oldLocals[i]] = newLocals[i];
+    }
+
+    // only the statements that are reused need to move, so the replaced statements are detached from the block first
+    std::vector<AstStat*> result(body.data, body.data + start);
+    result.insert(result.end(), stats.begin(), stats.end());
+    result.insert(result.end(), body.data + resume, body.data + body.size);
+
+    // the module block starts at the beginning of the source even if the edit inserts text there
+    Position rootBegin = previous.root->location.begin;
+
+    block->body = AstArray<AstStat*>{body.data + resume, body.size - resume};
+    previous.root->visit(&shift);
+    block->body = copy(result.data(), result.size());
+
+    previous.root->location.begin = rootBegin;
+
+    std::vector<Comment> comments;
+
+    for (const Comment& comment : previous.commentLocations)
+        if (comment.location.begin < startPosition)
+            comments.push_back(comment);
+
+    comments.insert(comments.end(), commentLocations.begin(), commentLocations.end());
+
+    for (Comment comment : previous.commentLocations)
+    {
+        if (comment.location.begin >= stopPosition)
+        {
+            shift.shift(comment.location);
+            comments.push_back(comment);
+        }
+    }
+
+    std::vector<HotComment> hotcommentsResult;
+
+    for (const HotComment& hotcomment : previous.hotcomments)
+        if (hotcomment.location.begin < startPosition)
+            hotcommentsResult.push_back(hotcomment);
+
+    hotcommentsResult.insert(hotcommentsResult.end(), hotcomments.begin(), hotcomments.end());
+
+    for (HotComment hotcomment : previous.hotcomments)
+    {
+        if (hotcomment.location.begin >= stopPosition)
+        {
+            shift.shift(hotcomment.location);
+            hotcommentsResult.push_back(hotcomment);
+        }
+    }
+
+    size_t lines = previous.lines + edit.newEnd.line - edit.oldEnd.line;
+
+    if (lexer.current().type == Lexeme::Eof)
+        lines = lexer.current().location.end.line + (bufferSize > 0 && buffer[bufferSize - 1] != '\n');
+
+    return ParseResult{previous.root, lines, std::move(hotcommentsResult), {}, std::move(comments)};
+}
+
 // stat ::=
 // varlist `=' explist |
 // functioncall |
@@ -1050,7 +1754,18 @@ std::pair<AstExprFunction*, AstLocal*> Parser::parseFunctionBody(
 
     auto [self, vars] = prepareFunctionArguments(start, hasself, args);
 
-    AstStatBlock* body = parseBlock();
+    AstStatBlock* body = nullptr;
+    AstArray<AstLocal*> scope;
+
+    if (options.skipFunctionBodies)
+    {
+        body = skipFunctionBody();
+        scope = copy(localStack.data(), localStack.size());
+    }
+    else
+    {
+        body = parseBlock();
+    }
 
     functionStack.pop_back();
 
@@ -1060,9 +1775,198 @@ std::pair<AstExprFunction*, AstLocal*> Parser::parseFunctionBody(
 
     bool hasEnd = expectMatchEndAndConsume(Lexeme::ReservedEnd, matchFunction);
 
-    return {allocator.alloc<AstExprFunction>(Location(start, end), generics, genericPacks, self, vars, vararg, varargLocation, body,
-                functionStack.size(), debugname, typelist, varargAnnotation, hasEnd, argLocation),
-        funLocal};
+    AstExprFunction* function = allocator.alloc<AstExprFunction>(Location(start, end), generics, genericPacks, self, vars, vararg,
+        varargLocation, body, functionStack.size(), debugname, typelist, varargAnnotation, hasEnd, argLocation);
+
+    if (options.skipFunctionBodies)
+        skippedFunctions.push_back({function, scope});
+
+    return {function, funLocal};
+}
+
+// returns true if the lexeme can only be followed by an expression
+static bool isExpressionPrefix(Lexeme::Type type)
+{
+    // lexemes that represent single characters aren't a part of the enum
+    switch (int(type))
+    {
+    case '=':
+    case ',':
+    case '+':
+    case '-':
+    case '*':
+    case '/':
+    case '%':
+    case '^':
+    case '#':
+    case '<':
+    case Lexeme::Equal:
+    case Lexeme::LessEqual:
+    case Lexeme::GreaterEqual:
+    case Lexeme::NotEqual:
+    case Lexeme::Dot2:
+    case Lexeme::AddAssign:
+    case Lexeme::SubAssign:
+    case Lexeme::MulAssign:
+    case Lexeme::DivAssign:
+    case Lexeme::ModAssign:
+    case Lexeme::PowAssign:
+    case Lexeme::ConcatAssign:
+    case Lexeme::ReservedAnd:
+    case Lexeme::ReservedOr:
+    case Lexeme::ReservedNot:
+    case Lexeme::ReservedIf:
+    case Lexeme::ReservedElseif:
+    case Lexeme::ReservedWhile:
+    case Lexeme::ReservedUntil:
+    case Lexeme::ReservedIn:
+    case Lexeme::ReservedReturn:
+        return true;
+
+    // '>' also closes generic type lists, as in 'type T = Array<number>', which can be followed by a statement
+    default:
+        return false;
+    }
+}
+
+AstStatBlock* Parser::skipFunctionBody()
+{
+    const Position prevPosition = lexer.previousLocation().end;
+
+    // every open construct is tracked by the lexeme that closes it; 'if' expressions don't have an 'end' and are closed by their 'else' branch
+    std::vector<Lexeme::Type>& open = scratchSkip;
+    open.clear();
+
+    Lexeme::Type prev = Lexeme::ReservedEnd;
+    bool elseExpression = false;
+
+    while (lexer.current().type != Lexeme::Eof)
+    {
+        Lexeme::Type type = lexer.current().type;
+        Lexeme::Type closer = open.empty() ? Lexeme::ReservedEnd : open.back();
+
+        // 'if' starts an expression inside brackets and other 'if' expressions, in the 'else' branch of an 'if' expression and after operators
+        bool expression = (closer != Lexeme::ReservedEnd && closer != Lexeme::ReservedUntil) || elseExpression || isExpressionPrefix(prev);
+
+        elseExpression = false;
+
+        switch (int(type))
+        {
+        case Lexeme::ReservedEnd:
+        case Lexeme::ReservedUntil:
+        case ')':
+        case ']':
+        case '}':
+        case Lexeme::InterpStringEnd:
+            // the body ends at the first unmatched 'end'; other unmatched lexemes are syntax errors that are reported by the caller
+            if (open.empty() || closer != type)
+                return allocator.alloc<AstStatBlock>(Location(prevPosition, lexer.current().location.begin), copy<AstStat*>(nullptr, 0));
+
+            open.pop_back();
+            break;
+
+        case Lexeme::ReservedFunction:
+        case Lexeme::ReservedDo:
+            open.push_back(Lexeme::ReservedEnd);
+            break;
+
+        case Lexeme::ReservedIf:
+            open.push_back(expression ? Lexeme::ReservedElse : Lexeme::ReservedEnd);
+            break;
+
+        case Lexeme::ReservedRepeat:
+            open.push_back(Lexeme::ReservedUntil);
+            break;
+
+        case Lexeme::ReservedElse:
+            if (closer == Lexeme::ReservedElse)
+            {
+                open.pop_back();
+                elseExpression = true;
+            }
+            break;
+
+        case '(':
+            open.push_back(Lexeme::Type(')'));
+            break;
+
+        case '[':
+            open.push_back(Lexeme::Type(']'));
+            break;
+
+        case '{':
+            open.push_back(Lexeme::Type('}'));
+            break;
+
+        case Lexeme::InterpStringBegin:
+            open.push_back(Lexeme::InterpStringEnd);
+            break;
+
+        default:
+            break;
+        }
+
+        prev = type;
+        nextLexeme();
+    }
+
+    return allocator.alloc<AstStatBlock>(Location(prevPosition, lexer.current().location.begin), copy<AstStat*>(nullptr, 0));
+}
+
+void Parser::parseSkippedFunction(const char* buffer, size_t bufferSize, ParseResult& result, SkippedFunction skipped, AstNameTable& names,
+    Allocator& allocator, ParseOptions options)
+{
+    LUAU_TIMETRACE_SCOPE("Parser::parseSkippedFunction", "Parser");
+
+    AstExprFunction* function = skipped.function;
+
+    Parser p(buffer, bufferSize, names, allocator, options);
+
+    try
+    {
+        // enclosing functions are only needed for the depth of the locals declared in the body
+        for (size_t i = 1; i < function->functionDepth; ++i)
+            p.functionStack.push_back(Function());
+
+        Function fun;
+        fun.vararg = function->vararg;
+
+        p.functionStack.push_back(fun);
+
+        for (AstLocal* local : skipped.scope)
+            p.bindLocal(local);
+
+        // comments in the body were captured when it was skipped
+        p.lexer.seek(function->body->location.begin);
+        p.hotcommentHeader = false;
+        p.nextLexeme();
+
+        AstStatBlock* body = p.parseBlock();
+
+        p.expectMatchEndAndConsume(Lexeme::ReservedEnd, Lexeme(Location(function->location.begin, 0), Lexeme::ReservedFunction));
+
+        // see Parser::parse
+        if (options.skipFunctionBodies && !p.parseErrors.empty())
+        {
+            options.skipFunctionBodies = false;
+            return parseSkippedFunction(buffer, bufferSize, result, skipped, names, allocator, options);
+        }
+
+        function->body = body;
+    }
+    catch (ParseError& err)
+    {
+        if (options.skipFunctionBodies)
+        {
+            options.skipFunctionBodies = false;
+            return parseSkippedFunction(buffer, bufferSize, result, skipped, names, allocator, options);
+        }
+
+        p.parseErrors.push_back(err);
+    }
+
+    result.errors.insert(result.errors.end(), p.parseErrors.begin(), p.parseErrors.end());
+    result.skippedFunctions.insert(result.skippedFunctions.end(), p.skippedFunctions.begin(), p.skippedFunctions.end());
 }
 
 // explist ::= {exp `,'} exp
@@ -2757,6 +3661,12 @@ AstLocal* Parser::pushLocal(const Binding& binding)
     return local;
 }
 
+void Parser::bindLocal(AstLocal* local)
+{
+    localMap[local->name] = local;
+    localStack.push_back(local);
+}
+
 unsigned int Parser::saveLocals()
 {
     return unsigned(localStack.size());
@@ -13,6 +13,8 @@
 #include <valgrind/callgrind.h>
 #endif
 
+#include <thread>
+
 LUAU_FASTFLAG(DebugLuauTimeTracing)
 
 enum class ReportFormat
@@ -95,9 +97,9 @@ static bool analyzeFile(Luau::Frontend& frontend, const char* name, ReportFormat
 
         Luau::attachTypeData(*sm, *m);
 
-        std::string annotated = Luau::transpileWithTypes(*sm->root);
-
-        printf("%s", annotated.c_str());
+        Luau::transpileWithTypes(*sm->root, [](std::string_view chunk) {
+            fwrite(chunk.data(), 1, chunk.size(), stdout);
+        });
     }
 
     return cr.errors.empty() && lr.errors.empty();
@@ -116,6 +118,7 @@ static void displayHelp(const char* argv0)
     printf("  --formatter=gnu: report analysis errors in GNU-compatible format\n");
     printf("  --mode=strict: default to strict mode when typechecking\n");
     printf("  --timetrace: record compiler time tracing information into trace.json\n");
+    printf("  -j<n>: typecheck independent modules in parallel using n threads (default 1, 0 uses all cores)\n");
 }
 
 static int assertionHandler(const char* expr, const char* file, int line, const char* function)
@@ -139,6 +142,15 @@ struct CliFileResolver : Luau::FileResolver
         }
         else
         {
+            // files are parsed straight from a memory mapping when possible to avoid copying them
+            if (std::optional<MappedFile> file = mapFile(name))
+            {
+                std::shared_ptr<MappedFile> storage = std::make_shared<MappedFile>(std::move(*file));
+                std::string_view view = storage->contents();
+
+                return Luau::SourceCode{{}, Luau::SourceCode::Module, std::move(storage), view};
+            }
+
             source = readFile(name);
             sourceType = Luau::SourceCode::Module;
         }
@@ -154,7 +166,7 @@ struct CliFileResolver : Luau::FileResolver
         if (Luau::AstExprConstantString* expr = node->as<Luau::AstExprConstantString>())
         {
             Luau::ModuleName name = std::string(expr->value.data, expr->value.size) + ".luau";
-            if (!readFile(name))
+            if (!mapFile(name))
             {
                 // fall back to .lua if a module with .luau doesn't exist
                 name = std::string(expr->value.data, expr->value.size) + ".lua";
@@ -232,6 +244,7 @@ int main(int argc, char** argv)
     ReportFormat format = ReportFormat::Default;
     Luau::Mode mode = Luau::Mode::Nonstrict;
     bool annotate = false;
+    unsigned int threads = 1;
 
     for (int i = 1; i < argc; ++i)
     {
@@ -250,6 +263,17 @@ int main(int argc, char** argv)
             FFlag::DebugLuauTimeTracing.value = true;
         else if (strncmp(argv[i], "--fflags=", 9) == 0)
             setLuauFlags(argv[i] + 9);
+        else if (strncmp(argv[i], "-j", 2) == 0)
+        {
+            char* end = nullptr;
+            long count = strtol(argv[i] + 2, &end, 10);
+            if (end == argv[i] + 2 || *end != '\0' || count < 0)
+            {
+                fprintf(stderr, "Error: Thread count must be a non-negative integer.\n");
+                return 1;
+            }
+            threads = count == 0 ? std::max(1u, std::thread::hardware_concurrency()) : unsigned(count);
+        }
     }
 
 #if !defined(LUAU_ENABLE_TIME_TRACE)
@@ -262,6 +286,7 @@ int main(int argc, char** argv)
 
     Luau::FrontendOptions frontendOptions;
     frontendOptions.retainFullTypeGraphs = annotate;
+    frontendOptions.typecheckThreads = threads;
 
     CliFileResolver fileResolver;
     CliConfigResolver configResolver(mode);
@@ -1,11 +1,14 @@
 // This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
 #include <optional>
+#include <thread>
 
 #include "Luau/Common.h"
 #include "Luau/Ast.h"
 #include "Luau/AstJsonEncoder.h"
+#include "Luau/AstSerializer.h"
 #include "Luau/Parser.h"
 #include "Luau/ParseOptions.h"
+#include "Luau/TimeTrace.h"
 #include "Luau/ToString.h"
 
 #include "FileUtils.h"
@@ -13,6 +16,14 @@
 static void displayHelp(const char* argv0)
 {
     printf("Usage: %s [file]\n", argv0);
+    printf("       %s --lex [files]\n", argv0);
+    printf("       %s --parse [-j<n>] [files]\n", argv0);
+    printf("       %s --serialize [files]\n", argv0);
+    printf("\n");
+    printf("--lex: measure lexer throughput by reading all lexemes of the files until at least a second has passed\n");
+    printf("--parse: parse the files, report syntax errors and measure parser throughput\n");
+    printf("  -j<n>: parse files in parallel using n threads (default 1, 0 uses all cores)\n");
+    printf("--serialize: check that the binary encoding of each file's AST decodes to the same tree and compare decoding with parsing throughput\n");
 }
 
 static int assertionHandler(const char* expr, const char* file, int line, const char* function)
@@ -21,6 +32,210 @@ static int assertionHandler(const char* expr, const char* file, int line, const
     return 1;
 }
 
+static int lexFiles(int argc, char** argv)
+{
+    std::vector<std::string> sources;
+    size_t totalSize = 0;
+
+    for (int i = 2; i < argc; ++i)
+    {
+        std::optional<std::string> source = readFile(argv[i]);
+
+        if (!source)
+        {
+            fprintf(stderr, "Couldn't read source %s\n", argv[i]);
+            return 1;
+        }
+
+        totalSize += source->size();
+        sources.push_back(std::move(*source));
+    }
+
+    Luau::Allocator allocator;
+    Luau::AstNameTable names(allocator);
+
+    size_t lexemes = 0;
+    int runs = 0;
+
+    double start = Luau::TimeTrace::getClock();
+    double elapsed = 0;
+
+    do
+    {
+        for (const std::string& source : sources)
+        {
+            Luau::Lexer lexer(source.data(), source.size(), names);
+
+            while (lexer.next().type != Luau::Lexeme::Eof)
+                lexemes++;
+        }
+
+        runs++;
+        elapsed = Luau::TimeTrace::getClock() - start;
+    } while (elapsed < 1.0);
+
+    double megabytes = double(totalSize) * runs / (1024 * 1024);
+
+    printf("Lexed %.2f MB (%zu lexemes) in %.3fs: %.1f MB/s\n", megabytes, lexemes, elapsed, megabytes / elapsed);
+
+    return 0;
+}
+
+static int parseFiles(int argc, char** argv)
+{
+    std::vector<std::string> files;
+    std::vector<std::optional<MappedFile>> mappedSources;
+    std::vector<std::string> readSources;
+    size_t totalSize = 0;
+    unsigned int threads = 1;
+
+    for (int i = 2; i < argc; ++i)
+    {
+        if (strncmp(argv[i], "-j", 2) == 0)
+        {
+            char* end = nullptr;
+            long count = strtol(argv[i] + 2, &end, 10);
+            if (end == argv[i] + 2 || *end != '\0' || count < 0)
+            {
+                fprintf(stderr, "Error: Thread count must be a non-negative integer.\n");
+                return 1;
+            }
+            threads = count == 0 ? std::max(1u, std::thread::hardware_concurrency()) : unsigned(count);
+            continue;
+        }
+
+        // files are parsed straight from a memory mapping when possible to avoid copying them
+        std::optional<MappedFile> mappedSource = mapFile(argv[i]);
+        std::optional<std::string> readSource = mappedSource ? std::string() : readFile(argv[i]);
+
+        if (!readSource)
+        {
+            fprintf(stderr, "Couldn't read source %s\n", argv[i]);
+            return 1;
+        }
+
+        totalSize += mappedSource ? mappedSource->contents().size() : readSource->size();
+        files.push_back(argv[i]);
+        mappedSources.push_back(std::move(mappedSource));
+        readSources.push_back(std::move(*readSource));
+    }
+
+    Luau::ParseOptions options;
+    options.allowDeclarationSyntax = true;
+
+    Luau::Allocator allocator;
+    Luau::AstNameTable names(allocator);
+
+    // views are taken once all files have been read, since short strings don't keep their address when the vector grows
+    std::vector<std::string_view> views;
+
+    for (size_t i = 0; i < files.size(); ++i)
+        views.push_back(mappedSources[i] ? mappedSources[i]->contents() : std::string_view(readSources[i]));
+
+    double start = Luau::TimeTrace::getClock();
+    std::vector<Luau::BatchParseResult> results = Luau::Parser::parseBatch(views, threads, &names, options);
+    double elapsed = Luau::TimeTrace::getClock() - start;
+
+    int failed = 0;
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        for (const Luau::ParseError& error : results[i].result.errors)
+        {
+            const Luau::Location& location = error.getLocation();
+            fprintf(stderr, "%s(%d,%d): SyntaxError: %s\n", files[i].c_str(), location.begin.line + 1, location.begin.column + 1,
+                error.getMessage().c_str());
+        }
+
+        failed += !results[i].result.errors.empty();
+    }
+
+    double megabytes = double(totalSize) / (1024 * 1024);
+
+    printf("Parsed %.2f MB in %.3fs using %u threads: %.1f MB/s\n", megabytes, elapsed, threads, elapsed > 0 ? megabytes / elapsed : 0.0);
+
+    return failed ? 1 : 0;
+}
+
+static int serializeFiles(int argc, char** argv)
+{
+    std::vector<std::string> sources;
+    std::vector<std::string> encoded;
+    size_t totalSize = 0;
+    size_t encodedSize = 0;
+    int failed = 0;
+
+    Luau::ParseOptions options;
+    options.allowDeclarationSyntax = true;
+    options.captureComments = true;
+
+    for (int i = 2; i < argc; ++i)
+    {
+        std::optional<std::string> source = readFile(argv[i]);
+
+        if (!source)
+        {
+            fprintf(stderr, "Couldn't read source %s\n", argv[i]);
+            return 1;
+        }
+
+        Luau::Allocator allocator;
+        Luau::AstNameTable names(allocator);
+
+        Luau::ParseResult result = Luau::Parser::parse(source->data(), source->size(), names, allocator, options);
+        std::string data = Luau::serializeParseResult(result, source->data(), source->size());
+
+        Luau::Allocator decodedAllocator;
+        Luau::AstNameTable decodedNames(decodedAllocator);
+
+        std::optional<Luau::ParseResult> decoded =
+            Luau::deserializeParseResult(data.data(), data.size(), source->data(), source->size(), decodedNames, decodedAllocator);
+
+        if (!decoded || Luau::toJson(decoded->root, decoded->commentLocations) != Luau::toJson(result.root, result.commentLocations))
+        {
+            fprintf(stderr, "%s: decoded AST doesn't match the parsed AST\n", argv[i]);
+            failed++;
+            continue;
+        }
+
+        totalSize += source->size();
+        encodedSize += data.size();
+        sources.push_back(std::move(*source));
+        encoded.push_back(std::move(data));
+    }
+
+    double parseTime = 0;
+    double decodeTime = 0;
+    int runs = 0;
+
+    do
+    {
+        for (size_t i = 0; i < sources.size(); ++i)
+        {
+            Luau::Allocator allocator;
+            Luau::AstNameTable names(allocator);
+
+            double start = Luau::TimeTrace::getClock();
+            Luau::Parser::parse(sources[i].data(), sources[i].size(), names, allocator, options);
+            double parsed = Luau::TimeTrace::getClock();
+            Luau::deserializeParseResult(encoded[i].data(), encoded[i].size(), sources[i].data(), sources[i].size(), names, allocator);
+            double decoded = Luau::TimeTrace::getClock();
+
+            parseTime += parsed - start;
+            decodeTime += decoded - parsed;
+        }
+
+        runs++;
+    } while (parseTime + decodeTime < 1.0 && !sources.empty());
+
+    double megabytes = double(totalSize) * runs / (1024 * 1024);
+
+    printf("Encoded %.2f MB of source into %.2f MB; parsed at %.1f MB/s, decoded at %.1f MB/s of source\n", double(totalSize) / (1024 * 1024),
+        double(encodedSize) / (1024 * 1024), parseTime > 0 ? megabytes / parseTime : 0.0, decodeTime > 0 ? megabytes / decodeTime : 0.0);
+
+    return failed ? 1 : 0;
+}
+
 int main(int argc, char** argv)
 {
     Luau::assertHandler() = assertionHandler;
@@ -34,6 +249,18 @@ int main(int argc, char** argv)
         displayHelp(argv[0]);
         return 0;
     }
+    else if (argc >= 2 && strcmp(argv[1], "--lex") == 0)
+    {
+        return lexFiles(argc, argv);
+    }
+    else if (argc >= 2 && strcmp(argv[1], "--parse") == 0)
+    {
+        return parseFiles(argc, argv);
+    }
+    else if (argc >= 2 && strcmp(argv[1], "--serialize") == 0)
+    {
+        return serializeFiles(argc, argv);
+    }
     else if (argc < 2)
     {
         displayHelp(argv[0]);
@@ -80,7 +307,9 @@ int main(int argc, char** argv)
         fprintf(stderr, "\n");
     }
 
-    printf("%s", Luau::toJson(parseResult.root, parseResult.commentLocations).c_str());
+    Luau::toJson(parseResult.root, parseResult.commentLocations, [](std::string_view chunk) {
+        fwrite(chunk.data(), 1, chunk.size(), stdout);
+    });
 
     return parseResult.errors.size() > 0 ? 1 : 0;
 }
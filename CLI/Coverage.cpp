@@ -3,15 +3,23 @@
 
 #include "lua.h"
 
+#include <algorithm>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include <stdlib.h>
+#include <string.h>
+
 struct Coverage
 {
     lua_State* L = nullptr;
     std::vector<int> functions;
 } gCoverage;
 
+// source name => hit count for each line, -1 if the line wasn't recorded
+std::unordered_map<std::string, std::vector<int>> gProfile;
+
 void coverageInit(lua_State* L)
 {
     gCoverage.L = lua_mainthread(L);
@@ -86,3 +94,59 @@ void coverageDump(const char* path)
 
     printf("Coverage dump written to %s (%d functions)\n", path, int(gCoverage.functions.size()));
 }
+
+bool coverageLoadProfile(const char* path)
+{
+    FILE* f = fopen(path, "r");
+    if (!f)
+    {
+        fprintf(stderr, "Error opening coverage %s\n", path);
+        return false;
+    }
+
+    std::vector<int>* hits = nullptr;
+    char buf[1024];
+
+    while (fgets(buf, sizeof(buf), f))
+    {
+        if (strncmp(buf, "SF:", 3) == 0)
+        {
+            std::string name = buf + 3;
+
+            while (!name.empty() && (name.back() == '\n' || name.back() == '\r'))
+                name.pop_back();
+
+            hits = &gProfile[name];
+        }
+        else if (strncmp(buf, "DA:", 3) == 0 && hits)
+        {
+            char* end = nullptr;
+            int line = int(strtol(buf + 3, &end, 10));
+
+            if (line < 0 || *end != ',')
+                continue;
+
+            int count = int(strtol(end + 1, nullptr, 10));
+
+            if (size_t(line) >= hits->size())
+                hits->resize(line + 1, -1);
+
+            // the same line can be recorded in multiple functions, for example when a function is inlined
+            (*hits)[line] = std::max((*hits)[line], 0) + count;
+        }
+        else if (strncmp(buf, "end_of_record", 13) == 0)
+        {
+            hits = nullptr;
+        }
+    }
+
+    fclose(f);
+    return true;
+}
+
+const std::vector<int>* coverageGetProfile(const char* source)
+{
+    auto it = gProfile.find(source);
+
+    return it == gProfile.end() ? nullptr : &it->second;
+}
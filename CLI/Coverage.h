@@ -1,6 +1,8 @@
 // This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
 #pragma once
 
+#include <vector>
+
 struct lua_State;
 
 void coverageInit(lua_State* L);
@@ -8,3 +10,7 @@ bool coverageActive();
 
 void coverageTrack(lua_State* L, int funcindex);
 void coverageDump(const char* path);
+
+// loads per-line hit counts from a coverage file produced by coverageDump so that they can be used as an execution profile
+bool coverageLoadProfile(const char* path);
+const std::vector<int>* coverageGetProfile(const char* source);
@@ -15,10 +15,12 @@
 #include <dirent.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #endif
 
 #include <string.h>
+#include <utility>
 
 #ifdef _WIN32
 static std::wstring fromUtf8(const std::string& path)
@@ -94,6 +96,119 @@ std::optional<std::string> readStdin()
     return result;
 }
 
+MappedFile::~MappedFile()
+{
+    if (!mapped)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<char*>(data), size);
+#endif
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data(other.data)
+    , size(other.size)
+    , offset(other.offset)
+    , mapped(other.mapped)
+{
+    other.mapped = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    // the previous mapping is released when the other object is destroyed
+    std::swap(data, other.data);
+    std::swap(size, other.size);
+    std::swap(offset, other.offset);
+    std::swap(mapped, other.mapped);
+
+    return *this;
+}
+
+std::optional<MappedFile> mapFile(const std::string& name)
+{
+    MappedFile result;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(fromUtf8(name).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return std::nullopt;
+
+    LARGE_INTEGER length = {};
+    if (!GetFileSizeEx(file, &length))
+    {
+        CloseHandle(file);
+        return std::nullopt;
+    }
+
+    // empty files can't be mapped
+    if (length.QuadPart > 0)
+    {
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+        if (mapping)
+            CloseHandle(mapping);
+
+        if (!view)
+        {
+            CloseHandle(file);
+            return std::nullopt;
+        }
+
+        result.data = static_cast<const char*>(view);
+        result.size = size_t(length.QuadPart);
+        result.mapped = true;
+    }
+
+    CloseHandle(file);
+#else
+    int fd = open(name.c_str(), O_RDONLY);
+
+    if (fd < 0)
+        return std::nullopt;
+
+    struct stat st = {};
+    if (fstat(fd, &st) != 0 || (st.st_mode & S_IFMT) != S_IFREG)
+    {
+        close(fd);
+        return std::nullopt;
+    }
+
+    // empty files can't be mapped
+    if (st.st_size > 0)
+    {
+        void* view = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (view == MAP_FAILED)
+        {
+            close(fd);
+            return std::nullopt;
+        }
+
+        result.data = static_cast<const char*>(view);
+        result.size = size_t(st.st_size);
+        result.mapped = true;
+    }
+
+    // the mapping keeps a reference to the file
+    close(fd);
+#endif
+
+    // Skip first line if it's a shebang
+    if (result.size > 2 && result.data[0] == '#' && result.data[1] == '!')
+    {
+        const char* newline = static_cast<const char*>(memchr(result.data, '\n', result.size));
+        result.offset = newline ? newline - result.data : result.size;
+    }
+
+    return result;
+}
+
 template<typename Ch>
 static void joinPaths(std::basic_string<Ch>& str, const Ch* lhs, const Ch* rhs)
 {
@@ -3,12 +3,44 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <functional>
 #include <vector>
 
 std::optional<std::string> readFile(const std::string& name);
 std::optional<std::string> readStdin();
 
+// Read-only memory mapping of a file that avoids copying its contents; the contents are valid until the mapping is destroyed
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Like readFile, skips the first line if it's a shebang but keeps its line break so that line numbers don't change
+    std::string_view contents() const
+    {
+        return std::string_view(data + offset, size - offset);
+    }
+
+private:
+    friend std::optional<MappedFile> mapFile(const std::string& name);
+
+    const char* data = "";
+    size_t size = 0;
+    size_t offset = 0;
+    bool mapped = false;
+};
+
+// Returns std::nullopt if the file can't be opened or mapped, for example when it's a pipe; readFile can be used as a fallback
+std::optional<MappedFile> mapFile(const std::string& name);
+
 bool isDirectory(const std::string& path);
 bool traverseDirectory(const std::string& path, const std::function<void(const std::string& name)>& callback);
 
@@ -16,7 +16,10 @@
 
 #include "isocline.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #ifdef _WIN32
 #include <io.h>
@@ -60,6 +63,9 @@ constexpr int MaxTraversalLimit = 50;
 
 static bool codegen = false;
 
+// compile files together with the modules they require into a single chunk
+static bool bundle = false;
+
 // Ctrl-C handling
 static void sigintCallback(lua_State* L, int gc)
 {
@@ -93,6 +99,7 @@ struct GlobalOptions
 {
     int optimizationLevel = 1;
     int debugLevel = 1;
+    int typeInfoLevel = 0;
 } globalOptions;
 
 static Luau::CompileOptions copts()
@@ -101,6 +108,21 @@ static Luau::CompileOptions copts()
     result.optimizationLevel = globalOptions.optimizationLevel;
     result.debugLevel = globalOptions.debugLevel;
     result.coverageLevel = coverageActive() ? 2 : 0;
+    result.typeInfoLevel = globalOptions.typeInfoLevel;
+
+    return result;
+}
+
+static Luau::CompileOptions copts(const std::string& chunkname)
+{
+    Luau::CompileOptions result = copts();
+
+    // use execution profile recorded for the chunk to guide inlining and loop unrolling decisions
+    if (const std::vector<int>* hits = coverageGetProfile(chunkname.c_str()))
+    {
+        result.profileLineHits = hits->data();
+        result.profileLineCount = int(hits->size());
+    }
 
     return result;
 }
@@ -113,7 +135,7 @@ static int lua_loadstring(lua_State* L)
 
     lua_setsafeenv(L, LUA_ENVIRONINDEX, false);
 
-    std::string bytecode = Luau::compile(std::string(s, l), copts());
+    std::string bytecode = Luau::compile(std::string_view(s, l), copts());
     if (luau_load(L, chunkname, bytecode.data(), bytecode.size(), 0) == 0)
         return 1;
 
@@ -165,7 +187,7 @@ static int lua_require(lua_State* L)
     luaL_sandboxthread(ML);
 
     // now we can compile & run module on the new thread
-    std::string bytecode = Luau::compile(*source, copts());
+    std::string bytecode = Luau::compile(*source, copts(name));
     if (luau_load(ML, chunkname.c_str(), bytecode.data(), bytecode.size(), 0) == 0)
     {
         if (codegen)
@@ -599,6 +621,129 @@ static void runRepl()
     runReplImpl(L);
 }
 
+static void report(const char* name, const Luau::Location& location, const char* type, const char* message)
+{
+    fprintf(stderr, "%s(%d,%d): %s: %s\n", name, location.begin.line + 1, location.begin.column + 1, type, message);
+}
+
+static void reportError(const char* name, const Luau::ParseError& error)
+{
+    report(name, error.getLocation(), "SyntaxError", error.what());
+}
+
+static void reportError(const char* name, const Luau::CompileError& error)
+{
+    report(name, error.getLocation(), "CompileError", error.what());
+}
+
+struct RequireVisitor : Luau::AstVisitor
+{
+    std::vector<std::string> names;
+
+    bool visit(Luau::AstExprCall* node) override
+    {
+        Luau::AstExprGlobal* func = node->func->as<Luau::AstExprGlobal>();
+        Luau::AstExprConstantString* arg = node->args.size == 1 ? node->args.data[0]->as<Luau::AstExprConstantString>() : nullptr;
+
+        if (func && func->name == "require" && arg)
+            names.emplace_back(arg->value.data, arg->value.size);
+
+        return true;
+    }
+};
+
+struct BundleSource
+{
+    Luau::Allocator allocator;
+    Luau::AstNameTable names{allocator};
+
+    std::vector<Luau::BundleModule> modules;
+    size_t lines = 0;
+};
+
+static bool parseBundleModule(
+    BundleSource& bundle, const std::string& module, const std::string& path, std::string_view source, std::vector<std::string>& requires)
+{
+    Luau::ParseResult result = Luau::Parser::parse(source.data(), source.size(), bundle.names, bundle.allocator);
+
+    if (!result.errors.empty())
+    {
+        for (auto& error : result.errors)
+            reportError(path.c_str(), error);
+        return false;
+    }
+
+    bundle.lines += result.lines;
+    bundle.modules.push_back({module, result.root});
+
+    RequireVisitor visitor;
+    result.root->visit(&visitor);
+
+    requires.insert(requires.end(), visitor.names.begin(), visitor.names.end());
+    return true;
+}
+
+// parses the file along with all modules that it requires by name; modules are resolved to files the same way lua_require does
+static bool parseBundle(BundleSource& bundle, const char* name, std::string_view source)
+{
+    std::vector<std::string> pending;
+
+    if (!parseBundleModule(bundle, name, name, source, pending))
+        return false;
+
+    Luau::DenseHashSet<std::string> visited{""};
+
+    while (!pending.empty())
+    {
+        std::string module = pending.back();
+        pending.pop_back();
+
+        if (visited.contains(module))
+            continue;
+
+        visited.insert(module);
+
+        std::string path = module + ".luau";
+        std::optional<std::string> moduleSource = readFile(path);
+
+        if (!moduleSource)
+        {
+            path = module + ".lua";
+            moduleSource = readFile(path);
+        }
+
+        // modules that can't be found are left to be required at runtime
+        if (!moduleSource)
+            continue;
+
+        if (!parseBundleModule(bundle, module, path, *moduleSource, pending))
+            return false;
+    }
+
+    return true;
+}
+
+static std::optional<std::string> compileBundle(const char* name, const std::string& source)
+{
+    BundleSource bundle;
+
+    if (!parseBundle(bundle, name, source))
+        return std::nullopt;
+
+    try
+    {
+        Luau::BytecodeBuilder bcb;
+        Luau::compileBundleOrThrow(bcb, bundle.modules, bundle.names, copts());
+
+        return bcb.getBytecode();
+    }
+    catch (Luau::CompileError& e)
+    {
+        reportError(name, e);
+        return std::nullopt;
+    }
+}
+
 // `repl` is used it indicate if a repl should be started after executing the file.
 static bool runFile(const char* name, lua_State* GL, bool repl)
 {
@@ -609,6 +754,21 @@ static bool runFile(const char* name, lua_State* GL, bool repl)
         return false;
     }
 
+    std::string bytecode;
+
+    if (bundle)
+    {
+        std::optional<std::string> result = compileBundle(name, *source);
+        if (!result)
+            return false;
+
+        bytecode = std::move(*result);
+    }
+    else
+    {
+        bytecode = Luau::compile(*source, copts(name));
+    }
+
     // module needs to run in a new thread, isolated from the rest
     lua_State* L = lua_newthread(GL);
 
@@ -617,7 +777,6 @@ static bool runFile(const char* name, lua_State* GL, bool repl)
 
     std::string chunkname = "=" + std::string(name);
 
-    std::string bytecode = Luau::compile(*source, copts());
     int status = 0;
 
     if (luau_load(L, chunkname.c_str(), bytecode.data(), bytecode.size(), 0) == 0)
@@ -662,21 +821,6 @@ static bool runFile(const char* name, lua_State* GL, bool repl)
     return status == 0;
 }
 
-static void report(const char* name, const Luau::Location& location, const char* type, const char* message)
-{
-    fprintf(stderr, "%s(%d,%d): %s: %s\n", name, location.begin.line + 1, location.begin.column + 1, type, message);
-}
-
-static void reportError(const char* name, const Luau::ParseError& error)
-{
-    report(name, error.getLocation(), "SyntaxError", error.what());
-}
-
-static void reportError(const char* name, const Luau::CompileError& error)
-{
-    report(name, error.getLocation(), "CompileError", error.what());
-}
-
 static std::string getCodegenAssembly(const char* name, const std::string& bytecode, Luau::CodeGen::AssemblyOptions options)
 {
     std::unique_ptr<lua_State, void (*)(lua_State*)> globalState(luaL_newstate(), lua_close);
@@ -699,19 +843,47 @@ static void annotateInstruction(void* context, std::string& text, int fid, int i
 struct CompileStats
 {
     size_t lines;
+    size_t source;
     size_t bytecode;
     size_t codegen;
+
+    // time spent in each phase; when compiling in parallel, this is the sum over all threads
+    double readTime;
+    double parseTime;
+    double compileTime;
+
+    void add(const CompileStats& other)
+    {
+        lines += other.lines;
+        source += other.source;
+        bytecode += other.bytecode;
+        codegen += other.codegen;
+        readTime += other.readTime;
+        parseTime += other.parseTime;
+        compileTime += other.compileTime;
+    }
 };
 
-static bool compileFile(const char* name, CompileFormat format, CompileStats& stats)
+// output is accumulated in a string so that files compiled in parallel can be printed in order
+static bool compileFile(const char* name, CompileFormat format, CompileStats& stats, std::string& output)
 {
-    std::optional<std::string> source = readFile(name);
-    if (!source)
+    double readStart = lua_clock();
+
+    // files are compiled straight from a memory mapping when possible to avoid copying them
+    std::optional<MappedFile> mappedSource = mapFile(name);
+    std::optional<std::string> readSource = mappedSource ? std::nullopt : readFile(name);
+
+    if (!mappedSource && !readSource)
     {
         fprintf(stderr, "Error opening %s\n", name);
         return false;
     }
 
+    std::string_view source = mappedSource ? mappedSource->contents() : std::string_view(*readSource);
+
+    stats.readTime += lua_clock() - readStart;
+    stats.source += source.size();
+
     // NOTE: Normally, you should use Luau::compile or luau_compile (see lua_require as an example)
     // This function is much more complicated because it supports many output human-readable formats through internal interfaces
 
@@ -732,53 +904,89 @@ static bool compileFile(const char* name, CompileFormat format, CompileStats& st
         options.annotator = annotateInstruction;
         options.annotatorContext = &bcb;
 
+        // line information in a bundle refers to multiple source files, so we can't print source lines
+        Luau::CompileOptions compileOptions = bundle ? copts() : copts(name);
+        uint32_t dumpSource = bundle ? 0 : Luau::BytecodeBuilder::Dump_Source;
+
         if (format == CompileFormat::Text)
         {
-            bcb.setDumpFlags(Luau::BytecodeBuilder::Dump_Code | Luau::BytecodeBuilder::Dump_Source | Luau::BytecodeBuilder::Dump_Locals |
-                             Luau::BytecodeBuilder::Dump_Remarks);
-            bcb.setDumpSource(*source);
+            bcb.setDumpFlags(Luau::BytecodeBuilder::Dump_Code | dumpSource | Luau::BytecodeBuilder::Dump_Locals | Luau::BytecodeBuilder::Dump_Remarks);
+            bcb.setDumpSource(source);
         }
         else if (format == CompileFormat::Remarks)
         {
-            bcb.setDumpFlags(Luau::BytecodeBuilder::Dump_Source | Luau::BytecodeBuilder::Dump_Remarks);
-            bcb.setDumpSource(*source);
+            bcb.setDumpFlags(dumpSource | Luau::BytecodeBuilder::Dump_Remarks);
+            bcb.setDumpSource(source);
         }
         else if (format == CompileFormat::Codegen || format == CompileFormat::CodegenAsm || format == CompileFormat::CodegenIr ||
                  format == CompileFormat::CodegenVerbose)
         {
-            bcb.setDumpFlags(Luau::BytecodeBuilder::Dump_Code | Luau::BytecodeBuilder::Dump_Source | Luau::BytecodeBuilder::Dump_Locals |
-                             Luau::BytecodeBuilder::Dump_Remarks);
-            bcb.setDumpSource(*source);
+            bcb.setDumpFlags(Luau::BytecodeBuilder::Dump_Code | dumpSource | Luau::BytecodeBuilder::Dump_Locals | Luau::BytecodeBuilder::Dump_Remarks |
+                             Luau::BytecodeBuilder::Dump_Types);
+            bcb.setDumpSource(source);
+
+            // native code generation uses argument types to specialize function code
+            compileOptions.typeInfoLevel = 1;
         }
 
-        Luau::Allocator allocator;
-        Luau::AstNameTable names(allocator);
-        Luau::ParseResult result = Luau::Parser::parse(source->c_str(), source->size(), names, allocator);
+        if (bundle)
+        {
+            BundleSource bundleSource;
+
+            double parseStart = lua_clock();
+
+            // modules are read while the bundle is parsed, so reading time is included in parsing time
+            if (!parseBundle(bundleSource, name, source))
+                return false;
+
+            double compileStart = lua_clock();
+
+            stats.lines += bundleSource.lines;
+
+            Luau::compileBundleOrThrow(bcb, bundleSource.modules, bundleSource.names, compileOptions);
+
+            stats.parseTime += compileStart - parseStart;
+            stats.compileTime += lua_clock() - compileStart;
+        }
+        else
+        {
+            double parseStart = lua_clock();
 
-        if (!result.errors.empty())
-            throw Luau::ParseErrors(result.errors);
+            Luau::Allocator allocator;
+            Luau::AstNameTable names(allocator);
+            Luau::ParseResult result = Luau::Parser::parse(source.data(), source.size(), names, allocator);
 
-        stats.lines += result.lines;
+            if (!result.errors.empty())
+                throw Luau::ParseErrors(result.errors);
+
+            double compileStart = lua_clock();
+
+            stats.lines += result.lines;
+
+            Luau::compileOrThrow(bcb, result, names, compileOptions);
+
+            stats.parseTime += compileStart - parseStart;
+            stats.compileTime += lua_clock() - compileStart;
+        }
 
-        Luau::compileOrThrow(bcb, result, names, copts());
         stats.bytecode += bcb.getBytecode().size();
 
         switch (format)
         {
         case CompileFormat::Text:
-            printf("%s", bcb.dumpEverything().c_str());
+            output += bcb.dumpEverything();
             break;
         case CompileFormat::Remarks:
-            printf("%s", bcb.dumpSourceRemarks().c_str());
+            output += bcb.dumpSourceRemarks();
             break;
         case CompileFormat::Binary:
-            fwrite(bcb.getBytecode().data(), 1, bcb.getBytecode().size(), stdout);
+            output += bcb.getBytecode();
             break;
         case CompileFormat::Codegen:
         case CompileFormat::CodegenAsm:
         case CompileFormat::CodegenIr:
         case CompileFormat::CodegenVerbose:
-            printf("%s", getCodegenAssembly(name, bcb.getBytecode(), options).c_str());
+            output += getCodegenAssembly(name, bcb.getBytecode(), options);
             break;
         case CompileFormat::CodegenNull:
             stats.codegen += getCodegenAssembly(name, bcb.getBytecode(), options).size();
@@ -802,6 +1010,54 @@ static bool compileFile(const char* name, CompileFormat format, CompileStats& st
     }
 }
 
+static int compileFiles(const std::vector<std::string>& files, CompileFormat format, CompileStats& stats, unsigned int threads)
+{
+    int failed = 0;
+
+    if (threads <= 1 || files.size() <= 1)
+    {
+        for (const std::string& path : files)
+        {
+            std::string output;
+            failed += !compileFile(path.c_str(), format, stats, output);
+            fwrite(output.data(), 1, output.size(), stdout);
+        }
+
+        return failed;
+    }
+
+    // each file is compiled independently with its own allocator and name table, so workers only need to share the next file index
+    std::vector<std::string> outputs(files.size());
+    std::atomic<size_t> nextFile{0};
+    std::mutex statsMutex;
+
+    auto worker = [&]() {
+        CompileStats localStats = {};
+        int localFailed = 0;
+
+        for (size_t i = nextFile++; i < files.size(); i = nextFile++)
+            localFailed += !compileFile(files[i].c_str(), format, localStats, outputs[i]);
+
+        std::unique_lock<std::mutex> lock(statsMutex);
+        stats.add(localStats);
+        failed += localFailed;
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (unsigned int i = 0; i < threads; ++i)
+        workers.emplace_back(worker);
+
+    for (std::thread& thread : workers)
+        thread.join();
+
+    for (const std::string& output : outputs)
+        fwrite(output.data(), 1, output.size(), stdout);
+
+    return failed;
+}
+
 static void displayHelp(const char* argv0)
 {
     printf("Usage: %s [--mode] [options] [file list]\n", argv0);
@@ -819,8 +1075,11 @@ static void displayHelp(const char* argv0)
     printf("  -O<n>: compile with optimization level n (default 1, n should be between 0 and 2).\n");
     printf("  -g<n>: compile with debug level n (default 1, n should be between 0 and 2).\n");
     printf("  --profile[=N]: profile the code using N Hz sampling (default 10000) and output results to profile.out\n");
+    printf("  --bundle: compile each input file together with the modules it requires into a single chunk\n");
+    printf("  --pgo=<file>: guide inlining and loop unrolling at -O2 using line hit counts from a coverage file produced by --coverage\n");
     printf("  --timetrace: record compiler time tracing information into trace.json\n");
     printf("  --codegen: execute code using native code generation\n");
+    printf("  -j<n>: compile input files in parallel using n threads (default 1, 0 uses all cores); only used with --compile\n");
 }
 
 static int assertionHandler(const char* expr, const char* file, int line, const char* function)
@@ -840,6 +1099,7 @@ int replMain(int argc, char** argv)
     int profile = 0;
     bool coverage = false;
     bool interactive = false;
+    unsigned int threads = 1;
 
     // Set the mode if the user has explicitly specified one.
     int argStart = 1;
@@ -925,6 +1185,17 @@ int replMain(int argc, char** argv)
             }
             globalOptions.debugLevel = level;
         }
+        else if (strncmp(argv[i], "-j", 2) == 0)
+        {
+            char* end = nullptr;
+            long count = strtol(argv[i] + 2, &end, 10);
+            if (end == argv[i] + 2 || *end != '\0' || count < 0)
+            {
+                fprintf(stderr, "Error: Thread count must be a non-negative integer.\n");
+                return 1;
+            }
+            threads = count == 0 ? std::max(1u, std::thread::hardware_concurrency()) : unsigned(count);
+        }
         else if (strcmp(argv[i], "--profile") == 0)
         {
             profile = 10000; // default to 10 KHz
@@ -936,11 +1207,21 @@ int replMain(int argc, char** argv)
         else if (strcmp(argv[i], "--codegen") == 0)
         {
             codegen = true;
+            globalOptions.typeInfoLevel = 1;
         }
         else if (strcmp(argv[i], "--coverage") == 0)
         {
             coverage = true;
         }
+        else if (strcmp(argv[i], "--bundle") == 0)
+        {
+            bundle = true;
+        }
+        else if (strncmp(argv[i], "--pgo=", 6) == 0)
+        {
+            if (!coverageLoadProfile(argv[i] + 6))
+                return 1;
+        }
         else if (strcmp(argv[i], "--timetrace") == 0)
         {
             FFlag::DebugLuauTimeTracing.value = true;
@@ -995,10 +1276,10 @@ int replMain(int argc, char** argv)
 #endif
 
         CompileStats stats = {};
-        int failed = 0;
 
-        for (const std::string& path : files)
-            failed += !compileFile(path.c_str(), compileFormat, stats);
+        double start = lua_clock();
+        int failed = compileFiles(files, compileFormat, stats, threads);
+        double wallTime = lua_clock() - start;
 
         if (compileFormat == CompileFormat::Null)
             printf("Compiled %d KLOC into %d KB bytecode\n", int(stats.lines / 1000), int(stats.bytecode / 1024));
@@ -1006,6 +1287,15 @@ int replMain(int argc, char** argv)
             printf("Compiled %d KLOC into %d KB bytecode => %d KB native code\n", int(stats.lines / 1000), int(stats.bytecode / 1024),
                 int(stats.codegen / 1024));
 
+        if (compileFormat == CompileFormat::Null || compileFormat == CompileFormat::CodegenNull)
+        {
+            double sourceMB = double(stats.source) / (1024 * 1024);
+
+            printf("Read %.2f MB in %.3fs, parsed in %.3fs (%.1f MB/s), compiled in %.3fs (%.1f MB/s); %.3fs wall time using %u threads\n", sourceMB,
+                stats.readTime, stats.parseTime, stats.parseTime > 0 ? sourceMB / stats.parseTime : 0.0, stats.compileTime,
+                stats.compileTime > 0 ? sourceMB / stats.compileTime : 0.0, wallTime, threads);
+        }
+
         return failed ? 1 : 0;
     }
     case CliMode::Repl:
@@ -3,6 +3,8 @@
 
 #include <string>
 
+#include <stddef.h>
+
 struct lua_State;
 
 namespace Luau
@@ -17,6 +19,9 @@ void create(lua_State* L);
 // Builds target function and all inner functions
 void compile(lua_State* L, int idx);
 
+// Returns the number of live functions whose native code was discarded due to deoptimization
+size_t getDeoptimizedFunctionCount(lua_State* L);
+
 using annotatorFn = void (*)(void* context, std::string& result, int fid, int instpos);
 
 struct AssemblyOptions
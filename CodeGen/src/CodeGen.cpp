@@ -204,6 +204,12 @@ static int emitInst(AssemblyBuilderX64& build, NativeState& data, ModuleHelpers&
     case LOP_POWK:
         emitInstPowK(build, pc, proto->k, fallback);
         break;
+    case LOP_SUBRK:
+        emitInstBinaryRK(build, pc, TM_SUB, fallback);
+        break;
+    case LOP_DIVRK:
+        emitInstBinaryRK(build, pc, TM_DIV, fallback);
+        break;
     case LOP_NOT:
         emitInstNot(build, pc);
         break;
@@ -367,6 +373,12 @@ static void emitInstFallback(AssemblyBuilderX64& build, NativeState& data, LuauO
     case LOP_POWK:
         emitInstBinaryKFallback(build, pc, i, TM_POW);
         break;
+    case LOP_SUBRK:
+        emitInstBinaryRKFallback(build, pc, i, TM_SUB);
+        break;
+    case LOP_DIVRK:
+        emitInstBinaryRKFallback(build, pc, i, TM_DIV);
+        break;
     case LOP_MINUS:
         emitInstMinusFallback(build, pc, i);
         break;
@@ -578,12 +590,6 @@ static NativeProto* assembleFunction(AssemblyBuilderX64& build, NativeState& dat
     return result;
 }
 
-static void destroyNativeProto(NativeProto* nativeProto)
-{
-    delete[] nativeProto->instTargets;
-    delete nativeProto;
-}
-
 static void onCloseState(lua_State* L)
 {
     destroyNativeState(L);
@@ -592,6 +598,27 @@ static void onCloseState(lua_State* L)
 static void onDestroyFunction(lua_State* L, Proto* proto)
 {
     NativeProto* nativeProto = getProtoExecData(proto);
+
+    if (!nativeProto)
+    {
+        NativeState* data = getNativeState(L);
+
+        if (!data || data->deoptimizedProtos.empty())
+            return;
+
+        auto it = data->deoptimizedProtos.find(proto);
+
+        if (it == data->deoptimizedProtos.end())
+            return;
+
+        nativeProto = it->second;
+        data->deoptimizedProtos.erase(it);
+
+        LUAU_ASSERT(nativeProto->proto == proto);
+        destroyNativeProto(nativeProto);
+        return;
+    }
+
     LUAU_ASSERT(nativeProto->proto == proto);
 
     setProtoExecData(proto, nullptr);
@@ -728,9 +755,9 @@ void compile(lua_State* L, int idx)
     std::vector<NativeProto*> results;
     results.reserve(protos.size());
 
-    // Skip protos that have been compiled during previous invocations of CodeGen::compile
+    // Skip protos that have been compiled during previous invocations of CodeGen::compile, including the ones that were deoptimized since
     for (Proto* p : protos)
-        if (p && getProtoExecData(p) == nullptr)
+        if (p && getProtoExecData(p) == nullptr && data->deoptimizedProtos.count(p) == 0)
             results.push_back(assembleFunction(build, *data, helpers, p, {}));
 
     build.finalize();
@@ -762,6 +789,13 @@ void compile(lua_State* L, int idx)
         setProtoExecData(result->proto, result);
 }
 
+size_t getDeoptimizedFunctionCount(lua_State* L)
+{
+    NativeState* data = getNativeState(L);
+
+    return data ? data->deoptimizedProtos.size() : 0;
+}
+
 std::string getAssembly(lua_State* L, int idx, AssemblyOptions options)
 {
     LUAU_ASSERT(lua_isLfunction(L, idx));
@@ -1,6 +1,8 @@
 // This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
 #include "CodeGenUtils.h"
 
+#include "CustomExecUtils.h"
+
 #include "ldo.h"
 #include "ltable.h"
 
@@ -126,5 +128,20 @@ void callEpilogC(lua_State* L, int nresults, int n)
     L->top = (nresults == LUA_MULTRET) ? res : cip->top;
 }
 
+void deoptimizeProto(lua_State* L)
+{
+    Proto* proto = clvalue(L->ci->func)->l.p;
+    NativeProto* nativeProto = getProtoExecData(proto);
+
+    if (!nativeProto)
+        return;
+
+    LUAU_ASSERT(nativeProto->proto == proto);
+
+    // Without native data, all future calls and returns into this function will run in the interpreter
+    setProtoExecData(proto, nullptr);
+    getNativeState(L)->deoptimizedProtos[proto] = nativeProto;
+}
+
 } // namespace CodeGen
 } // namespace Luau
@@ -116,7 +116,7 @@ void convertNumberToIndexOrJump(AssemblyBuilderX64& build, RegisterX64 tmp, Regi
     build.jcc(ConditionX64::NotZero, label);
 }
 
-void callArithHelper(AssemblyBuilderX64& build, int ra, int rb, OperandX64 c, TMS tm)
+void callArithHelper(AssemblyBuilderX64& build, int ra, OperandX64 b, OperandX64 c, TMS tm)
 {
     if (build.abi == ABIX64::Windows)
         build.mov(sArg5, tm);
@@ -125,7 +125,7 @@ void callArithHelper(AssemblyBuilderX64& build, int ra, int rb, OperandX64 c, TM
 
     build.mov(rArg1, rState);
     build.lea(rArg2, luauRegAddress(ra));
-    build.lea(rArg3, luauRegAddress(rb));
+    build.lea(rArg3, b);
     build.lea(rArg4, c);
     build.call(qword[rNativeContext + offsetof(NativeContext, luaV_doarith)]);
 
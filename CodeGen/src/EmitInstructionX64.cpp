@@ -581,15 +581,16 @@ void emitInstJumpxEqS(AssemblyBuilderX64& build, const Instruction* pc, int pcpo
     build.jcc(not_ ? ConditionX64::NotEqual : ConditionX64::Equal, target);
 }
 
-static void emitInstBinaryNumeric(AssemblyBuilderX64& build, int ra, int rb, int rc, OperandX64 opc, TMS tm, Label& fallback)
+static void emitInstBinaryNumeric(AssemblyBuilderX64& build, int ra, int rb, int rc, OperandX64 opb, OperandX64 opc, TMS tm, Label& fallback)
 {
-    jumpIfTagIsNot(build, rb, LUA_TNUMBER, fallback);
+    if (rb != -1)
+        jumpIfTagIsNot(build, rb, LUA_TNUMBER, fallback);
 
     if (rc != -1 && rc != rb)
         jumpIfTagIsNot(build, rc, LUA_TNUMBER, fallback);
 
     // fast-path: number
-    build.vmovsd(xmm0, luauRegValue(rb));
+    build.vmovsd(xmm0, opb);
 
     switch (tm)
     {
@@ -629,24 +630,38 @@ static void emitInstBinaryNumeric(AssemblyBuilderX64& build, int ra, int rb, int
 
 void emitInstBinary(AssemblyBuilderX64& build, const Instruction* pc, TMS tm, Label& fallback)
 {
-    emitInstBinaryNumeric(build, LUAU_INSN_A(*pc), LUAU_INSN_B(*pc), LUAU_INSN_C(*pc), luauRegValue(LUAU_INSN_C(*pc)), tm, fallback);
+    emitInstBinaryNumeric(
+        build, LUAU_INSN_A(*pc), LUAU_INSN_B(*pc), LUAU_INSN_C(*pc), luauRegValue(LUAU_INSN_B(*pc)), luauRegValue(LUAU_INSN_C(*pc)), tm, fallback);
 }
 
 void emitInstBinaryFallback(AssemblyBuilderX64& build, const Instruction* pc, int pcpos, TMS tm)
 {
     emitSetSavedPc(build, pcpos + 1);
-    callArithHelper(build, LUAU_INSN_A(*pc), LUAU_INSN_B(*pc), luauRegAddress(LUAU_INSN_C(*pc)), tm);
+    callArithHelper(build, LUAU_INSN_A(*pc), luauRegAddress(LUAU_INSN_B(*pc)), luauRegAddress(LUAU_INSN_C(*pc)), tm);
 }
 
 void emitInstBinaryK(AssemblyBuilderX64& build, const Instruction* pc, TMS tm, Label& fallback)
 {
-    emitInstBinaryNumeric(build, LUAU_INSN_A(*pc), LUAU_INSN_B(*pc), -1, luauConstantValue(LUAU_INSN_C(*pc)), tm, fallback);
+    emitInstBinaryNumeric(
+        build, LUAU_INSN_A(*pc), LUAU_INSN_B(*pc), -1, luauRegValue(LUAU_INSN_B(*pc)), luauConstantValue(LUAU_INSN_C(*pc)), tm, fallback);
 }
 
 void emitInstBinaryKFallback(AssemblyBuilderX64& build, const Instruction* pc, int pcpos, TMS tm)
 {
     emitSetSavedPc(build, pcpos + 1);
-    callArithHelper(build, LUAU_INSN_A(*pc), LUAU_INSN_B(*pc), luauConstantAddress(LUAU_INSN_C(*pc)), tm);
+    callArithHelper(build, LUAU_INSN_A(*pc), luauRegAddress(LUAU_INSN_B(*pc)), luauConstantAddress(LUAU_INSN_C(*pc)), tm);
+}
+
+void emitInstBinaryRK(AssemblyBuilderX64& build, const Instruction* pc, TMS tm, Label& fallback)
+{
+    emitInstBinaryNumeric(
+        build, LUAU_INSN_A(*pc), -1, LUAU_INSN_C(*pc), luauConstantValue(LUAU_INSN_B(*pc)), luauRegValue(LUAU_INSN_C(*pc)), tm, fallback);
+}
+
+void emitInstBinaryRKFallback(AssemblyBuilderX64& build, const Instruction* pc, int pcpos, TMS tm)
+{
+    emitSetSavedPc(build, pcpos + 1);
+    callArithHelper(build, LUAU_INSN_A(*pc), luauConstantAddress(LUAU_INSN_B(*pc)), luauRegAddress(LUAU_INSN_C(*pc)), tm);
 }
 
 void emitInstPowK(AssemblyBuilderX64& build, const Instruction* pc, const TValue* k, Label& fallback)
@@ -725,7 +740,7 @@ void emitInstMinus(AssemblyBuilderX64& build, const Instruction* pc, Label& fall
 void emitInstMinusFallback(AssemblyBuilderX64& build, const Instruction* pc, int pcpos)
 {
     emitSetSavedPc(build, pcpos + 1);
-    callArithHelper(build, LUAU_INSN_A(*pc), LUAU_INSN_B(*pc), luauRegAddress(LUAU_INSN_B(*pc)), TM_UNM);
+    callArithHelper(build, LUAU_INSN_A(*pc), luauRegAddress(LUAU_INSN_B(*pc)), luauRegAddress(LUAU_INSN_B(*pc)), TM_UNM);
 }
 
 void emitInstLength(AssemblyBuilderX64& build, const Instruction* pc, Label& fallback)
@@ -44,6 +44,8 @@ void emitInstBinary(AssemblyBuilderX64& build, const Instruction* pc, TMS tm, La
 void emitInstBinaryFallback(AssemblyBuilderX64& build, const Instruction* pc, int pcpos, TMS tm);
 void emitInstBinaryK(AssemblyBuilderX64& build, const Instruction* pc, TMS tm, Label& fallback);
 void emitInstBinaryKFallback(AssemblyBuilderX64& build, const Instruction* pc, int pcpos, TMS tm);
+void emitInstBinaryRK(AssemblyBuilderX64& build, const Instruction* pc, TMS tm, Label& fallback);
+void emitInstBinaryRKFallback(AssemblyBuilderX64& build, const Instruction* pc, int pcpos, TMS tm);
 void emitInstPowK(AssemblyBuilderX64& build, const Instruction* pc, const TValue* k, Label& fallback);
 void emitInstNot(AssemblyBuilderX64& build, const Instruction* pc);
 void emitInstMinus(AssemblyBuilderX64& build, const Instruction* pc, Label& fallback);
@@ -25,6 +25,9 @@ void IrBuilder::buildFunctionIr(Proto* proto)
 
     function.bcMapping.resize(proto->sizecode, {~0u, 0});
 
+    // Argument types from annotations are verified once on entry
+    IrOp entry = buildArgumentGuards(proto);
+
     // Translate all instructions to IR inside blocks
     for (int i = 0; i < proto->sizecode;)
     {
@@ -52,6 +55,10 @@ void IrBuilder::buildFunctionIr(Proto* proto)
                 inst(IrCmd::JUMP, blockAtInst(i));
         }
     }
+
+    // Function entry has to go through the argument checks, but jumps to the first instruction don't
+    if (entry.kind == IrOpKind::Block)
+        function.bcMapping[0] = {function.blocks[entry.index].start, 0};
 }
 
 void IrBuilder::rebuildBytecodeBasicBlocks(Proto* proto)
@@ -89,6 +96,139 @@ void IrBuilder::rebuildBytecodeBasicBlocks(Proto* proto)
     }
 }
 
+static uint8_t getArgumentTag(uint8_t type)
+{
+    // We only guard the types that code generation can specialize on
+    switch (type)
+    {
+    case LBC_TYPE_NUMBER:
+        return LUA_TNUMBER;
+    case LBC_TYPE_TABLE:
+        return LUA_TTABLE;
+    default:
+        return LUA_TNIL;
+    }
+}
+
+static void removeWrittenArguments(Proto* proto, std::vector<uint8_t>& tags)
+{
+    auto invalidate = [&](int from, int to) {
+        for (int reg = from; reg < to && reg < int(tags.size()); reg++)
+            tags[reg] = LUA_TNIL;
+    };
+
+    for (int i = 0; i < proto->sizecode;)
+    {
+        const Instruction* pc = &proto->code[i];
+        LuauOpcode op = LuauOpcode(LUAU_INSN_OP(*pc));
+
+        switch (op)
+        {
+        // These instructions only read register A or don't use it as a register at all
+        case LOP_NOP:
+        case LOP_BREAK:
+        case LOP_SETGLOBAL:
+        case LOP_SETUPVAL:
+        case LOP_CLOSEUPVALS:
+        case LOP_SETTABLE:
+        case LOP_SETTABLEKS:
+        case LOP_SETTABLEN:
+        case LOP_JUMP:
+        case LOP_JUMPBACK:
+        case LOP_JUMPIF:
+        case LOP_JUMPIFNOT:
+        case LOP_JUMPIFEQ:
+        case LOP_JUMPIFLE:
+        case LOP_JUMPIFLT:
+        case LOP_JUMPIFNOTEQ:
+        case LOP_JUMPIFNOTLE:
+        case LOP_JUMPIFNOTLT:
+        case LOP_JUMPX:
+        case LOP_JUMPXEQKNIL:
+        case LOP_JUMPXEQKB:
+        case LOP_JUMPXEQKN:
+        case LOP_JUMPXEQKS:
+        case LOP_RETURN:
+        case LOP_SETLIST:
+        case LOP_FASTCALL:
+        case LOP_FASTCALL1:
+        case LOP_FASTCALL2:
+        case LOP_FASTCALL2K:
+        case LOP_PREPVARARGS:
+        case LOP_COVERAGE:
+            break;
+        case LOP_CAPTURE:
+            // Register captured by reference can be modified through the upvalue
+            if (LUAU_INSN_A(*pc) == LCT_REF)
+                invalidate(LUAU_INSN_B(*pc), LUAU_INSN_B(*pc) + 1);
+            break;
+        default:
+            // Conservatively assume that the instruction can write to any register starting from A
+            invalidate(LUAU_INSN_A(*pc), int(tags.size()));
+            break;
+        }
+
+        i += getOpLength(op);
+        LUAU_ASSERT(i <= proto->sizecode);
+    }
+}
+
+IrOp IrBuilder::buildArgumentGuards(Proto* proto)
+{
+    const uint8_t* typeinfo = proto->typeinfo;
+
+    // Type information is [LBC_TYPE_FUNCTION, numparams, one type per parameter...]
+    if (!typeinfo || proto->sizetypeinfo != 2 + proto->numparams || typeinfo[0] != LBC_TYPE_FUNCTION || typeinfo[1] != proto->numparams)
+        return {};
+
+    knownArgumentTags.resize(proto->numparams, LUA_TNIL);
+
+    for (int i = 0; i < proto->numparams; i++)
+        knownArgumentTags[i] = getArgumentTag(typeinfo[2 + i]);
+
+    removeWrittenArguments(proto, knownArgumentTags);
+
+    // Guards are still useful for arguments that are modified later, but we don't have a way to use them yet
+    bool hasGuards = false;
+
+    for (uint8_t tag : knownArgumentTags)
+        hasGuards |= tag != LUA_TNIL;
+
+    if (!hasGuards)
+    {
+        knownArgumentTags.clear();
+        return {};
+    }
+
+    IrOp entry = block(IrBlockKind::Internal);
+    IrOp deoptimize = block(IrBlockKind::Fallback);
+
+    beginBlock(entry);
+
+    for (int i = 0; i < int(knownArgumentTags.size()); i++)
+    {
+        if (knownArgumentTags[i] == LUA_TNIL)
+            continue;
+
+        IrOp tag = inst(IrCmd::LOAD_TAG, vmReg(uint8_t(i)));
+        inst(IrCmd::CHECK_TAG, tag, constTag(knownArgumentTags[i]), deoptimize);
+    }
+
+    inst(IrCmd::JUMP, blockAtInst(0));
+
+    // When annotations don't match the actual arguments, native code is disabled for the function and the call proceeds in the interpreter
+    beginBlock(deoptimize);
+    inst(IrCmd::SET_SAVEDPC, constUint(0));
+    inst(IrCmd::DEOPTIMIZE);
+
+    return entry;
+}
+
+bool IrBuilder::isArgumentTagKnown(int reg, uint8_t tag) const
+{
+    return unsigned(reg) < knownArgumentTags.size() && knownArgumentTags[reg] == tag && tag != LUA_TNIL;
+}
+
 void IrBuilder::translateInst(LuauOpcode op, const Instruction* pc, int i)
 {
     switch (op)
@@ -233,6 +373,12 @@ void IrBuilder::translateInst(LuauOpcode op, const Instruction* pc, int i)
     case LOP_POWK:
         translateInstBinaryK(*this, pc, i, TM_POW);
         break;
+    case LOP_SUBRK:
+        translateInstBinaryRK(*this, pc, i, TM_SUB);
+        break;
+    case LOP_DIVRK:
+        translateInstBinaryRK(*this, pc, i, TM_DIV);
+        break;
     case LOP_NOT:
         translateInstNot(*this, pc);
         break;
@@ -23,8 +23,11 @@ struct IrBuilder
     void buildFunctionIr(Proto* proto);
 
     void rebuildBytecodeBasicBlocks(Proto* proto);
+    IrOp buildArgumentGuards(Proto* proto);
     void translateInst(LuauOpcode op, const Instruction* pc, int i);
 
+    bool isArgumentTagKnown(int reg, uint8_t tag) const;
+
     bool isInternalBlock(IrOp block);
     void beginBlock(IrOp block);
 
@@ -57,6 +60,9 @@ struct IrBuilder
     IrFunction function;
 
     std::vector<uint32_t> instIndexToBlock; // Block index at the bytecode instruction
+
+    // Tags of argument registers that are checked on function entry and are never written to by the function
+    std::vector<uint8_t> knownArgumentTags;
 };
 
 } // namespace CodeGen
@@ -96,6 +96,9 @@ enum class IrCmd : uint8_t
     SET_SAVEDPC,
     CLOSE_UPVALS,
 
+    // Disable native code for the current function and continue execution in the interpreter
+    DEOPTIMIZE,
+
     // While capture is a no-op right now, it might be useful to track register/upvalue lifetimes
     CAPTURE,
 
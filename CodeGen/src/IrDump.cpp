@@ -182,6 +182,8 @@ const char* getCmdName(IrCmd cmd)
         return "SET_SAVEDPC";
     case IrCmd::CLOSE_UPVALS:
         return "CLOSE_UPVALS";
+    case IrCmd::DEOPTIMIZE:
+        return "DEOPTIMIZE";
     case IrCmd::CAPTURE:
         return "CAPTURE";
     case IrCmd::LOP_SETLIST:
@@ -597,15 +597,17 @@ void IrLoweringX64::lowerInst(IrInst& inst, uint32_t index, IrBlock& next)
         break;
     }
     case IrCmd::DO_ARITH:
+    {
         LUAU_ASSERT(inst.a.kind == IrOpKind::VmReg);
-        LUAU_ASSERT(inst.b.kind == IrOpKind::VmReg);
+        LUAU_ASSERT(inst.b.kind == IrOpKind::VmReg || inst.b.kind == IrOpKind::VmConst);
         LUAU_ASSERT(inst.c.kind == IrOpKind::VmReg || inst.c.kind == IrOpKind::VmConst);
 
-        if (inst.c.kind == IrOpKind::VmReg)
-            callArithHelper(build, inst.a.index, inst.b.index, luauRegAddress(inst.c.index), TMS(intOp(inst.d)));
-        else
-            callArithHelper(build, inst.a.index, inst.b.index, luauConstantAddress(inst.c.index), TMS(intOp(inst.d)));
+        OperandX64 opb = inst.b.kind == IrOpKind::VmReg ? luauRegAddress(inst.b.index) : luauConstantAddress(inst.b.index);
+        OperandX64 opc = inst.c.kind == IrOpKind::VmReg ? luauRegAddress(inst.c.index) : luauConstantAddress(inst.c.index);
+
+        callArithHelper(build, inst.a.index, opb, opc, TMS(intOp(inst.d)));
         break;
+    }
     case IrCmd::DO_LEN:
         LUAU_ASSERT(inst.a.kind == IrOpKind::VmReg);
         LUAU_ASSERT(inst.b.kind == IrOpKind::VmReg);
@@ -810,6 +812,12 @@ void IrLoweringX64::lowerInst(IrInst& inst, uint32_t index, IrBlock& next)
         build.mov(qword[tmp1.reg + offsetof(CallInfo, savedpc)], tmp2.reg);
         break;
     }
+    case IrCmd::DEOPTIMIZE:
+        build.mov(rArg1, rState);
+        build.call(qword[rNativeContext + offsetof(NativeContext, deoptimizeProto)]);
+
+        build.jmp(helpers.exitContinueVm);
+        break;
     case IrCmd::CLOSE_UPVALS:
     {
         LUAU_ASSERT(inst.a.kind == IrOpKind::VmReg);
@@ -108,6 +108,7 @@ inline bool isBlockTerminator(IrCmd cmd)
     case IrCmd::LOP_FORGPREP_INEXT:
     case IrCmd::LOP_FORGPREP_XNEXT_FALLBACK:
     case IrCmd::FALLBACK_FORGPREP:
+    case IrCmd::DEOPTIMIZE:
         return true;
     default:
         break;
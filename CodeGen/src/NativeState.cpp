@@ -31,7 +31,11 @@ NativeState::NativeState()
 {
 }
 
-NativeState::~NativeState() = default;
+NativeState::~NativeState()
+{
+    for (auto& [proto, nativeProto] : deoptimizedProtos)
+        destroyNativeProto(nativeProto);
+}
 
 void initFallbackTable(NativeState& data)
 {
@@ -104,6 +108,13 @@ void initHelperFunctions(NativeState& data)
     data.context.forgPrepXnextFallback = forgPrepXnextFallback;
     data.context.callProlog = callProlog;
     data.context.callEpilogC = callEpilogC;
+    data.context.deoptimizeProto = deoptimizeProto;
+}
+
+void destroyNativeProto(NativeProto* nativeProto)
+{
+    delete[] nativeProto->instTargets;
+    delete nativeProto;
 }
 
 } // namespace CodeGen
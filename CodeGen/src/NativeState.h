@@ -6,6 +6,8 @@
 #include "Luau/Label.h"
 
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include <stdint.h>
 
@@ -103,6 +105,7 @@ struct NativeContext
     void (*forgPrepXnextFallback)(lua_State* L, TValue* ra, int pc) = nullptr;
     Closure* (*callProlog)(lua_State* L, TValue* ra, StkId argtop, int nresults) = nullptr;
     void (*callEpilogC)(lua_State* L, int nresults, int n) = nullptr;
+    void (*deoptimizeProto)(lua_State* L) = nullptr;
 };
 
 struct NativeState
@@ -117,10 +120,15 @@ struct NativeState
     size_t gateDataSize = 0;
 
     NativeContext context;
+
+    // Native code of deoptimized functions may still be referenced by active frames, so it's kept until the function is destroyed
+    std::unordered_map<Proto*, NativeProto*> deoptimizedProtos;
 };
 
 void initFallbackTable(NativeState& data);
 void initHelperFunctions(NativeState& data);
 
+void destroyNativeProto(NativeProto* nativeProto);
+
 } // namespace CodeGen
 } // namespace Luau
@@ -44,6 +44,10 @@
 // Version 1: Baseline version for the open-source release. Supported until 0.521.
 // Version 2: Adds Proto::linedefined. Currently supported.
 // Version 3: Adds FORGPREP/JUMPXEQK* and enhances AUX encoding for FORGLOOP. Removes FORGLOOP_NEXT/INEXT and JUMPIFEQK/JUMPIFNOTEQK. Currently supported.
+// Version 4: Adds Proto::typeinfo, emitted only when the compiler is asked to preserve argument type annotations. Currently supported.
+// Version 5: Adds SUBRK/DIVRK, emitted only when at least one function uses them. Currently supported.
+// Version 6: Adds a trailing debug info section with line info and local/upvalue names, emitted only when the compiler is asked to separate debug info. Currently supported.
+// Version 7: Adds a module constant pool that function constant tables refer to by index, emitted only when the compiler is asked to share constants. Currently supported.
 
 // Bytecode opcode, part of the instruction header
 enum LuauOpcode
@@ -345,9 +349,13 @@ enum LuauOpcode
     // B: source register (for VAL/REF) or upvalue index (for UPVAL/UPREF)
     LOP_CAPTURE,
 
-    // removed in v3
-    LOP_DEP_JUMPIFEQK,
-    LOP_DEP_JUMPIFNOTEQK,
+    // SUBRK, DIVRK: compute arithmetic operation between the constant and a source register and put the result into target register
+    // A: target register
+    // B: constant table index (0..255); must refer to a number
+    // C: source register
+    // Note: these opcodes reuse the slots of JUMPIFEQK/JUMPIFNOTEQK that were removed in v3 and require v5
+    LOP_SUBRK,
+    LOP_DIVRK,
 
     // FASTCALL1: perform a fast call of a built-in function using 1 register argument
     // A: builtin function id (see LuauBuiltinFunction)
@@ -412,8 +420,16 @@ enum LuauBytecodeTag
 {
     // Bytecode version; runtime supports [MIN, MAX], compiler emits TARGET by default but may emit a higher version when flags are enabled
     LBC_VERSION_MIN = 3,
-    LBC_VERSION_MAX = 3,
+    LBC_VERSION_MAX = 7,
     LBC_VERSION_TARGET = 3,
+    // Bytecode version that carries type information; only used for modules that have it
+    LBC_VERSION_TYPEINFO = 4,
+    // Bytecode version that supports SUBRK/DIVRK; only used for modules that have them
+    LBC_VERSION_REVK = 5,
+    // Bytecode version that stores debug info in a trailing section; only used when requested by the compiler options
+    LBC_VERSION_DEBUGSECTION = 6,
+    // Bytecode version that stores constants in a module-wide pool; only used when requested by the compiler options
+    LBC_VERSION_CONSTANTPOOL = 7,
     // Types of constant table entries
     LBC_CONSTANT_NIL = 0,
     LBC_CONSTANT_BOOLEAN,
@@ -424,6 +440,24 @@ enum LuauBytecodeTag
     LBC_CONSTANT_CLOSURE,
 };
 
+// Type table tags, used in Proto::typeinfo
+// Function type information is encoded as LBC_TYPE_FUNCTION, followed by the number of parameters and one tag per parameter
+enum LuauBytecodeType
+{
+    LBC_TYPE_NIL = 0,
+    LBC_TYPE_BOOLEAN,
+    LBC_TYPE_NUMBER,
+    LBC_TYPE_STRING,
+    LBC_TYPE_TABLE,
+    LBC_TYPE_FUNCTION,
+    LBC_TYPE_THREAD,
+    LBC_TYPE_USERDATA,
+    LBC_TYPE_VECTOR,
+
+    LBC_TYPE_ANY = 15,
+    LBC_TYPE_OPTIONAL_BIT = 1 << 7,
+};
+
 // Builtin function ids, used in LOP_FASTCALL
 enum LuauBuiltinFunction
 {
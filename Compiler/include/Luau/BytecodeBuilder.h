@@ -6,6 +6,7 @@
 #include "Luau/StringUtils.h"
 
 #include <string>
+#include <string_view>
 
 namespace Luau
 {
@@ -44,6 +45,10 @@ public:
         bool operator==(const TableShape& other) const;
     };
 
+    // compiled function that can be added to another builder with addSavedFunction, which allows reusing compiled code between builds
+    // unlike the rest of the builder state, saved functions own all string data they refer to
+    struct SavedFunction;
+
     BytecodeBuilder(BytecodeEncoder* encoder = 0);
 
     uint32_t beginFunction(uint8_t numparams, bool isvararg = false);
@@ -74,6 +79,11 @@ public:
     void foldJumps();
     void expandJumps();
 
+    // when enabled, emitABC drops moves that can't change register contents: MOVE R1 R1, or MOVE R2 R1 directly after MOVE R1 R2
+    void setMoveElimination(bool enabled);
+
+    void setFunctionTypeInfo(std::string value);
+
     void setDebugFunctionName(StringRef name);
     void setDebugFunctionLineDefined(int line);
     void setDebugLine(int line);
@@ -83,6 +93,22 @@ public:
 
     void addDebugRemark(const char* format, ...) LUAU_PRINTF_ATTR(2, 3);
 
+    // when enabled, line info and local/upvalue names are written to a trailing section that the VM decodes on first use
+    // must be called before any strings are added
+    void setDebugInfoSection(bool enabled);
+
+    // when enabled, constants are written to a module-wide pool once and each function's constant table refers to pool entries by index
+    // must be called before any functions are added
+    void setConstantPool(bool enabled);
+
+    // saveFunction must be called before endFunction and requires string tracking to be enabled before any strings are added
+    void setFunctionSaving(bool enabled);
+    void saveFunction(SavedFunction& result) const;
+
+    // child function ids are remapped through functionIds, which is indexed by the ids that were used when the function was saved
+    uint32_t addSavedFunction(
+        const SavedFunction& func, const std::vector<uint32_t>& functionIds, int lineOffset, uint8_t maxstacksize, uint8_t numupvalues);
+
     void finalize();
 
     enum DumpFlags
@@ -92,6 +118,7 @@ public:
         Dump_Source = 1 << 2,
         Dump_Locals = 1 << 3,
         Dump_Remarks = 1 << 4,
+        Dump_Types = 1 << 5,
     };
 
     void setDumpFlags(uint32_t flags)
@@ -100,7 +127,7 @@ public:
         dumpFunctionPtr = &BytecodeBuilder::dumpCurrentFunction;
     }
 
-    void setDumpSource(const std::string& source);
+    void setDumpSource(std::string_view source);
 
     bool needsDebugRemarks() const
     {
@@ -181,6 +208,11 @@ private:
         unsigned int debugname = 0;
         int debuglinedefined = 0;
 
+        std::string typeinfo;
+        bool hasRevK = false;
+
+        std::string debugdata;
+
         std::string dump;
         std::string dumpname;
         std::vector<int> dumpinstoffs;
@@ -221,6 +253,33 @@ private:
         size_t operator()(const TableShape& v) const;
     };
 
+public:
+    struct SavedFunction
+    {
+        uint8_t numparams = 0;
+        bool isvararg = false;
+
+        std::vector<uint32_t> insns;
+        std::vector<int> lines;
+        std::vector<uint32_t> protos;
+
+        // string references are indices into strings instead of the string table
+        std::vector<std::string> strings;
+        std::vector<Constant> constants;
+        std::vector<TableShape> tableShapes;
+
+        unsigned int debugname = 0;
+        int debuglinedefined = 0;
+        std::vector<DebugLocal> debugLocals;
+        std::vector<DebugUpval> debugUpvals;
+
+        // local and upvalue names are indices into debugStrings when debug info is written to the trailing section
+        std::vector<std::string> debugStrings;
+
+        std::string typeinfo;
+    };
+
+private:
     std::vector<Function> functions;
     uint32_t currentFunction = ~0u;
     uint32_t mainFunction = ~0u;
@@ -235,6 +294,10 @@ private:
 
     bool hasLongJumps = false;
 
+    bool moveElimination = false;
+    size_t lastMove = ~size_t(0);
+    size_t lastLabel = ~size_t(0);
+
     DenseHashMap<ConstantKey, int32_t, ConstantKeyHash> constantMap;
     DenseHashMap<TableShape, int32_t, TableShapeHash> tableShapeMap;
     DenseHashMap<uint32_t, int16_t> protoMap;
@@ -246,6 +309,20 @@ private:
 
     DenseHashMap<StringRef, unsigned int, StringRefHash> stringTable;
     std::vector<StringRef> debugStrings;
+    bool functionSaving = false;
+
+    bool debugInfoSection = false;
+    DenseHashMap<StringRef, unsigned int, StringRefHash> debugStringTable;
+    std::vector<StringRef> debugSectionStrings;
+
+    bool constantPool = false;
+    std::vector<ConstantKey> poolConstants;
+    DenseHashMap<ConstantKey, int32_t, ConstantKeyHash> poolConstantMap;
+    // pool indices of import path components and table template keys, referenced by import and table pool entries
+    std::vector<TableShape> poolKeyLists;
+    DenseHashMap<TableShape, int32_t, TableShapeHash> poolKeyListMap;
+    // pool index of each constant of the current function; closures aren't pooled and use ~0u
+    std::vector<uint32_t> poolIds;
 
     std::vector<std::pair<uint32_t, uint32_t>> debugRemarks;
     std::string debugRemarkBuffer;
@@ -265,14 +342,21 @@ private:
 
     std::string dumpCurrentFunction(std::vector<int>& dumpinstoffs) const;
     void dumpConstant(std::string& result, int k) const;
+    void dumpTypeInfo(std::string& result, const std::string& typeinfo) const;
     void dumpInstruction(const uint32_t* opcode, std::string& output, int targetLabel) const;
 
     void writeFunction(std::string& ss, uint32_t id) const;
+    void writeDebugInfo(std::string& ss) const;
     void writeLineInfo(std::string& ss) const;
     void writeStringTable(std::string& ss) const;
+    void writeDebugInfoSection(std::string& ss) const;
+    void writeConstantPool(std::string& ss) const;
 
     int32_t addConstant(const ConstantKey& key, const Constant& value);
     unsigned int addStringTableEntry(StringRef value);
+    unsigned int addDebugStringTableEntry(StringRef value);
+    void addPoolConstants();
+    uint32_t addPoolKeyList(const TableShape& list);
 };
 
 } // namespace Luau
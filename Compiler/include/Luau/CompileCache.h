@@ -0,0 +1,69 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#pragma once
+
+#include "Luau/BytecodeBuilder.h"
+
+#include <string>
+#include <vector>
+
+namespace Luau
+{
+
+// Compiled functions from the last compilation of a module; compileOrThrow uses it to recompile only the functions that changed
+// Functions are identified by their path in the function tree which includes names of all enclosing functions; anonymous functions and functions
+// that share the name with a sibling are disambiguated by their order. A compiled function is reused when its source text and the source text of the
+// enclosing scopes it can observe are unchanged, as long as functions that it inlined or otherwise inspected during compilation are unchanged too.
+struct CompileCache
+{
+    struct Dependency
+    {
+        std::string path;
+        uint64_t signature = 0;
+        int lineOffset = 0;
+    };
+
+    struct Upvalue
+    {
+        // function depth of the function that declares the local, and the index of the local in its declaration order
+        unsigned int depth = 0;
+        unsigned int index = 0;
+    };
+
+    struct Function
+    {
+        // stable identifier of the function
+        std::string path;
+
+        // hash of the function source text, including nested functions
+        uint64_t hash = 0;
+
+        // hash of the enclosing scopes: source text excluding nested functions, along with mutability and values of declared locals
+        uint64_t scopeHash = 0;
+
+        // first line of the function source; reused functions have their line information adjusted when the function moves
+        int line = 0;
+
+        uint32_t id = 0;
+        std::vector<Dependency> dependencies;
+        std::vector<Upvalue> upvals;
+
+        unsigned int stackSize = 0;
+        uint64_t costModel = 0;
+        bool canInline = false;
+        bool returnsOne = false;
+
+        BytecodeBuilder::SavedFunction code;
+    };
+
+    // hash of compilation options and module-wide state such as global mutability
+    uint64_t contextHash = 0;
+
+    // indexed by function id
+    std::vector<Function> functions;
+
+    // number of functions that were compiled and reused during the last compilation
+    size_t compiledFunctions = 0;
+    size_t reusedFunctions = 0;
+};
+
+} // namespace Luau
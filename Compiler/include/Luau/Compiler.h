@@ -6,12 +6,17 @@
 #include "Luau/StringUtils.h"
 #include "Luau/Common.h"
 
+#include <string_view>
+#include <vector>
+
 namespace Luau
 {
 class AstNameTable;
+class AstStatBlock;
 struct ParseResult;
 class BytecodeBuilder;
 class BytecodeEncoder;
+struct CompileCache;
 
 // Note: this structure is duplicated in luacode.h, don't forget to change these in sync!
 struct CompileOptions
@@ -31,12 +36,33 @@ struct CompileOptions
     // 2 - statement and expression coverage (verbose)
     int coverageLevel = 0;
 
+    // 0 - debug info is stored with each function
+    // 1 - debug info is stored in a trailing section of the bytecode; the VM only decodes it when it's needed, for example for tracebacks
+    int debugInfoSection = 0;
+
+    // 0 - each function has its own constant table
+    // 1 - constants are stored in a module-wide pool that function constant tables refer to; the VM shares identical constant tables between functions
+    int constantPool = 0;
+
+    // 0 - no type information
+    // 1 - argument type annotations are encoded in bytecode; used by native code generator to specialize function code
+    int typeInfoLevel = 0;
+
+    // 0 - number constants on the left hand side of subtraction and division are loaded into a register
+    // 1 - such constants are encoded in SUBRK/DIVRK instructions; requires bytecode version 5 support in the VM
+    int reverseArithConstants = 0;
+
     // global builtin to construct vectors; disabled by default
     const char* vectorLib = nullptr;
     const char* vectorCtor = nullptr;
 
     // null-terminated array of globals that are mutable; disables the import optimization for fields accessed through these
     const char** mutableGlobals = nullptr;
+
+    // execution profile that guides inlining and loop unrolling decisions at optimization level 2; disabled by default
+    // profileLineHits[line] is the number of times the 1-based source line executed, or -1 if the line wasn't recorded
+    const int* profileLineHits = nullptr;
+    int profileLineCount = 0;
 };
 
 class CompileError : public std::exception
@@ -59,10 +85,31 @@ private:
 
 // compiles bytecode into bytecode builder using either a pre-parsed AST or parsing it from source; throws on errors
 void compileOrThrow(BytecodeBuilder& bytecode, const ParseResult& parseResult, const AstNameTable& names, const CompileOptions& options = {});
-void compileOrThrow(BytecodeBuilder& bytecode, const std::string& source, const CompileOptions& options = {}, const ParseOptions& parseOptions = {});
+void compileOrThrow(BytecodeBuilder& bytecode, std::string_view source, const CompileOptions& options = {}, const ParseOptions& parseOptions = {});
+
+// compiles source like compileOrThrow, but reuses functions compiled by the previous compilation with the same cache when they are unaffected by
+// the source changes; the cache is updated to reflect the new compilation. execution profiles aren't supported and disable function reuse
+void compileOrThrow(BytecodeBuilder& bytecode, std::string_view source, CompileCache& cache, const CompileOptions& options = {},
+    const ParseOptions& parseOptions = {});
+
+struct BundleModule
+{
+    // name that other modules use to require this module, as in require("name")
+    std::string name;
+
+    // parsed module source; all modules in a bundle must be parsed using the same name table
+    AstStatBlock* root = nullptr;
+};
+
+// compiles a set of modules into a single chunk that runs the dependencies of the first module and then the first module itself; throws on errors
+// only dependencies with side effect free top level code that don't use globals assigned by the first module are bundled, and require calls
+// with a constant string argument that refer to them are resolved at compile time; other modules are required at runtime as usual
+// module exports that are never mutated are inlined and constant folded into other modules at optimization level 2
+void compileBundleOrThrow(
+    BytecodeBuilder& bytecode, const std::vector<BundleModule>& modules, const AstNameTable& names, const CompileOptions& options = {});
 
 // compiles bytecode into a bytecode blob, that either contains the valid bytecode or an encoded error that luau_load can decode
 std::string compile(
-    const std::string& source, const CompileOptions& options = {}, const ParseOptions& parseOptions = {}, BytecodeEncoder* encoder = nullptr);
+    std::string_view source, const CompileOptions& options = {}, const ParseOptions& parseOptions = {}, BytecodeEncoder* encoder = nullptr);
 
 } // namespace Luau
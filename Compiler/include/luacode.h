@@ -27,12 +27,33 @@ struct lua_CompileOptions
     // 2 - statement and expression coverage (verbose)
     int coverageLevel; // default=0
 
+    // 0 - debug info is stored with each function
+    // 1 - debug info is stored in a trailing section of the bytecode; the VM only decodes it when it's needed, for example for tracebacks
+    int debugInfoSection; // default=0
+
+    // 0 - each function has its own constant table
+    // 1 - constants are stored in a module-wide pool that function constant tables refer to; the VM shares identical constant tables between functions
+    int constantPool; // default=0
+
+    // 0 - no type information
+    // 1 - argument type annotations are encoded in bytecode; used by native code generator to specialize function code
+    int typeInfoLevel; // default=0
+
+    // 0 - number constants on the left hand side of subtraction and division are loaded into a register
+    // 1 - such constants are encoded in SUBRK/DIVRK instructions; requires bytecode version 5 support in the VM
+    int reverseArithConstants; // default=0
+
     // global builtin to construct vectors; disabled by default
     const char* vectorLib;
     const char* vectorCtor;
 
     // null-terminated array of globals that are mutable; disables the import optimization for fields accessed through these
     const char** mutableGlobals;
+
+    // execution profile that guides inlining and loop unrolling decisions at optimization level 2; disabled by default
+    // profileLineHits[line] is the number of times the 1-based source line executed, or -1 if the line wasn't recorded
+    const int* profileLineHits;
+    int profileLineCount;
 };
 
 // compile source to bytecode; when source compilation fails, the resulting bytecode contains the encoded error. use free() to destroy
@@ -0,0 +1,682 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#include "Bundle.h"
+
+#include "Luau/Lexer.h"
+
+#include <algorithm>
+#include <string>
+
+namespace Luau
+{
+namespace Compile
+{
+
+static AstExprConstantString* getRequireName(AstExprCall* expr)
+{
+    if (expr->self || expr->args.size != 1)
+        return nullptr;
+
+    AstExprGlobal* func = expr->func->as<AstExprGlobal>();
+    if (!func || func->name != "require")
+        return nullptr;
+
+    return expr->args.data[0]->as<AstExprConstantString>();
+}
+
+struct RequireVisitor : AstVisitor
+{
+    const DenseHashMap<std::string, size_t>& names;
+
+    std::vector<std::pair<AstExprCall*, size_t>> dependencies;
+
+    RequireVisitor(const DenseHashMap<std::string, size_t>& names)
+        : names(names)
+    {
+    }
+
+    bool visit(AstExprCall* node) override
+    {
+        if (AstExprConstantString* name = getRequireName(node))
+            if (const size_t* module = names.find(std::string(name->value.data, name->value.size)))
+                dependencies.push_back({node, *module});
+
+        return true;
+    }
+};
+
+struct GlobalVisitor : AstVisitor
+{
+    DenseHashSet<AstName> reads{AstName()};
+    DenseHashSet<AstName> writes{AstName()};
+
+    void assign(AstExpr* var)
+    {
+        if (AstExprGlobal* global = var->as<AstExprGlobal>())
+            writes.insert(global->name);
+        else
+            var->visit(this);
+    }
+
+    bool visit(AstStatAssign* node) override
+    {
+        for (size_t i = 0; i < node->vars.size; ++i)
+            assign(node->vars.data[i]);
+
+        for (size_t i = 0; i < node->values.size; ++i)
+            node->values.data[i]->visit(this);
+
+        return false;
+    }
+
+    bool visit(AstStatCompoundAssign* node) override
+    {
+        assign(node->var);
+        node->value->visit(this);
+
+        return false;
+    }
+
+    bool visit(AstStatFunction* node) override
+    {
+        assign(node->name);
+        node->func->visit(this);
+
+        return false;
+    }
+
+    bool visit(AstExprGlobal* node) override
+    {
+        reads.insert(node->name);
+
+        return false;
+    }
+};
+
+// Bundled modules run at the start of the chunk, in the environment of the entry module, instead of running in their own environment on the
+// first require. To keep this unobservable, only modules with side effect free top level code that don't share globals with the entry
+// module are bundled; all other modules are left to be required at runtime.
+struct BundleResolver
+{
+    const std::vector<BundleModule>& modules;
+
+    // require calls in each module that refer to other modules in the set
+    std::vector<std::vector<std::pair<AstExprCall*, size_t>>> dependencies;
+    DenseHashMap<AstExprCall*, size_t> calls{nullptr};
+
+    // globals that the entry module assigns
+    DenseHashSet<AstName> entryGlobals{AstName()};
+
+    std::vector<int> state;
+    std::vector<bool> bundled;
+    std::vector<bool> excluded;
+    std::vector<size_t> order;
+
+    BundleResolver(const std::vector<BundleModule>& modules)
+        : modules(modules)
+        , dependencies(modules.size())
+        , state(modules.size())
+        , bundled(modules.size())
+        , excluded(modules.size())
+    {
+    }
+
+    bool isBundledRequire(AstExprCall* expr)
+    {
+        const size_t* module = calls.find(expr);
+
+        return module && bundled[*module];
+    }
+
+    bool isSideEffectFree(AstExpr* node)
+    {
+        if (node->is<AstExprConstantNil>() || node->is<AstExprConstantBool>() || node->is<AstExprConstantNumber>() ||
+            node->is<AstExprConstantString>())
+            return true;
+        else if (node->is<AstExprLocal>() || node->is<AstExprFunction>())
+            return true;
+        else if (AstExprGroup* expr = node->as<AstExprGroup>())
+            return isSideEffectFree(expr->expr);
+        else if (AstExprTypeAssertion* expr = node->as<AstExprTypeAssertion>())
+            return isSideEffectFree(expr->expr);
+        else if (AstExprUnary* expr = node->as<AstExprUnary>())
+            return (expr->op == AstExprUnary::Not || (expr->op == AstExprUnary::Minus && expr->expr->is<AstExprConstantNumber>())) &&
+                   isSideEffectFree(expr->expr);
+        else if (AstExprCall* expr = node->as<AstExprCall>())
+            return isBundledRequire(expr);
+        else if (AstExprTable* expr = node->as<AstExprTable>())
+        {
+            for (const AstExprTable::Item& item : expr->items)
+            {
+                // general keys can be nil or NaN, which is an error
+                if (item.kind == AstExprTable::Item::General)
+                {
+                    AstExprConstantNumber* key = item.key->as<AstExprConstantNumber>();
+
+                    if (!item.key->is<AstExprConstantString>() && !(key && key->value == key->value))
+                        return false;
+                }
+
+                if (!isSideEffectFree(item.value))
+                    return false;
+            }
+
+            return true;
+        }
+        else
+            return false;
+    }
+
+    bool isSideEffectFree(const BundleModule& module)
+    {
+        AstStatBlock* root = module.root;
+
+        GlobalVisitor globals;
+        root->visit(&globals);
+
+        if (!globals.writes.empty())
+            return false;
+
+        for (AstName name : globals.reads)
+            if (entryGlobals.contains(name) || name == "getfenv" || name == "setfenv")
+                return false;
+
+        // modules have to return a table or a function when required at runtime
+        AstStatReturn* result = root->body.size > 0 ? root->body.data[root->body.size - 1]->as<AstStatReturn>() : nullptr;
+
+        if (!result || result->list.size != 1)
+            return false;
+
+        // locals that are initialized with a new table or a function; nothing at the top level can reassign them
+        DenseHashSet<AstLocal*> tables{nullptr};
+        DenseHashSet<AstLocal*> functions{nullptr};
+
+        auto isLocalTable = [&](AstExpr* node) {
+            AstExprIndexName* expr = node->as<AstExprIndexName>();
+            AstExprLocal* table = expr ? expr->expr->as<AstExprLocal>() : nullptr;
+
+            return table && tables.contains(table->local);
+        };
+
+        for (size_t i = 0; i + 1 < root->body.size; ++i)
+        {
+            AstStat* node = root->body.data[i];
+
+            if (AstStatLocal* stat = node->as<AstStatLocal>())
+            {
+                for (size_t j = 0; j < stat->values.size; ++j)
+                {
+                    AstExpr* value = stat->values.data[j];
+
+                    if (!isSideEffectFree(value))
+                        return false;
+
+                    if (j < stat->vars.size && value->is<AstExprTable>())
+                        tables.insert(stat->vars.data[j]);
+                    else if (j < stat->vars.size && value->is<AstExprFunction>())
+                        functions.insert(stat->vars.data[j]);
+                }
+            }
+            else if (AstStatLocalFunction* stat = node->as<AstStatLocalFunction>())
+            {
+                functions.insert(stat->name);
+            }
+            else if (AstStatFunction* stat = node->as<AstStatFunction>())
+            {
+                if (!isLocalTable(stat->name))
+                    return false;
+            }
+            else if (AstStatAssign* stat = node->as<AstStatAssign>())
+            {
+                if (stat->vars.size != stat->values.size)
+                    return false;
+
+                for (size_t j = 0; j < stat->vars.size; ++j)
+                    if (!isLocalTable(stat->vars.data[j]) || !isSideEffectFree(stat->values.data[j]))
+                        return false;
+            }
+            else if (!node->is<AstStatTypeAlias>())
+            {
+                return false;
+            }
+        }
+
+        AstExpr* value = result->list.data[0];
+
+        if (AstExprLocal* expr = value->as<AstExprLocal>())
+            return tables.contains(expr->local) || functions.contains(expr->local);
+        else
+            return value->is<AstExprTable>() || value->is<AstExprFunction>();
+    }
+
+    void resolveModule(size_t index)
+    {
+        state[index] = 1; // in progress
+
+        for (auto [call, module] : dependencies[index])
+        {
+            // modules in a require cycle are required at runtime so that the cycle is reported the same way
+            if (state[module] == 1)
+            {
+                excluded[index] = true;
+                excluded[module] = true;
+            }
+
+            if (state[module] == 0)
+                resolveModule(module);
+        }
+
+        state[index] = 2; // done
+
+        if (index != 0 && !excluded[index] && isSideEffectFree(modules[index]))
+        {
+            bundled[index] = true;
+            order.push_back(index);
+        }
+    }
+
+    void resolve()
+    {
+        for (;;)
+        {
+            std::fill(state.begin(), state.end(), 0);
+            std::fill(bundled.begin(), bundled.end(), false);
+            order.clear();
+
+            resolveModule(0);
+
+            // modules that are required at runtime get a separate copy of the modules they require, so those can't be bundled either
+            bool changed = false;
+
+            for (size_t index = 1; index < modules.size(); ++index)
+                if (state[index] == 2 && !bundled[index])
+                    for (auto [call, module] : dependencies[index])
+                        if (bundled[module])
+                        {
+                            excluded[module] = true;
+                            changed = true;
+                        }
+
+            if (!changed)
+                break;
+        }
+
+        order.push_back(0);
+    }
+};
+
+void resolveBundle(Bundle& bundle, const std::vector<BundleModule>& modules)
+{
+    LUAU_ASSERT(!modules.empty());
+
+    DenseHashMap<std::string, size_t> names{""};
+
+    for (size_t i = 0; i < modules.size(); ++i)
+        names[modules[i].name] = i;
+
+    BundleResolver resolver{modules};
+
+    for (size_t i = 0; i < modules.size(); ++i)
+    {
+        RequireVisitor visitor{names};
+        modules[i].root->visit(&visitor);
+
+        for (auto [call, module] : visitor.dependencies)
+            resolver.calls[call] = module;
+
+        resolver.dependencies[i] = std::move(visitor.dependencies);
+    }
+
+    GlobalVisitor entry;
+    modules[0].root->visit(&entry);
+
+    // a module that replaces require changes what the other modules get, so everything is required at runtime
+    for (AstName name : entry.writes)
+    {
+        resolver.entryGlobals.insert(name);
+
+        if (name == "require")
+            std::fill(resolver.excluded.begin(), resolver.excluded.end(), true);
+    }
+
+    resolver.resolve();
+
+    bundle.order = std::move(resolver.order);
+
+    for (size_t index : bundle.order)
+    {
+        for (auto [call, module] : resolver.dependencies[index])
+            if (resolver.bundled[module])
+                bundle.calls[call] = module;
+
+        if (index != 0)
+            bundle.roots[modules[index].root] = index;
+    }
+
+    bundle.exports.reserve(modules.size());
+
+    for (const BundleModule& module : modules)
+        bundle.exports.emplace_back(AstName(module.name.c_str()), module.root->location, nullptr, 0, 0, nullptr);
+}
+
+struct ModuleExports
+{
+    DenseHashMap<AstName, AstExpr*> fields{AstName()};
+    DenseHashSet<AstName> mutated{AstName()};
+
+    // when the module result can be accessed in ways we don't track, we can't reason about any of its fields
+    bool escaped = false;
+
+    void define(AstName name, AstExpr* value)
+    {
+        if (fields.contains(name))
+            mutated.insert(name);
+        else
+            fields[name] = value;
+    }
+
+    void define(const AstNameTable& names, AstExprTable* table)
+    {
+        for (const AstExprTable::Item& item : table->items)
+        {
+            if (item.kind == AstExprTable::Item::Record)
+            {
+                AstExprConstantString* key = item.key->as<AstExprConstantString>();
+                LUAU_ASSERT(key);
+
+                define(names.getWithType(key->value.data, key->value.size).first, item.value);
+            }
+            else if (item.kind == AstExprTable::Item::General)
+            {
+                // general keys may alias named fields
+                escaped = true;
+            }
+        }
+    }
+};
+
+// tracks uses of the table that the module returns inside the module itself
+struct ResultTableVisitor : AstVisitor
+{
+    AstLocal* local;
+    ModuleExports& exports;
+
+    ResultTableVisitor(AstLocal* local, ModuleExports& exports)
+        : local(local)
+        , exports(exports)
+    {
+    }
+
+    AstExprIndexName* getField(AstExpr* node)
+    {
+        AstExprIndexName* expr = node->as<AstExprIndexName>();
+        AstExprLocal* table = expr ? expr->expr->as<AstExprLocal>() : nullptr;
+
+        return table && table->local == local ? expr : nullptr;
+    }
+
+    void assign(AstExpr* var)
+    {
+        if (AstExprIndexName* field = getField(var))
+            exports.mutated.insert(field->index);
+        else
+            var->visit(this);
+    }
+
+    bool visit(AstStatAssign* node) override
+    {
+        for (size_t i = 0; i < node->vars.size; ++i)
+            assign(node->vars.data[i]);
+
+        for (size_t i = 0; i < node->values.size; ++i)
+            node->values.data[i]->visit(this);
+
+        return false;
+    }
+
+    bool visit(AstStatCompoundAssign* node) override
+    {
+        assign(node->var);
+        node->value->visit(this);
+
+        return false;
+    }
+
+    bool visit(AstStatFunction* node) override
+    {
+        assign(node->name);
+        node->func->visit(this);
+
+        return false;
+    }
+
+    bool visit(AstExprIndexName* node) override
+    {
+        return getField(node) == nullptr;
+    }
+
+    bool visit(AstExprCall* node) override
+    {
+        // method calls pass the table as the first argument
+        if (node->self && getField(node->func))
+            exports.escaped = true;
+
+        return true;
+    }
+
+    bool visit(AstExprLocal* node) override
+    {
+        if (node->local == local)
+            exports.escaped = true;
+
+        return false;
+    }
+};
+
+static void analyzeModuleResult(
+    ModuleExports& exports, AstStatBlock* root, const AstNameTable& names, const DenseHashMap<AstLocal*, Variable>& variables)
+{
+    AstStatReturn* result = root->body.size > 0 ? root->body.data[root->body.size - 1]->as<AstStatReturn>() : nullptr;
+
+    if (!result || result->list.size != 1)
+    {
+        exports.escaped = true;
+        return;
+    }
+
+    AstExpr* value = result->list.data[0];
+
+    // return {...}: the table isn't accessible to the module itself
+    if (AstExprTable* table = value->as<AstExprTable>())
+    {
+        exports.define(names, table);
+        return;
+    }
+
+    // local M = {...} ... return M: fields assigned once at the top level of the module are known after the module runs
+    AstExprLocal* local = value->as<AstExprLocal>();
+    const Variable* lv = local ? variables.find(local->local) : nullptr;
+    AstExprTable* table = lv && !lv->written && lv->init ? lv->init->as<AstExprTable>() : nullptr;
+
+    if (!table)
+    {
+        exports.escaped = true;
+        return;
+    }
+
+    exports.define(names, table);
+
+    ResultTableVisitor visitor{local->local, exports};
+
+    for (size_t i = 0; i + 1 < root->body.size; ++i)
+    {
+        AstStat* stat = root->body.data[i];
+
+        if (AstStatAssign* assign = stat->as<AstStatAssign>(); assign && assign->vars.size == 1 && assign->values.size == 1)
+        {
+            if (AstExprIndexName* field = visitor.getField(assign->vars.data[0]))
+            {
+                exports.define(field->index, assign->values.data[0]);
+                assign->values.data[0]->visit(&visitor);
+                continue;
+            }
+        }
+        else if (AstStatFunction* func = stat->as<AstStatFunction>())
+        {
+            if (AstExprIndexName* field = visitor.getField(func->name))
+            {
+                exports.define(field->index, func->func);
+                func->func->visit(&visitor);
+                continue;
+            }
+        }
+
+        stat->visit(&visitor);
+    }
+}
+
+// tracks uses of module results in the modules that require them
+struct ConsumerVisitor : AstVisitor
+{
+    const Bundle& bundle;
+    const DenseHashMap<AstLocal*, Variable>& variables;
+    std::vector<ModuleExports>& exports;
+
+    DenseHashMap<AstLocal*, size_t> aliases{nullptr};
+    std::vector<std::pair<AstExprIndexName*, size_t>> reads;
+
+    ConsumerVisitor(const Bundle& bundle, const DenseHashMap<AstLocal*, Variable>& variables, std::vector<ModuleExports>& exports)
+        : bundle(bundle)
+        , variables(variables)
+        , exports(exports)
+    {
+    }
+
+    const size_t* getModule(AstExpr* node)
+    {
+        if (AstExprCall* expr = node->as<AstExprCall>())
+            return bundle.calls.find(expr);
+        else if (AstExprLocal* expr = node->as<AstExprLocal>())
+            return aliases.find(expr->local);
+        else
+            return nullptr;
+    }
+
+    void assign(AstExpr* var)
+    {
+        AstExprIndexName* field = var->as<AstExprIndexName>();
+
+        if (const size_t* module = field ? getModule(field->expr) : nullptr)
+            exports[*module].mutated.insert(field->index);
+        else
+            var->visit(this);
+    }
+
+    bool visit(AstStatLocal* node) override
+    {
+        for (size_t i = 0; i < node->values.size; ++i)
+        {
+            AstExpr* value = node->values.data[i];
+            AstExprCall* call = value->as<AstExprCall>();
+
+            const size_t* module = call ? bundle.calls.find(call) : nullptr;
+            const Variable* lv = module && i < node->vars.size ? variables.find(node->vars.data[i]) : nullptr;
+
+            // local m = require("name") is the most common way to refer to the module result
+            if (lv && !lv->written)
+                aliases[node->vars.data[i]] = *module;
+            else
+                value->visit(this);
+        }
+
+        return false;
+    }
+
+    bool visit(AstStatAssign* node) override
+    {
+        for (size_t i = 0; i < node->vars.size; ++i)
+            assign(node->vars.data[i]);
+
+        for (size_t i = 0; i < node->values.size; ++i)
+            node->values.data[i]->visit(this);
+
+        return false;
+    }
+
+    bool visit(AstStatCompoundAssign* node) override
+    {
+        assign(node->var);
+        node->value->visit(this);
+
+        return false;
+    }
+
+    bool visit(AstStatFunction* node) override
+    {
+        assign(node->name);
+        node->func->visit(this);
+
+        return false;
+    }
+
+    bool visit(AstExprIndexName* node) override
+    {
+        if (const size_t* module = getModule(node->expr))
+        {
+            reads.push_back({node, *module});
+            return false;
+        }
+
+        return true;
+    }
+
+    bool visit(AstExprCall* node) override
+    {
+        // module result is used directly, for example passed to a function
+        if (const size_t* module = bundle.calls.find(node))
+            exports[*module].escaped = true;
+
+        // method calls pass the module result as the first argument
+        if (AstExprIndexName* func = node->func->as<AstExprIndexName>(); func && node->self)
+            if (const size_t* module = getModule(func->expr))
+                exports[*module].escaped = true;
+
+        return true;
+    }
+
+    bool visit(AstExprLocal* node) override
+    {
+        if (const size_t* module = aliases.find(node->local))
+            exports[*module].escaped = true;
+
+        return false;
+    }
+};
+
+void analyzeBundleExports(
+    Bundle& bundle, const std::vector<BundleModule>& modules, const AstNameTable& names, const DenseHashMap<AstLocal*, Variable>& variables)
+{
+    std::vector<ModuleExports> exports(modules.size());
+
+    for (size_t index : bundle.order)
+        if (index != 0)
+            analyzeModuleResult(exports[index], modules[index].root, names, variables);
+
+    ConsumerVisitor visitor{bundle, variables, exports};
+
+    for (size_t index : bundle.order)
+        modules[index].root->visit(&visitor);
+
+    for (auto [node, module] : visitor.reads)
+    {
+        const ModuleExports& e = exports[module];
+
+        if (e.escaped || e.mutated.contains(node->index))
+            continue;
+
+        if (AstExpr* const* value = e.fields.find(node->index))
+            bundle.fields[node] = *value;
+    }
+}
+
+} // namespace Compile
+} // namespace Luau
@@ -0,0 +1,45 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#pragma once
+
+#include "Luau/Ast.h"
+#include "Luau/Compiler.h"
+#include "Luau/DenseHash.h"
+
+#include "ValueTracking.h"
+
+#include <vector>
+
+namespace Luau
+{
+class AstNameTable;
+}
+
+namespace Luau
+{
+namespace Compile
+{
+
+struct Bundle
+{
+    // bundled modules in the order they need to run in: dependencies first, the entry module (index 0) last
+    std::vector<size_t> order;
+
+    // one synthetic local per module that holds the module result
+    std::vector<AstLocal> exports;
+
+    // root blocks of all modules except for the entry module => module index
+    DenseHashMap<AstStatBlock*, size_t> roots{nullptr};
+
+    // require calls that refer to modules in the bundle => module index
+    DenseHashMap<AstExprCall*, size_t> calls{nullptr};
+
+    // field accesses of module results that are known to hold a specific value => value expression
+    DenseHashMap<AstExprIndexName*, AstExpr*> fields{nullptr};
+};
+
+void resolveBundle(Bundle& bundle, const std::vector<BundleModule>& modules);
+void analyzeBundleExports(
+    Bundle& bundle, const std::vector<BundleModule>& modules, const AstNameTable& names, const DenseHashMap<AstLocal*, Variable>& variables);
+
+} // namespace Compile
+} // namespace Luau
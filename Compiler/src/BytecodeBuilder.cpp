@@ -2,6 +2,7 @@
 #include "Luau/BytecodeBuilder.h"
 
 #include "Luau/StringUtils.h"
+#include "Luau/TimeTrace.h"
 
 #include <algorithm>
 #include <string.h>
@@ -215,6 +216,9 @@ BytecodeBuilder::BytecodeBuilder(BytecodeEncoder* encoder)
     , tableShapeMap(TableShape())
     , protoMap(~0u)
     , stringTable({nullptr, 0})
+    , debugStringTable({nullptr, 0})
+    , poolConstantMap({Constant::Type_Nil, ~0ull})
+    , poolKeyListMap(TableShape())
     , encoder(encoder)
 {
     LUAU_ASSERT(stringTable.find(StringRef{"", 0}) == nullptr);
@@ -242,6 +246,8 @@ uint32_t BytecodeBuilder::beginFunction(uint8_t numparams, bool isvararg)
     currentFunction = id;
 
     hasLongJumps = false;
+    lastMove = ~size_t(0);
+    lastLabel = ~size_t(0);
     debugLine = 0;
 
     return id;
@@ -260,23 +266,39 @@ void BytecodeBuilder::endFunction(uint8_t maxstacksize, uint8_t numupvalues)
     validate();
 #endif
 
+    // some opcodes require a newer bytecode version, so we need to know if any function uses them before the version is selected
+    for (size_t i = 0; i < insns.size(); i += getOpLength(LuauOpcode(LUAU_INSN_OP(insns[i]))))
+    {
+        uint8_t op = LUAU_INSN_OP(insns[i]);
+
+        if (op == LOP_SUBRK || op == LOP_DIVRK)
+            func.hasRevK = true;
+    }
+
     // very approximate: 4 bytes per instruction for code, 1 byte for debug line, and 1-2 bytes for aux data like constants plus overhead
     func.data.reserve(32 + insns.size() * 7);
 
+    if (constantPool)
+        addPoolConstants();
+
     writeFunction(func.data, currentFunction);
 
-    currentFunction = ~0u;
+    if (debugInfoSection)
+        writeDebugInfo(func.debugdata);
 
     // this call is indirect to make sure we only gain link time dependency on dumpCurrentFunction when needed
     if (dumpFunctionPtr)
         func.dump = (this->*dumpFunctionPtr)(func.dumpinstoffs);
 
+    currentFunction = ~0u;
+
     insns.clear();
     lines.clear();
     constants.clear();
     protos.clear();
     jumps.clear();
     tableShapes.clear();
+    poolIds.clear();
 
     debugLocals.clear();
     debugUpvals.clear();
@@ -321,13 +343,125 @@ unsigned int BytecodeBuilder::addStringTableEntry(StringRef value)
     {
         index = uint32_t(stringTable.size());
 
-        if ((dumpFlags & Dump_Code) != 0)
+        if ((dumpFlags & Dump_Code) != 0 || functionSaving)
             debugStrings.push_back(value);
     }
 
     return index;
 }
 
+unsigned int BytecodeBuilder::addDebugStringTableEntry(StringRef value)
+{
+    unsigned int& index = debugStringTable[value];
+
+    // debug section uses 1-based indices as well, but they are separate from the main string table
+    if (index == 0)
+    {
+        index = uint32_t(debugStringTable.size());
+        debugSectionStrings.push_back(value);
+    }
+
+    return index;
+}
+
+void BytecodeBuilder::addPoolConstants()
+{
+    poolIds.assign(constants.size(), ~0u);
+
+    auto addPoolConstant = [&](const ConstantKey& key) {
+        int32_t& id = poolConstantMap[key];
+
+        // pool entries are 1-based in the map so that 0 can mark a missing entry
+        if (id == 0)
+        {
+            poolConstants.push_back(key);
+            id = int32_t(poolConstants.size());
+        }
+
+        return uint32_t(id - 1);
+    };
+
+    // imports and table templates refer to other constants, so they are pooled after the constants they refer to
+    for (size_t i = 0; i < constants.size(); ++i)
+    {
+        const Constant& c = constants[i];
+
+        switch (c.type)
+        {
+        case Constant::Type_Nil:
+            poolIds[i] = addPoolConstant({Constant::Type_Nil, 0});
+            break;
+
+        case Constant::Type_Boolean:
+            poolIds[i] = addPoolConstant({Constant::Type_Boolean, c.valueBoolean});
+            break;
+
+        case Constant::Type_Number:
+        {
+            ConstantKey k = {Constant::Type_Number};
+            memcpy(&k.value, &c.valueNumber, sizeof(c.valueNumber));
+            poolIds[i] = addPoolConstant(k);
+            break;
+        }
+
+        case Constant::Type_String:
+            poolIds[i] = addPoolConstant({Constant::Type_String, c.valueString});
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < constants.size(); ++i)
+    {
+        const Constant& c = constants[i];
+
+        switch (c.type)
+        {
+        case Constant::Type_Import:
+        {
+            int32_t ids[3];
+            TableShape path;
+            path.length = decomposeImportId(c.valueImport, ids[0], ids[1], ids[2]);
+
+            for (unsigned int j = 0; j < path.length; ++j)
+                path.keys[j] = int32_t(poolIds[ids[j]]);
+
+            poolIds[i] = addPoolConstant({Constant::Type_Import, addPoolKeyList(path)});
+            break;
+        }
+
+        case Constant::Type_Table:
+        {
+            TableShape shape = tableShapes[c.valueTable];
+
+            for (unsigned int j = 0; j < shape.length; ++j)
+                shape.keys[j] = int32_t(poolIds[shape.keys[j]]);
+
+            poolIds[i] = addPoolConstant({Constant::Type_Table, addPoolKeyList(shape)});
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+}
+
+uint32_t BytecodeBuilder::addPoolKeyList(const TableShape& list)
+{
+    int32_t& id = poolKeyListMap[list];
+
+    if (id == 0)
+    {
+        poolKeyLists.push_back(list);
+        id = int32_t(poolKeyLists.size());
+    }
+
+    return uint32_t(id - 1);
+}
+
 int32_t BytecodeBuilder::addConstantNil()
 {
     Constant c = {Constant::Type_Nil};
@@ -427,6 +561,24 @@ int16_t BytecodeBuilder::addChildFunction(uint32_t fid)
 
 void BytecodeBuilder::emitABC(LuauOpcode op, uint8_t a, uint8_t b, uint8_t c)
 {
+    if (op == LOP_MOVE && moveElimination)
+    {
+        if (a == b)
+            return;
+
+        // the reverse move is only redundant if the previous instruction is the only way to reach it; since labels are requested before the
+        // instruction they point to is emitted, any label taken at the current position may become a jump target
+        if (lastMove + 1 == insns.size() && lastLabel != insns.size() && lines.back() == debugLine)
+        {
+            uint32_t prev = insns.back();
+
+            if (LUAU_INSN_A(prev) == b && LUAU_INSN_B(prev) == a)
+                return;
+        }
+
+        lastMove = insns.size();
+    }
+
     uint32_t insn = uint32_t(op) | (a << 8) | (b << 16) | (c << 24);
 
     insns.push_back(insn);
@@ -457,6 +609,8 @@ void BytecodeBuilder::emitAux(uint32_t aux)
 
 size_t BytecodeBuilder::emitLabel()
 {
+    lastLabel = insns.size();
+
     return insns.size();
 }
 
@@ -513,6 +667,11 @@ bool BytecodeBuilder::patchSkipC(size_t jumpLabel, size_t targetLabel)
     return true;
 }
 
+void BytecodeBuilder::setFunctionTypeInfo(std::string value)
+{
+    functions[currentFunction].typeinfo = std::move(value);
+}
+
 void BytecodeBuilder::setDebugFunctionName(StringRef name)
 {
     unsigned int index = addStringTableEntry(name);
@@ -535,7 +694,7 @@ void BytecodeBuilder::setDebugLine(int line)
 
 void BytecodeBuilder::pushDebugLocal(StringRef name, uint8_t reg, uint32_t startpc, uint32_t endpc)
 {
-    unsigned int index = addStringTableEntry(name);
+    unsigned int index = debugInfoSection ? addDebugStringTableEntry(name) : addStringTableEntry(name);
 
     DebugLocal local;
     local.name = index;
@@ -548,7 +707,7 @@ void BytecodeBuilder::pushDebugLocal(StringRef name, uint8_t reg, uint32_t start
 
 void BytecodeBuilder::pushDebugUpval(StringRef name)
 {
-    unsigned int index = addStringTableEntry(name);
+    unsigned int index = debugInfoSection ? addDebugStringTableEntry(name) : addStringTableEntry(name);
 
     DebugUpval upval;
     upval.name = index;
@@ -580,8 +739,218 @@ void BytecodeBuilder::addDebugRemark(const char* format, ...)
     dumpRemarks.emplace_back(debugLine, debugRemarkBuffer.c_str() + offset);
 }
 
+void BytecodeBuilder::setMoveElimination(bool enabled)
+{
+    moveElimination = enabled;
+}
+
+void BytecodeBuilder::setDebugInfoSection(bool enabled)
+{
+    LUAU_ASSERT(!enabled || stringTable.empty());
+
+    debugInfoSection = enabled;
+}
+
+void BytecodeBuilder::setConstantPool(bool enabled)
+{
+    LUAU_ASSERT(functions.empty());
+
+    constantPool = enabled;
+}
+
+void BytecodeBuilder::setFunctionSaving(bool enabled)
+{
+    LUAU_ASSERT(stringTable.empty());
+
+    functionSaving = enabled;
+}
+
+void BytecodeBuilder::saveFunction(SavedFunction& result) const
+{
+    LUAU_ASSERT(currentFunction != ~0u);
+    LUAU_ASSERT(functionSaving);
+
+    const Function& func = functions[currentFunction];
+
+    // strings are saved in string table order, so that adding them back in the same order preserves the relative order of new entries
+    std::vector<unsigned int> strings;
+
+    for (const Constant& c : constants)
+        if (c.type == Constant::Type_String)
+            strings.push_back(c.valueString);
+
+    if (func.debugname)
+        strings.push_back(func.debugname);
+
+    // names are stored in a separate string table when debug info is written to the trailing section
+    std::vector<unsigned int> names;
+    std::vector<unsigned int>& nameStrings = debugInfoSection ? names : strings;
+
+    for (const DebugLocal& l : debugLocals)
+        nameStrings.push_back(l.name);
+
+    for (const DebugUpval& l : debugUpvals)
+        nameStrings.push_back(l.name);
+
+    std::sort(strings.begin(), strings.end());
+    strings.erase(std::unique(strings.begin(), strings.end()), strings.end());
+
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+
+    auto remap = [&](unsigned int index) {
+        return unsigned(std::lower_bound(strings.begin(), strings.end(), index) - strings.begin());
+    };
+
+    auto remapName = [&](unsigned int index) {
+        return unsigned(std::lower_bound(nameStrings.begin(), nameStrings.end(), index) - nameStrings.begin());
+    };
+
+    result.numparams = func.numparams;
+    result.isvararg = func.isvararg;
+
+    result.insns = insns;
+    result.lines = lines;
+    result.protos = protos;
+
+    result.strings.clear();
+
+    for (unsigned int index : strings)
+    {
+        const StringRef& str = debugStrings[index - 1];
+        result.strings.emplace_back(str.data, str.length);
+    }
+
+    result.constants = constants;
+
+    for (Constant& c : result.constants)
+        if (c.type == Constant::Type_String)
+            c.valueString = remap(c.valueString);
+
+    result.tableShapes = tableShapes;
+
+    result.debugname = func.debugname ? remap(func.debugname) + 1 : 0;
+    result.debuglinedefined = func.debuglinedefined;
+
+    result.debugLocals = debugLocals;
+
+    for (DebugLocal& l : result.debugLocals)
+        l.name = remapName(l.name);
+
+    result.debugUpvals = debugUpvals;
+
+    for (DebugUpval& l : result.debugUpvals)
+        l.name = remapName(l.name);
+
+    result.debugStrings.clear();
+
+    for (unsigned int index : names)
+    {
+        const StringRef& str = debugSectionStrings[index - 1];
+        result.debugStrings.emplace_back(str.data, str.length);
+    }
+
+    result.typeinfo = func.typeinfo;
+}
+
+uint32_t BytecodeBuilder::addSavedFunction(
+    const SavedFunction& func, const std::vector<uint32_t>& functionIds, int lineOffset, uint8_t maxstacksize, uint8_t numupvalues)
+{
+    uint32_t id = beginFunction(func.numparams, func.isvararg);
+
+    auto sref = [&](unsigned int index) {
+        const std::string& str = func.strings[index];
+        return StringRef{str.data(), str.size()};
+    };
+
+    for (size_t i = 0; i < func.strings.size(); ++i)
+        addStringTableEntry(sref(unsigned(i)));
+
+    auto nameref = [&](unsigned int index) {
+        const std::string& str = debugInfoSection ? func.debugStrings[index] : func.strings[index];
+        return StringRef{str.data(), str.size()};
+    };
+
+    for (size_t i = 0; i < func.debugStrings.size(); ++i)
+        addDebugStringTableEntry(nameref(unsigned(i)));
+
+    insns = func.insns;
+    lines = func.lines;
+
+    for (int& line : lines)
+        line += lineOffset;
+
+    for (const Constant& c : func.constants)
+    {
+        int32_t cid = -1;
+
+        switch (c.type)
+        {
+        case Constant::Type_Nil:
+            cid = addConstantNil();
+            break;
+
+        case Constant::Type_Boolean:
+            cid = addConstantBoolean(c.valueBoolean);
+            break;
+
+        case Constant::Type_Number:
+            cid = addConstantNumber(c.valueNumber);
+            break;
+
+        case Constant::Type_String:
+            cid = addConstantString(sref(c.valueString));
+            break;
+
+        case Constant::Type_Import:
+            cid = addImport(c.valueImport);
+            break;
+
+        case Constant::Type_Table:
+            cid = addConstantTable(func.tableShapes[c.valueTable]);
+            break;
+
+        case Constant::Type_Closure:
+            cid = addConstantClosure(functionIds[c.valueClosure]);
+            break;
+
+        default:
+            LUAU_ASSERT(!"Unsupported constant type");
+        }
+
+        // instructions refer to constants by index, so the constant table has to stay the same
+        LUAU_ASSERT(cid == int32_t(&c - func.constants.data()));
+    }
+
+    for (size_t i = 0; i < func.protos.size(); ++i)
+    {
+        int16_t pid = addChildFunction(functionIds[func.protos[i]]);
+        LUAU_ASSERT(pid == int16_t(i));
+    }
+
+    if (func.debugname)
+        setDebugFunctionName(sref(func.debugname - 1));
+
+    setDebugFunctionLineDefined(func.debuglinedefined + lineOffset);
+
+    for (const DebugLocal& l : func.debugLocals)
+        pushDebugLocal(nameref(l.name), l.reg, l.startpc, l.endpc);
+
+    for (const DebugUpval& l : func.debugUpvals)
+        pushDebugUpval(nameref(l.name));
+
+    if (!func.typeinfo.empty())
+        setFunctionTypeInfo(func.typeinfo);
+
+    endFunction(maxstacksize, numupvalues);
+
+    return id;
+}
+
 void BytecodeBuilder::finalize()
 {
+    LUAU_TIMETRACE_SCOPE("BytecodeBuilder::finalize", "Compiler");
+
     LUAU_ASSERT(bytecode.empty());
 
     // preallocate space for bytecode blob
@@ -591,25 +960,54 @@ void BytecodeBuilder::finalize()
         capacity += p.first.length + 2;
 
     for (const Function& func : functions)
-        capacity += func.data.size();
+        capacity += func.data.size() + func.typeinfo.size() + func.debugdata.size() + 1;
 
     bytecode.reserve(capacity);
 
+    // type information, reverse constant arithmetic and debug info sections require a newer bytecode version, so we only use it when needed
+    bool hasTypeInfo = false;
+    bool hasRevK = false;
+
+    for (const Function& func : functions)
+    {
+        hasTypeInfo |= !func.typeinfo.empty();
+        hasRevK |= func.hasRevK;
+    }
+
     // assemble final bytecode blob
-    uint8_t version = getVersion();
+    uint8_t version = constantPool       ? uint8_t(LBC_VERSION_CONSTANTPOOL)
+                      : debugInfoSection ? uint8_t(LBC_VERSION_DEBUGSECTION)
+                      : hasRevK          ? uint8_t(LBC_VERSION_REVK)
+                      : hasTypeInfo      ? uint8_t(LBC_VERSION_TYPEINFO)
+                                         : getVersion();
     LUAU_ASSERT(version >= LBC_VERSION_MIN && version <= LBC_VERSION_MAX);
 
     bytecode = char(version);
 
     writeStringTable(bytecode);
 
+    if (version >= LBC_VERSION_CONSTANTPOOL)
+        writeConstantPool(bytecode);
+
     writeVarInt(bytecode, uint32_t(functions.size()));
 
     for (const Function& func : functions)
+    {
         bytecode += func.data;
 
+        // type information trails the function record since it's only known once the version is selected
+        if (version >= LBC_VERSION_TYPEINFO)
+        {
+            writeVarInt(bytecode, uint32_t(func.typeinfo.size()));
+            bytecode += func.typeinfo;
+        }
+    }
+
     LUAU_ASSERT(mainFunction < functions.size());
     writeVarInt(bytecode, mainFunction);
+
+    if (version >= LBC_VERSION_DEBUGSECTION)
+        writeDebugInfoSection(bytecode);
 }
 
 void BytecodeBuilder::writeFunction(std::string& ss, uint32_t id) const
@@ -645,8 +1043,21 @@ void BytecodeBuilder::writeFunction(std::string& ss, uint32_t id) const
     // constants
     writeVarInt(ss, uint32_t(constants.size()));
 
-    for (const Constant& c : constants)
+    for (size_t i = 0; i < constants.size(); ++i)
     {
+        const Constant& c = constants[i];
+
+        // pooled constants are written as 1-based pool indices; closures refer to function ids and are written inline after a 0 marker
+        if (constantPool)
+        {
+            writeVarInt(ss, c.type == Constant::Type_Closure ? 0 : poolIds[i] + 1);
+
+            if (c.type == Constant::Type_Closure)
+                writeVarInt(ss, c.valueClosure);
+
+            continue;
+        }
+
         switch (c.type)
         {
         case Constant::Type_Nil:
@@ -703,6 +1114,20 @@ void BytecodeBuilder::writeFunction(std::string& ss, uint32_t id) const
     writeVarInt(ss, func.debuglinedefined);
     writeVarInt(ss, func.debugname);
 
+    // debug info in the trailing section is written separately by endFunction
+    if (debugInfoSection)
+    {
+        writeByte(ss, 0);
+        writeByte(ss, 0);
+    }
+    else
+    {
+        writeDebugInfo(ss);
+    }
+}
+
+void BytecodeBuilder::writeDebugInfo(std::string& ss) const
+{
     bool hasLines = true;
 
     for (int line : lines)
@@ -854,6 +1279,75 @@ void BytecodeBuilder::writeStringTable(std::string& ss) const
     }
 }
 
+void BytecodeBuilder::writeDebugInfoSection(std::string& ss) const
+{
+    // the section has its own string table so that names don't need to be loaded with the rest of the strings
+    writeVarInt(ss, uint32_t(debugSectionStrings.size()));
+
+    for (const StringRef& s : debugSectionStrings)
+    {
+        writeVarInt(ss, uint32_t(s.length));
+        ss.append(s.data, s.length);
+    }
+
+    // each function's debug info is prefixed with its size so that it can be located without decoding the preceding functions
+    for (const Function& func : functions)
+    {
+        writeVarInt(ss, uint32_t(func.debugdata.size()));
+        ss += func.debugdata;
+    }
+}
+
+void BytecodeBuilder::writeConstantPool(std::string& ss) const
+{
+    writeVarInt(ss, uint32_t(poolConstants.size()));
+
+    for (const ConstantKey& c : poolConstants)
+    {
+        switch (c.type)
+        {
+        case Constant::Type_Nil:
+            writeByte(ss, LBC_CONSTANT_NIL);
+            break;
+
+        case Constant::Type_Boolean:
+            writeByte(ss, LBC_CONSTANT_BOOLEAN);
+            writeByte(ss, uint8_t(c.value));
+            break;
+
+        case Constant::Type_Number:
+        {
+            double value;
+            memcpy(&value, &c.value, sizeof(value));
+
+            writeByte(ss, LBC_CONSTANT_NUMBER);
+            writeDouble(ss, value);
+            break;
+        }
+
+        case Constant::Type_String:
+            writeByte(ss, LBC_CONSTANT_STRING);
+            writeVarInt(ss, uint32_t(c.value));
+            break;
+
+        case Constant::Type_Import:
+        case Constant::Type_Table:
+        {
+            // unlike function constant tables, import paths aren't limited to 10-bit indices so they use the same encoding as table keys
+            const TableShape& list = poolKeyLists[c.value];
+            writeByte(ss, c.type == Constant::Type_Import ? LBC_CONSTANT_IMPORT : LBC_CONSTANT_TABLE);
+            writeVarInt(ss, uint32_t(list.length));
+            for (unsigned int i = 0; i < list.length; ++i)
+                writeVarInt(ss, list.keys[i]);
+            break;
+        }
+
+        default:
+            LUAU_ASSERT(!"Unsupported constant type");
+        }
+    }
+}
+
 uint32_t BytecodeBuilder::getImportId(int32_t id0)
 {
     LUAU_ASSERT(unsigned(id0) < 1024);
@@ -1303,6 +1797,13 @@ void BytecodeBuilder::validateInstructions() const
             VCONST(LUAU_INSN_C(insn), Number);
             break;
 
+        case LOP_SUBRK:
+        case LOP_DIVRK:
+            VREG(LUAU_INSN_A(insn));
+            VCONST(LUAU_INSN_B(insn), Number);
+            VREG(LUAU_INSN_C(insn));
+            break;
+
         case LOP_AND:
         case LOP_OR:
             VREG(LUAU_INSN_A(insn));
@@ -1623,6 +2124,53 @@ static bool printableStringConstant(const char* str, size_t len)
     return true;
 }
 
+static const char* getBaseTypeString(uint8_t type)
+{
+    switch (type & ~LBC_TYPE_OPTIONAL_BIT)
+    {
+    case LBC_TYPE_NIL:
+        return "nil";
+    case LBC_TYPE_BOOLEAN:
+        return "boolean";
+    case LBC_TYPE_NUMBER:
+        return "number";
+    case LBC_TYPE_STRING:
+        return "string";
+    case LBC_TYPE_TABLE:
+        return "table";
+    case LBC_TYPE_FUNCTION:
+        return "function";
+    case LBC_TYPE_THREAD:
+        return "thread";
+    case LBC_TYPE_USERDATA:
+        return "userdata";
+    case LBC_TYPE_VECTOR:
+        return "vector";
+    case LBC_TYPE_ANY:
+        return "any";
+    }
+
+    LUAU_ASSERT(!"Unhandled type in getBaseTypeString");
+    return nullptr;
+}
+
+void BytecodeBuilder::dumpTypeInfo(std::string& result, const std::string& typeinfo) const
+{
+    LUAU_ASSERT(typeinfo.size() >= 2 && uint8_t(typeinfo[0]) == LBC_TYPE_FUNCTION);
+    LUAU_ASSERT(typeinfo.size() == 2 + uint8_t(typeinfo[1]));
+
+    result += "function(";
+
+    for (size_t i = 2; i < typeinfo.size(); ++i)
+    {
+        uint8_t type = uint8_t(typeinfo[i]);
+
+        formatAppend(result, "%s%s%s", i > 2 ? ", " : "", getBaseTypeString(type), (type & LBC_TYPE_OPTIONAL_BIT) ? "?" : "");
+    }
+
+    result += ")\n";
+}
+
 void BytecodeBuilder::dumpConstant(std::string& result, int k) const
 {
     LUAU_ASSERT(unsigned(k) < constants.size());
@@ -1904,6 +2452,18 @@ void BytecodeBuilder::dumpInstruction(const uint32_t* code, std::string& result,
         result.append("]\n");
         break;
 
+    case LOP_SUBRK:
+        formatAppend(result, "SUBRK R%d K%d [", LUAU_INSN_A(insn), LUAU_INSN_B(insn));
+        dumpConstant(result, LUAU_INSN_B(insn));
+        formatAppend(result, "] R%d\n", LUAU_INSN_C(insn));
+        break;
+
+    case LOP_DIVRK:
+        formatAppend(result, "DIVRK R%d K%d [", LUAU_INSN_A(insn), LUAU_INSN_B(insn));
+        dumpConstant(result, LUAU_INSN_B(insn));
+        formatAppend(result, "] R%d\n", LUAU_INSN_C(insn));
+        break;
+
     case LOP_POWK:
         formatAppend(result, "POWK R%d R%d K%d [", LUAU_INSN_A(insn), LUAU_INSN_B(insn), LUAU_INSN_C(insn));
         dumpConstant(result, LUAU_INSN_C(insn));
@@ -2081,6 +2641,14 @@ std::string BytecodeBuilder::dumpCurrentFunction(std::vector<int>& dumpinstoffs)
 
     std::string result;
 
+    if (dumpFlags & Dump_Types)
+    {
+        const std::string& typeinfo = functions[currentFunction].typeinfo;
+
+        if (!typeinfo.empty())
+            dumpTypeInfo(result, typeinfo);
+    }
+
     if (dumpFlags & Dump_Locals)
     {
         for (size_t i = 0; i < debugLocals.size(); ++i)
@@ -2177,24 +2745,24 @@ std::string BytecodeBuilder::dumpCurrentFunction(std::vector<int>& dumpinstoffs)
     return result;
 }
 
-void BytecodeBuilder::setDumpSource(const std::string& source)
+void BytecodeBuilder::setDumpSource(std::string_view source)
 {
     dumpSource.clear();
 
     size_t pos = 0;
 
-    while (pos != std::string::npos)
+    while (pos != std::string_view::npos)
     {
         size_t next = source.find('\n', pos);
 
-        if (next == std::string::npos)
+        if (next == std::string_view::npos)
         {
-            dumpSource.push_back(source.substr(pos));
+            dumpSource.push_back(std::string(source.substr(pos)));
             pos = next;
         }
         else
         {
-            dumpSource.push_back(source.substr(pos, next - pos));
+            dumpSource.push_back(std::string(source.substr(pos, next - pos)));
             pos = next + 1;
         }
 
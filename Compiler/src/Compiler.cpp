@@ -3,13 +3,18 @@
 
 #include "Luau/Parser.h"
 #include "Luau/BytecodeBuilder.h"
+#include "Luau/CompileCache.h"
 #include "Luau/Common.h"
 #include "Luau/TimeTrace.h"
 
 #include "Builtins.h"
+#include "Bundle.h"
 #include "ConstantFolding.h"
 #include "CostModel.h"
+#include "EscapeAnalysis.h"
+#include "FunctionTree.h"
 #include "TableShape.h"
+#include "Types.h"
 #include "ValueTracking.h"
 
 #include <algorithm>
@@ -25,6 +30,9 @@ LUAU_FASTINTVARIABLE(LuauCompileInlineThreshold, 25)
 LUAU_FASTINTVARIABLE(LuauCompileInlineThresholdMaxBoost, 300)
 LUAU_FASTINTVARIABLE(LuauCompileInlineDepth, 5)
 
+LUAU_FASTINTVARIABLE(LuauCompileProfileHotRatio, 16)
+LUAU_FASTINTVARIABLE(LuauCompileProfileHotBoost, 300)
+
 LUAU_FASTFLAGVARIABLE(LuauMultiAssignmentConflictFix, false)
 LUAU_FASTFLAGVARIABLE(LuauSelfAssignmentSkip, false)
 LUAU_FASTFLAGVARIABLE(LuauCompileInterpStringLimit, false)
@@ -87,9 +95,18 @@ static BytecodeBuilder::StringRef sref(AstArray<const char> data)
     return {data.data, data.size};
 }
 
+enum class ProfileHeat
+{
+    Unknown,
+    Cold, // never executed in the profiled run
+    Warm,
+    Hot,
+};
+
 struct Compiler
 {
     struct RegScope;
+    struct Function;
 
     Compiler(BytecodeBuilder& bytecode, const CompileOptions& options)
         : bytecode(bytecode)
@@ -101,11 +118,16 @@ struct Compiler
         , constants(nullptr)
         , locstants(nullptr)
         , tableShapes(nullptr)
+        , scalarTables(nullptr)
         , builtins(nullptr)
+        , typeAliases(AstName())
     {
         // preallocate some buffers that are very likely to grow anyway; this works around std::vector's inefficient growth policy for small arrays
         localStack.reserve(16);
         upvals.reserve(16);
+
+        for (int i = 0; i < options.profileLineCount; ++i)
+            profileMaxHits = std::max(profileMaxHits, options.profileLineHits[i]);
     }
 
     int getLocalReg(AstLocal* local)
@@ -178,8 +200,40 @@ struct Compiler
             return getFunctionExpr(expr->expr);
         else if (AstExprTypeAssertion* expr = node->as<AstExprTypeAssertion>())
             return getFunctionExpr(expr->expr);
+        else if (AstExprIndexName* expr = node->as<AstExprIndexName>())
+            return getBundleFunctionExpr(expr);
+        else if (AstExprFunction* expr = node->as<AstExprFunction>())
+        {
+            recordDependency(expr);
+            return expr;
+        }
         else
-            return node->as<AstExprFunction>();
+            return nullptr;
+    }
+
+    // returns the module that the require call refers to when compiling a bundle
+    AstLocal* getBundleModule(AstExprCall* expr)
+    {
+        const size_t* module = bundle ? bundle->calls.find(expr) : nullptr;
+
+        return module ? &bundle->exports[*module] : nullptr;
+    }
+
+    AstExprFunction* getBundleFunctionExpr(AstExprIndexName* expr)
+    {
+        AstExpr* const* value = bundle ? bundle->fields.find(expr) : nullptr;
+        AstExprFunction* func = value ? getFunctionExpr(*value) : nullptr;
+        Function* fi = func ? functions.find(func) : nullptr;
+
+        if (!fi)
+            return nullptr;
+
+        // locals of other modules aren't visible outside of the module, so we can only refer to functions that don't need them
+        for (AstLocal* uv : fi->upvals)
+            if (const Constant* uc = locstants.find(uv); !uc || uc->type == Constant::Type_Unknown)
+                return nullptr;
+
+        return func;
     }
 
     uint32_t compileFunction(AstExprFunction* func)
@@ -192,6 +246,16 @@ struct Compiler
         LUAU_ASSERT(!functions.contains(func));
         LUAU_ASSERT(regTop == 0 && stackSize == 0 && localStack.empty() && upvals.empty());
 
+        if (cache)
+        {
+            if (const CompileCache::Function* cached = findReusableFunction(func))
+                return reuseFunction(func, *cached);
+
+            compilingFunction = func;
+            dependencies.clear();
+            recordedDependencies.clear();
+        }
+
         RegScope rs(this);
 
         bool self = func->self != 0;
@@ -210,11 +274,20 @@ struct Compiler
         for (size_t i = 0; i < func->args.size; ++i)
             pushLocal(func->args.data[i], uint8_t(args + self + i));
 
+        // self-recursive tail calls reassign the arguments and jump here, see tryCompileSelfTailCall
+        if (options.optimizationLevel >= 2 && !func->vararg && !func->self)
+        {
+            tailCallFunction = func;
+            tailCallLabel = bytecode.emitLabel();
+        }
+
         AstStatBlock* stat = func->body;
 
         for (size_t i = 0; i < stat->body.size; ++i)
             compileStat(stat->body.data[i]);
 
+        tailCallFunction = nullptr;
+
         // valid function bytecode must always end with RETURN
         // we elide this if we're guaranteed to hit a RETURN statement regardless of the control flow
         if (!allPathsEndWithReturn(stat))
@@ -234,6 +307,14 @@ struct Compiler
         if (options.debugLevel >= 1 && func->debugname.value)
             bytecode.setDebugFunctionName(sref(func->debugname));
 
+        if (options.typeInfoLevel >= 1)
+        {
+            std::string typeInfo = getFunctionType(func, typeAliases);
+
+            if (!typeInfo.empty())
+                bytecode.setFunctionTypeInfo(std::move(typeInfo));
+        }
+
         if (options.debugLevel >= 2 && !upvals.empty())
         {
             for (AstLocal* l : upvals)
@@ -247,6 +328,14 @@ struct Compiler
 
         popLocals(0);
 
+        CompileCache::Function* cached = nullptr;
+
+        if (cache)
+        {
+            cached = &nextCache.functions.emplace_back();
+            bytecode.saveFunction(cached->code);
+        }
+
         bytecode.endFunction(uint8_t(stackSize), uint8_t(upvals.size()));
 
         Function& f = functions[func];
@@ -269,12 +358,178 @@ struct Compiler
             }
         }
 
+        if (cached)
+            saveCachedFunction(*cached, func, f, stackSize);
+
         upvals.clear(); // note: instead of std::move above, we copy & clear to preserve capacity for future pushes
         stackSize = 0;
 
         return fid;
     }
 
+    void recordDependency(AstExprFunction* func)
+    {
+        if (!cache || !compilingFunction || recordedDependencies.contains(func))
+            return;
+
+        recordedDependencies.insert(func);
+
+        const FunctionNode* fn = functionTree.functions.find(func);
+
+        CompileCache::Dependency dep;
+        dep.path = fn ? fn->path : "";
+        dep.signature = getDependencySignature(func);
+        dep.lineOffset = int(func->location.begin.line) - int(compilingFunction->location.begin.line);
+
+        dependencies.push_back(std::move(dep));
+    }
+
+    // functions that aren't compiled yet, such as methods that are defined after the function that depends on them, are identified by their source
+    uint64_t getDependencySignature(AstExprFunction* func)
+    {
+        if (const Function* f = functions.find(func))
+            return f->signature;
+
+        const FunctionNode* fn = functionTree.functions.find(func);
+        return fn ? mixHash(fn->hash, fn->scopeHash) : 0;
+    }
+
+    // signature covers everything that other functions can observe when they inline the function or create closures for it
+    uint64_t getFunctionSignature(const FunctionNode& fn, const Function& f)
+    {
+        uint64_t hash = mixHash(fn.hash, fn.scopeHash);
+
+        hash = mixHash(hash, f.stackSize);
+        hash = mixHash(hash, f.costModel);
+        hash = mixHash(hash, f.canInline);
+        hash = mixHash(hash, f.returnsOne);
+
+        for (AstLocal* uv : f.upvals)
+        {
+            CompileCache::Upvalue key;
+
+            if (getUpvalueKey(functionTree, uv, key))
+                hash = mixHash(mixHash(hash, key.depth), key.index);
+            else
+                hash = mixHash(hash, uint64_t(uintptr_t(uv)));
+        }
+
+        return hash;
+    }
+
+    void saveCachedFunction(CompileCache::Function& cached, AstExprFunction* func, Function& f, unsigned int maxStackSize)
+    {
+        const FunctionNode* fn = functionTree.functions.find(func);
+        LUAU_ASSERT(fn);
+
+        f.signature = getFunctionSignature(*fn, f);
+
+        // parents that are reused refer to the new function id instead of the old one
+        if (const CompileCache::Function* const* previous = cachedFunctions.find(fn->path))
+            cachedFunctionIds[(*previous)->id] = f.id;
+
+        nextCache.compiledFunctions++;
+
+        cached.hash = fn->hash;
+        cached.scopeHash = fn->scopeHash;
+        cached.line = int(func->location.begin.line);
+        cached.id = f.id;
+        cached.dependencies = std::move(dependencies);
+        cached.stackSize = maxStackSize;
+        cached.costModel = f.costModel;
+        cached.canInline = f.canInline;
+        cached.returnsOne = f.returnsOne;
+
+        for (AstLocal* uv : f.upvals)
+        {
+            CompileCache::Upvalue key;
+
+            // functions that capture locals we can't identify in the next compilation don't get reused
+            if (!getUpvalueKey(functionTree, uv, key))
+                return;
+
+            cached.upvals.push_back(key);
+        }
+
+        for (const CompileCache::Dependency& dep : cached.dependencies)
+            if (dep.path.empty())
+                return;
+
+        cached.path = fn->path;
+    }
+
+    const CompileCache::Function* findReusableFunction(AstExprFunction* func)
+    {
+        const FunctionNode* fn = functionTree.functions.find(func);
+        LUAU_ASSERT(fn);
+
+        const CompileCache::Function* const* it = cachedFunctions.find(fn->path);
+        if (!it)
+            return nullptr;
+
+        const CompileCache::Function& cached = **it;
+
+        if (cached.hash != fn->hash || cached.scopeHash != fn->scopeHash)
+            return nullptr;
+
+        // functions that were inlined or inspected during compilation need to look the same and be in the same place relative to this function
+        for (const CompileCache::Dependency& dep : cached.dependencies)
+        {
+            AstExprFunction* const* df = functionTree.paths.find(dep.path);
+            if (!df)
+                return nullptr;
+
+            if (getDependencySignature(*df) != dep.signature)
+                return nullptr;
+
+            if (int((*df)->location.begin.line) - int(func->location.begin.line) != dep.lineOffset)
+                return nullptr;
+        }
+
+        for (const CompileCache::Upvalue& key : cached.upvals)
+            if (!findUpvalue(functionTree, func, key))
+                return nullptr;
+
+        for (uint32_t fid : cached.code.protos)
+            if (fid >= cachedFunctionIds.size() || cachedFunctionIds[fid] == ~0u)
+                return nullptr;
+
+        return &cached;
+    }
+
+    uint32_t reuseFunction(AstExprFunction* func, const CompileCache::Function& cached)
+    {
+        upvals.clear();
+
+        // note: getUpval marks mutable locals as captured so that the enclosing function closes them
+        for (const CompileCache::Upvalue& key : cached.upvals)
+            getUpval(findUpvalue(functionTree, func, key));
+
+        int lineOffset = int(func->location.begin.line) - cached.line;
+
+        uint32_t fid = bytecode.addSavedFunction(cached.code, cachedFunctionIds, lineOffset, uint8_t(cached.stackSize), uint8_t(upvals.size()));
+
+        Function& f = functions[func];
+        f.id = fid;
+        f.upvals = upvals;
+        f.costModel = cached.costModel;
+        f.stackSize = cached.canInline ? cached.stackSize : 0;
+        f.canInline = cached.canInline;
+        f.returnsOne = cached.returnsOne;
+        f.signature = getFunctionSignature(*functionTree.functions.find(func), f);
+
+        upvals.clear();
+
+        // the cache entry can't be moved until the bytecode is finalized since the builder refers to its strings
+        nextCache.functions.emplace_back();
+        reusedFunctions.push_back({func, cached.id});
+
+        cachedFunctionIds[cached.id] = fid;
+        nextCache.reusedFunctions++;
+
+        return fid;
+    }
+
     // returns true if node can return multiple values; may conservatively return true even if expr is known to return just a single value
     bool isExprMultRet(AstExpr* node)
     {
@@ -282,6 +537,10 @@ struct Compiler
         if (!expr)
             return node->is<AstExprVarargs>();
 
+        // require calls in a bundle always return the module result
+        if (getBundleModule(expr))
+            return false;
+
         // conservative version, optimized for compilation throughput
         if (options.optimizationLevel <= 1)
             return true;
@@ -309,7 +568,7 @@ struct Compiler
         if (AstExprCall* expr = node->as<AstExprCall>())
         {
             // Optimization: convert multret calls that always return one value to fixedret calls; this facilitates inlining/constant folding
-            if (options.optimizationLevel >= 2 && !isExprMultRet(node))
+            if ((options.optimizationLevel >= 2 || getBundleModule(expr)) && !isExprMultRet(node))
             {
                 compileExprTemp(node, target);
                 return false;
@@ -473,12 +732,43 @@ struct Compiler
         }
     }
 
+    ProfileHeat getProfileHeat(AstNode* node)
+    {
+        int line = node->location.begin.line + 1;
+
+        if (!options.profileLineHits || line >= options.profileLineCount)
+            return ProfileHeat::Unknown;
+
+        int hits = options.profileLineHits[line];
+
+        if (hits < 0)
+            return ProfileHeat::Unknown;
+        else if (hits == 0)
+            return ProfileHeat::Cold;
+        else if (int64_t(hits) * FInt::LuauCompileProfileHotRatio >= profileMaxHits)
+            return ProfileHeat::Hot;
+        else
+            return ProfileHeat::Warm;
+    }
+
     bool tryCompileInlinedCall(AstExprCall* expr, AstExprFunction* func, uint8_t target, uint8_t targetCount, bool multRet, int thresholdBase,
         int thresholdMaxBoost, int depthLimit)
     {
         Function* fi = functions.find(func);
         LUAU_ASSERT(fi);
 
+        // when execution profile is available, we don't inline calls that never ran and are more aggressive with calls that run often
+        ProfileHeat heat = getProfileHeat(expr);
+
+        if (heat == ProfileHeat::Cold)
+        {
+            bytecode.addDebugRemark("inlining failed: cold call site");
+            return false;
+        }
+
+        if (heat == ProfileHeat::Hot)
+            thresholdBase = thresholdBase * FInt::LuauCompileProfileHotBoost / 100;
+
         // make sure we have enough register space
         if (regTop > 128 || fi->stackSize > 32)
         {
@@ -623,7 +913,7 @@ struct Compiler
         }
 
         // fold constant values updated above into expressions in the function body
-        foldConstants(constants, variables, locstants, builtinsFold, func->body);
+        foldConstants(constants, variables, locstants, builtinsFold, fieldsFold, func->body);
 
         bool usedFallthrough = false;
 
@@ -664,7 +954,27 @@ struct Compiler
             if (Constant* var = locstants.find(func->args.data[i]))
                 var->type = Constant::Type_Unknown;
 
-        foldConstants(constants, variables, locstants, builtinsFold, func->body);
+        foldConstants(constants, variables, locstants, builtinsFold, fieldsFold, func->body);
+    }
+
+    // require calls that refer to other modules in a bundle read the module result that was computed when the module ran
+    void compileBundleRequire(AstLocal* module, uint8_t target, uint8_t targetCount)
+    {
+        if (targetCount == 0)
+            return;
+
+        if (int reg = getLocalReg(module); reg >= 0)
+        {
+            if (reg != target)
+                bytecode.emitABC(LOP_MOVE, target, uint8_t(reg), 0);
+        }
+        else
+        {
+            bytecode.emitABC(LOP_GETUPVAL, target, getUpval(module), 0);
+        }
+
+        for (unsigned int i = 1; i < targetCount; ++i)
+            bytecode.emitABC(LOP_LOADNIL, uint8_t(target + i), 0, 0);
     }
 
     void compileExprCall(AstExprCall* expr, uint8_t target, uint8_t targetCount, bool targetTop = false, bool multRet = false)
@@ -673,6 +983,12 @@ struct Compiler
 
         setDebugLine(expr); // normally compileExpr sets up line info, but compileExprCall can be called directly
 
+        if (AstLocal* module = getBundleModule(expr))
+        {
+            compileBundleRequire(module, target, targetCount);
+            return;
+        }
+
         // try inlining the function
         if (options.optimizationLevel >= 2 && !expr->self)
         {
@@ -835,6 +1151,8 @@ struct Compiler
 
     bool shouldShareClosure(AstExprFunction* func)
     {
+        recordDependency(func);
+
         const Function* f = functions.find(func);
         if (!f)
             return false;
@@ -872,6 +1190,8 @@ struct Compiler
     {
         RegScope rs(this);
 
+        recordDependency(expr);
+
         const Function* f = functions.find(expr);
         LUAU_ASSERT(f);
 
@@ -990,6 +1310,17 @@ struct Compiler
         }
     }
 
+    int32_t getConstantNumberRK(AstExprBinary* expr)
+    {
+        if (options.reverseArithConstants < 1)
+            return -1;
+
+        if (expr->op != AstExprBinary::Sub && expr->op != AstExprBinary::Div)
+            return -1;
+
+        return getConstantNumber(expr->left);
+    }
+
     LuauOpcode getJumpOpCompare(AstExprBinary::Op op, bool not_ = false)
     {
         switch (op)
@@ -1439,6 +1770,13 @@ struct Compiler
 
                 bytecode.emitABC(getBinaryOpArith(expr->op, /* k= */ true), target, rl, uint8_t(rc));
             }
+            else if (int32_t lc = getConstantNumberRK(expr); lc >= 0 && lc <= 255)
+            {
+                // constant on the left hand side of a non-commutative operation is encoded in the instruction to avoid loading it into a register
+                uint8_t rr = compileExprAuto(expr->right, rs);
+
+                bytecode.emitABC(expr->op == AstExprBinary::Sub ? LOP_SUBRK : LOP_DIVRK, target, uint8_t(lc), rr);
+            }
             else
             {
                 uint8_t rl = compileExprAuto(expr->left, rs);
@@ -1609,12 +1947,79 @@ struct Compiler
         return hashSize == 0 ? 0 : uint8_t(hashSizeLog2 + 1);
     }
 
+    // returns true if evaluating the expression can't read the target register or run code that could observe it
+    bool isExprIndependentOf(AstExpr* node, uint8_t target)
+    {
+        if (const Constant* cv = constants.find(node); cv && cv->type != Constant::Type_Unknown)
+            return true;
+
+        if (AstExprGroup* expr = node->as<AstExprGroup>())
+            return isExprIndependentOf(expr->expr, target);
+        else if (AstExprTypeAssertion* expr = node->as<AstExprTypeAssertion>())
+            return isExprIndependentOf(expr->expr, target);
+        else if (AstExprLocal* expr = node->as<AstExprLocal>())
+            return getExprLocalReg(expr) != int(target);
+        else if (node->is<AstExprConstantNil>() || node->is<AstExprConstantBool>() || node->is<AstExprConstantNumber>() ||
+                 node->is<AstExprConstantString>() || node->is<AstExprVarargs>() || node->is<AstExprFunction>())
+            return true;
+        else if (AstExprTable* expr = node->as<AstExprTable>())
+        {
+            for (const AstExprTable::Item& item : expr->items)
+                if ((item.key && !isExprIndependentOf(item.key, target)) || !isExprIndependentOf(item.value, target))
+                    return false;
+
+            return true;
+        }
+        else
+            return false;
+    }
+
+    // returns true if evaluating the expression can't write to locals or run arbitrary code
+    bool isExprSideEffectFree(AstExpr* node)
+    {
+        if (const Constant* cv = constants.find(node); cv && cv->type != Constant::Type_Unknown)
+            return true;
+
+        if (AstExprGroup* expr = node->as<AstExprGroup>())
+            return isExprSideEffectFree(expr->expr);
+        else if (AstExprTypeAssertion* expr = node->as<AstExprTypeAssertion>())
+            return isExprSideEffectFree(expr->expr);
+        else
+            return node->is<AstExprLocal>() || node->is<AstExprConstantNil>() || node->is<AstExprConstantBool>() ||
+                   node->is<AstExprConstantNumber>() || node->is<AstExprConstantString>() || node->is<AstExprVarargs>() ||
+                   node->is<AstExprFunction>();
+    }
+
+    // Optimization: table constructors are normally built in a fresh register and moved to a non-temporary target afterwards, since items may
+    // refer to the target; when they can't, the table can be constructed in place
+    bool canCompileInPlace(AstExpr* node, uint8_t target)
+    {
+        if (options.optimizationLevel == 0)
+            return false;
+
+        while (true)
+        {
+            if (AstExprGroup* expr = node->as<AstExprGroup>())
+                node = expr->expr;
+            else if (AstExprTypeAssertion* expr = node->as<AstExprTypeAssertion>())
+                node = expr->expr;
+            else
+                break;
+        }
+
+        return node->is<AstExprTable>() && isExprIndependentOf(node, target);
+    }
+
     void compileExprTable(AstExprTable* expr, uint8_t target, bool targetTemp)
     {
         // Optimization: if the table is empty, we can compute it directly into the target
         if (expr->items.size == 0)
         {
-            TableShape shape = tableShapes[expr];
+            const TableShape& shape = tableShapes[expr];
+
+            // the predicted size may depend on the code of methods that the constructor calls
+            for (AstExprFunction* method : shape.methods)
+                recordDependency(method);
 
             bytecode.addDebugRemark("allocation: table hash %d", shape.hashSize);
 
@@ -1804,6 +2209,15 @@ struct Compiler
     {
         setDebugLine(expr); // normally compileExpr sets up line info, but compileExprIndexName can be called directly
 
+        // Optimization: fields of tables that don't escape are kept in registers
+        if (int reg = getScalarFieldReg(expr); reg >= 0)
+        {
+            if (target != reg)
+                bytecode.emitABC(LOP_MOVE, target, uint8_t(reg), 0);
+
+            return;
+        }
+
         // Optimization: index chains that start from global variables can be compiled into GETIMPORT statement
         AstExprGlobal* importRoot = 0;
         AstExprIndexName* import1 = 0;
@@ -2275,6 +2689,15 @@ struct Compiler
         }
         else if (AstExprIndexName* expr = node->as<AstExprIndexName>())
         {
+            if (int reg = getScalarFieldReg(expr); reg >= 0)
+            {
+                LValue result = {LValue::Kind_Local};
+                result.reg = uint8_t(reg);
+                result.location = node->location;
+
+                return result;
+            }
+
             LValue result = {LValue::Kind_IndexName};
             result.reg = compileExprAuto(expr->expr, rs);
             result.name = sref(expr->index);
@@ -2374,10 +2797,42 @@ struct Compiler
 
             return l && l->allocated ? l->reg : -1;
         }
+        else if (AstExprIndexName* expr = node->as<AstExprIndexName>())
+            return getScalarFieldReg(expr);
+        else if (AstExprCall* expr = node->as<AstExprCall>())
+        {
+            AstLocal* module = getBundleModule(expr);
+
+            return module ? getLocalReg(module) : -1;
+        }
         else
             return -1;
     }
 
+    AstLocal* getScalarField(AstExprIndexName* expr)
+    {
+        AstExprLocal* le = expr->expr->as<AstExprLocal>();
+        if (!le)
+            return nullptr;
+
+        ScalarTable* table = scalarTables.find(le->local);
+        if (!table)
+            return nullptr;
+
+        for (AstLocal& field : table->fields)
+            if (field.name == expr->index)
+                return &field;
+
+        return nullptr;
+    }
+
+    int getScalarFieldReg(AstExprIndexName* expr)
+    {
+        AstLocal* field = getScalarField(expr);
+
+        return field ? getLocalReg(field) : -1;
+    }
+
     bool isStatBreak(AstStat* node)
     {
         if (AstStatBlock* stat = node->as<AstStatBlock>())
@@ -2596,8 +3051,66 @@ struct Compiler
         }
     }
 
+    // Optimization: since the VM doesn't have tail calls, self-recursive tail calls would grow the stack on each iteration
+    // instead, we assign the call arguments to the function arguments and jump back to the start of the function
+    bool tryCompileSelfTailCall(AstStatReturn* stat)
+    {
+        AstExprCall* call = stat->list.size == 1 ? stat->list.data[0]->as<AstExprCall>() : nullptr;
+
+        if (!call || call->self || getFunctionExpr(call->func) != tailCallFunction)
+            return false;
+
+        // if the last argument expands to multiple values, the number of values isn't known until runtime
+        if (call->args.size > 0 && isExprMultRet(call->args.data[call->args.size - 1]))
+            return false;
+
+        AstExprFunction* func = tailCallFunction;
+
+        // arguments that are passed through unchanged don't need to be reassigned
+        auto isPassedThrough = [&](size_t i) {
+            AstExprLocal* le = call->args.data[i]->as<AstExprLocal>();
+            return i < func->args.size && le && le->local == func->args.data[i];
+        };
+
+        RegScope rs(this);
+
+        // all arguments have to be computed before any function argument is reassigned, since they may refer to the old values
+        uint8_t temp = allocReg(call, unsigned(call->args.size));
+
+        for (size_t i = 0; i < call->args.size; ++i)
+            if (!isPassedThrough(i))
+                compileExprTempTop(call->args.data[i], uint8_t(temp + i));
+
+        // each iteration gets a fresh set of locals, so upvalues that refer to the current ones, including arguments, need to be closed before
+        // the arguments are reassigned
+        closeLocals(0);
+
+        for (size_t i = 0; i < func->args.size; ++i)
+        {
+            Local* arg = locals.find(func->args.data[i]);
+            LUAU_ASSERT(arg);
+
+            if (i >= call->args.size)
+                bytecode.emitABC(LOP_LOADNIL, arg->reg, 0, 0);
+            else if (!isPassedThrough(i))
+                bytecode.emitABC(LOP_MOVE, arg->reg, uint8_t(temp + i), 0);
+        }
+
+        size_t backLabel = bytecode.emitLabel();
+
+        bytecode.emitAD(LOP_JUMPBACK, 0, 0);
+
+        if (!bytecode.patchJumpD(backLabel, tailCallLabel))
+            CompileError::raise(stat->location, "Exceeded jump distance limit; simplify the code to compile");
+
+        return true;
+    }
+
     void compileStatReturn(AstStatReturn* stat)
     {
+        if (tailCallFunction && tryCompileSelfTailCall(stat))
+            return;
+
         RegScope rs(this);
 
         uint8_t temp = 0;
@@ -2619,12 +3132,50 @@ struct Compiler
                 }
         }
 
+        // Optimization: when the leading values are the last locals in the frame, the rest can be computed directly after them
+        size_t prefix = 0;
+
+        if (!consecutive && options.optimizationLevel >= 1 && stat->list.size > 0)
+        {
+            int reg = getExprLocalReg(stat->list.data[0]);
+
+            while (reg >= 0 && prefix < stat->list.size && getExprLocalReg(stat->list.data[prefix]) == reg + int(prefix))
+                prefix++;
+
+            // the locals are read when the function returns, so the remaining values must not be able to change them
+            bool prefixStable = true;
+
+            for (size_t i = 0; i < prefix && prefixStable; ++i)
+            {
+                AstExprLocal* le = getExprLocal(stat->list.data[i]);
+                Variable* lv = le ? variables.find(le->local) : nullptr;
+
+                prefixStable = lv && !lv->written;
+            }
+
+            if (!prefixStable)
+            {
+                prefixStable = true;
+
+                for (size_t i = prefix; i < stat->list.size && prefixStable; ++i)
+                    prefixStable = isExprSideEffectFree(stat->list.data[i]);
+            }
+
+            if (prefix > 0 && prefixStable && reg + int(prefix) == int(regTop))
+                temp = uint8_t(reg);
+            else
+                prefix = 0;
+        }
+
         if (!consecutive && stat->list.size > 0)
         {
-            temp = allocReg(stat, unsigned(stat->list.size));
+            uint8_t reg = allocReg(stat, unsigned(stat->list.size - prefix));
+            LUAU_ASSERT(prefix == 0 || reg == temp + prefix);
+
+            temp = uint8_t(reg - prefix);
 
             // Note: if the last element is a function call or a vararg specifier, then we need to somehow return all values that that call returned
-            for (size_t i = 0; i < stat->list.size; ++i)
+            for (size_t i = prefix; i < stat->list.size; ++i)
                 if (i + 1 == stat->list.size)
                     multRet = compileExprTempMultRet(stat->list.data[i], uint8_t(temp + i));
                 else
@@ -2673,6 +3224,27 @@ struct Compiler
                     return;
                 }
             }
+            else if (AstExprCall* call = stat->values.data[0]->as<AstExprCall>(); call && getBundleModule(call))
+            {
+                Variable* lv = variables.find(stat->vars.data[0]);
+
+                // module results in a bundle are never reassigned
+                if (int reg = getExprLocalReg(call); reg >= 0 && (!lv || !lv->written))
+                {
+                    pushLocal(stat->vars.data[0], uint8_t(reg));
+                    return;
+                }
+            }
+        }
+
+        // Optimization: tables that don't escape are replaced with a set of locals, one per field
+        if (stat->vars.size == 1)
+        {
+            if (ScalarTable* table = scalarTables.find(stat->vars.data[0]); table && canAllocateScalarTable(*table))
+            {
+                compileScalarTable(stat, *table);
+                return;
+            }
         }
 
         // note: allocReg in this case allocates into parent block register - note that we don't have RegScope here
@@ -2684,6 +3256,31 @@ struct Compiler
             pushLocal(stat->vars.data[i], uint8_t(vars + i));
     }
 
+    bool canAllocateScalarTable(const ScalarTable& table)
+    {
+        // we fall back to a regular table if the fields would push the function close to register limits
+        return localStack.size() + table.fields.size() < kMaxLocalCount / 2 && regTop + table.fields.size() < kMaxRegisterCount / 2;
+    }
+
+    void compileScalarTable(AstStatLocal* stat, ScalarTable& table)
+    {
+        AstExprTable* expr = stat->values.data[0]->as<AstExprTable>();
+        LUAU_ASSERT(expr && expr->items.size <= table.fields.size());
+
+        // note: allocReg in this case allocates into parent block register - note that we don't have RegScope here
+        uint8_t fields = allocReg(stat, unsigned(table.fields.size()));
+
+        for (size_t i = 0; i < expr->items.size; ++i)
+            compileExpr(expr->items.data[i].value, uint8_t(fields + i));
+
+        // fields that are only assigned after construction start as nil
+        for (size_t i = expr->items.size; i < table.fields.size(); ++i)
+            bytecode.emitABC(LOP_LOADNIL, uint8_t(fields + i), 0, 0);
+
+        for (size_t i = 0; i < table.fields.size(); ++i)
+            pushLocal(&table.fields[i], uint8_t(fields + i));
+    }
+
     bool tryCompileUnrolledFor(AstStatFor* stat, int thresholdBase, int thresholdMaxBoost)
     {
         Constant one = {Constant::Type_Number};
@@ -2693,6 +3290,18 @@ struct Compiler
         Constant toc = getConstant(stat->to);
         Constant stepc = stat->step ? getConstant(stat->step) : one;
 
+        // when execution profile is available, we don't unroll loops that never ran and are more aggressive with loops that run often
+        ProfileHeat heat = getProfileHeat(stat);
+
+        if (heat == ProfileHeat::Cold)
+        {
+            bytecode.addDebugRemark("loop unroll failed: cold loop");
+            return false;
+        }
+
+        if (heat == ProfileHeat::Hot)
+            thresholdBase = thresholdBase * FInt::LuauCompileProfileHotBoost / 100;
+
         int tripCount = (fromc.type == Constant::Type_Number && toc.type == Constant::Type_Number && stepc.type == Constant::Type_Number)
                             ? getTripCount(fromc.valueNumber, toc.valueNumber, stepc.valueNumber)
                             : -1;
@@ -2754,7 +3363,7 @@ struct Compiler
             locstants[var].type = Constant::Type_Number;
             locstants[var].valueNumber = from + iv * step;
 
-            foldConstants(constants, variables, locstants, builtinsFold, stat);
+            foldConstants(constants, variables, locstants, builtinsFold, fieldsFold, stat);
 
             size_t iterJumps = loopJumps.size();
 
@@ -2782,7 +3391,7 @@ struct Compiler
         // clean up fold state in case we need to recompile - normally we compile the loop body once, but due to inlining we may need to do it again
         locstants[var].type = Constant::Type_Unknown;
 
-        foldConstants(constants, variables, locstants, builtinsFold, stat);
+        foldConstants(constants, variables, locstants, builtinsFold, fieldsFold, stat);
     }
 
     void compileStatFor(AstStatFor* stat)
@@ -2978,10 +3587,48 @@ struct Compiler
 
                 return true;
             }
+
+            bool visit(AstExprIndexName* node) override
+            {
+                int reg = self->getScalarFieldReg(node);
+
+                if (reg < 0)
+                    return true;
+
+                if (assigned[reg])
+                    conflict[reg] = true;
+
+                return false;
+            }
         };
 
         Visitor visitor(this);
 
+        // Optimization: assignments like a, b = a, c don't change the register of a, so subsequent uses of a don't conflict with it
+        std::bitset<256> unchanged;
+
+        if (options.optimizationLevel >= 1)
+        {
+            std::bitset<256> seen;
+            std::bitset<256> repeated;
+
+            for (size_t i = 0; i < vars.size(); ++i)
+            {
+                const LValue& li = vars[i].lvalue;
+
+                if (li.kind == LValue::Kind_Local)
+                {
+                    repeated[li.reg] = repeated[li.reg] || seen[li.reg];
+                    seen[li.reg] = true;
+
+                    if (i < values.size && getExprLocalReg(values.data[i]) == int(li.reg))
+                        unchanged[li.reg] = true;
+                }
+            }
+
+            unchanged &= ~repeated;
+        }
+
         if (FFlag::LuauMultiAssignmentConflictFix)
         {
             // mark any registers that are used *after* assignment as conflicting
@@ -2996,7 +3643,7 @@ struct Compiler
                     if (i < values.size)
                         values.data[i]->visit(&visitor);
 
-                    visitor.assigned[li.reg] = true;
+                    visitor.assigned[li.reg] = !unchanged[li.reg];
                 }
             }
 
@@ -3020,7 +3667,7 @@ struct Compiler
                     values.data[i]->visit(&visitor);
 
                 if (li.kind == LValue::Kind_Local)
-                    visitor.assigned[li.reg] = true;
+                    visitor.assigned[li.reg] = !unchanged[li.reg];
             }
         }
 
@@ -3064,7 +3711,7 @@ struct Compiler
             // Optimization: assign to locals directly
             if (var.kind == LValue::Kind_Local)
             {
-                compileExpr(stat->values.data[0], var.reg);
+                compileExpr(stat->values.data[0], var.reg, canCompileInPlace(stat->values.data[0], var.reg));
             }
             else
             {
@@ -3116,7 +3763,7 @@ struct Compiler
                 {
                     var.valueReg = (var.conflictReg == kInvalidReg) ? var.lvalue.reg : var.conflictReg;
 
-                    compileExpr(stat->values.data[i], var.valueReg);
+                    compileExpr(stat->values.data[i], var.valueReg, canCompileInPlace(stat->values.data[i], var.valueReg));
                 }
                 else
                 {
@@ -3234,6 +3881,54 @@ struct Compiler
         compileAssign(var, reg);
     }
 
+    // dependencies of a bundle run as part of the bundle chunk; module result is kept in a local that require calls refer to
+    void compileStatBundleModule(AstStatBlock* stat, AstLocal* module)
+    {
+        uint8_t reg = allocReg(stat, 1);
+
+        {
+            RegScope rs(this);
+
+            size_t oldLocals = localStack.size();
+
+            AstStatReturn* result = stat->body.size > 0 ? stat->body.data[stat->body.size - 1]->as<AstStatReturn>() : nullptr;
+
+            for (size_t i = 0; i < stat->body.size; ++i)
+                if (stat->body.data[i] != result)
+                    compileStat(stat->body.data[i]);
+
+            if (result)
+            {
+                setDebugLine(result);
+
+                if (options.coverageLevel >= 1 && needsCoverage(result))
+                    bytecode.emitABC(LOP_COVERAGE, 0, 0, 0);
+
+                if (result->list.size > 0)
+                    compileExprTemp(result->list.data[0], reg);
+                else
+                    bytecode.emitABC(LOP_LOADNIL, reg, 0, 0);
+
+                // extra values are discarded but they still need to be evaluated
+                for (size_t i = 1; i < result->list.size; ++i)
+                {
+                    RegScope rsi(this);
+                    compileExprAuto(result->list.data[i], rsi);
+                }
+            }
+            else
+            {
+                bytecode.emitABC(LOP_LOADNIL, reg, 0, 0);
+            }
+
+            closeLocals(oldLocals);
+
+            popLocals(oldLocals);
+        }
+
+        pushLocal(module, reg);
+    }
+
     void compileStat(AstStat* node)
     {
         setDebugLine(node);
@@ -3243,7 +3938,11 @@ struct Compiler
             bytecode.emitABC(LOP_COVERAGE, 0, 0, 0);
         }
 
-        if (AstStatBlock* stat = node->as<AstStatBlock>())
+        if (AstStatBlock* stat = node->as<AstStatBlock>(); stat && bundle && bundle->roots.contains(stat))
+        {
+            compileStatBundleModule(stat, &bundle->exports[bundle->roots[stat]]);
+        }
+        else if (AstStatBlock* stat = node->as<AstStatBlock>())
         {
             RegScope rs(this);
 
@@ -3612,6 +4311,22 @@ struct Compiler
             return false;
         }
 
+        bool visit(AstExprIndexName* node) override
+        {
+            AstLocal* field = self->getScalarField(node);
+            if (!field)
+                return true;
+
+            // the table may be replaced by its fields, in which case only the field is allocated
+            AstExprLocal* expr = node->expr->as<AstExprLocal>();
+            LUAU_ASSERT(expr);
+
+            if (!self->locals[expr->local].allocated && !self->locals[field].allocated && !undef)
+                undef = expr->local;
+
+            return false;
+        }
+
         bool visit(AstExprFunction* node) override
         {
             const Function* f = self->functions.find(node);
@@ -3718,6 +4433,9 @@ struct Compiler
         unsigned int stackSize = 0;
         bool canInline = false;
         bool returnsOne = false;
+
+        // used by incremental compilation to detect changes in the function that its dependents can observe
+        uint64_t signature = 0;
     };
 
     struct Local
@@ -3776,12 +4494,34 @@ struct Compiler
     DenseHashMap<AstExpr*, Constant> constants;
     DenseHashMap<AstLocal*, Constant> locstants;
     DenseHashMap<AstExprTable*, TableShape> tableShapes;
+    DenseHashMap<AstLocal*, ScalarTable> scalarTables;
     DenseHashMap<AstExprCall*, int> builtins;
     const DenseHashMap<AstExprCall*, int>* builtinsFold = nullptr;
+    const DenseHashMap<AstExprIndexName*, AstExpr*>* fieldsFold = nullptr;
+    DenseHashMap<AstName, AstStatTypeAlias*> typeAliases;
 
     unsigned int regTop = 0;
     unsigned int stackSize = 0;
 
+    int profileMaxHits = 0;
+
+    Bundle* bundle = nullptr;
+
+    // incremental compilation state; cachedFunctions refer to the previous compilation and are indexed by path
+    CompileCache* cache = nullptr;
+    CompileCache nextCache;
+    FunctionTree functionTree;
+    DenseHashMap<std::string, const CompileCache::Function*> cachedFunctions{""};
+    std::vector<uint32_t> cachedFunctionIds;
+    std::vector<std::pair<AstExprFunction*, uint32_t>> reusedFunctions;
+
+    AstExprFunction* compilingFunction = nullptr;
+
+    AstExprFunction* tailCallFunction = nullptr;
+    size_t tailCallLabel = 0;
+    std::vector<CompileCache::Dependency> dependencies;
+    DenseHashSet<AstExprFunction*> recordedDependencies{nullptr};
+
     bool getfenvUsed = false;
     bool setfenvUsed = false;
 
@@ -3794,45 +4534,65 @@ struct Compiler
     std::vector<std::unique_ptr<char[]>> interpStrings;
 };
 
-void compileOrThrow(BytecodeBuilder& bytecode, const ParseResult& parseResult, const AstNameTable& names, const CompileOptions& inputOptions)
+static void compileRoot(BytecodeBuilder& bytecode, AstStatBlock* root, const AstNameTable& names, const CompileOptions& options, Bundle* bundle,
+    const std::vector<BundleModule>* modules, CompileCache* cache = nullptr, const std::string_view* source = nullptr)
 {
-    LUAU_TIMETRACE_SCOPE("compileOrThrow", "Compiler");
-
-    LUAU_ASSERT(parseResult.root);
-    LUAU_ASSERT(parseResult.errors.empty());
-
-    CompileOptions options = inputOptions;
-
-    for (const HotComment& hc : parseResult.hotcomments)
-        if (hc.header && hc.content.compare(0, 9, "optimize ") == 0)
-            options.optimizationLevel = std::max(0, std::min(2, atoi(hc.content.c_str() + 9)));
-
-    AstStatBlock* root = parseResult.root;
-
     Compiler compiler(bytecode, options);
 
+    AstExprFunction main(root->location, /*generics= */ AstArray<AstGenericType>(), /*genericPacks= */ AstArray<AstGenericTypePack>(),
+        /* self= */ nullptr, AstArray<AstLocal*>(), /* vararg= */ true, /* varargLocation= */ Luau::Location(), root, /* functionDepth= */ 0,
+        /* debugname= */ AstName());
+
     // since access to some global objects may result in values that change over time, we block imports from non-readonly tables
     assignMutable(compiler.globals, names, options.mutableGlobals);
 
     // this pass analyzes mutability of locals/globals and associates locals with their initial values
     trackValues(compiler.globals, compiler.variables, root);
 
+    if (bundle)
+    {
+        LUAU_ASSERT(modules);
+
+        // this pass finds fields of module results that are never mutated, so that other modules can use their values
+        analyzeBundleExports(*bundle, *modules, names, compiler.variables);
+
+        compiler.bundle = bundle;
+
+        // propagating constants across modules relies on builtin folding so it's enabled on the same optimization level
+        if (options.optimizationLevel >= 2)
+            compiler.fieldsFold = &bundle->fields;
+    }
+
     // builtin folding is enabled on optimization level 2 since we can't deoptimize folding at runtime
     if (options.optimizationLevel >= 2)
         compiler.builtinsFold = &compiler.builtins;
 
+    // O0 keeps every move the compiler emits so that the bytecode mirrors the source as closely as possible
+    bytecode.setMoveElimination(options.optimizationLevel >= 1);
+    bytecode.setDebugInfoSection(options.debugInfoSection >= 1);
+    bytecode.setConstantPool(options.constantPool >= 1);
+
     if (options.optimizationLevel >= 1)
     {
         // this pass tracks which calls are builtins and can be compiled more efficiently
         analyzeBuiltins(compiler.builtins, compiler.globals, compiler.variables, options, root);
 
         // this pass analyzes constantness of expressions
-        foldConstants(compiler.constants, compiler.variables, compiler.locstants, compiler.builtinsFold, root);
+        foldConstants(compiler.constants, compiler.variables, compiler.locstants, compiler.builtinsFold, compiler.fieldsFold, root);
 
         // this pass analyzes table assignments to estimate table shapes for initially empty tables
         predictTableShapes(compiler.tableShapes, root);
     }
 
+    // this pass finds tables that never escape the function so that their fields can be kept in registers
+    // note that the tables disappear from the debug information, so we only do this when locals aren't visible to the debugger
+    if (options.optimizationLevel >= 2 && options.debugLevel <= 1)
+        analyzeTableEscapes(compiler.scalarTables, compiler.variables, names, root);
+
+    // this pass collects type aliases so that argument annotations can be resolved to primitive types
+    if (options.typeInfoLevel >= 1)
+        buildTypeMap(compiler.typeAliases, root);
+
     // this visitor tracks calls to getfenv/setfenv and disables some optimizations when they are found
     if (options.optimizationLevel >= 1 && (names.get("getfenv").value || names.get("setfenv").value))
     {
@@ -3840,6 +4600,29 @@ void compileOrThrow(BytecodeBuilder& bytecode, const ParseResult& parseResult, c
         root->visit(&fenvVisitor);
     }
 
+    if (cache)
+    {
+        LUAU_ASSERT(source);
+
+        // this pass assigns stable identifiers to functions and hashes their source so that unchanged functions can be reused
+        buildFunctionTree(compiler.functionTree, &main, *source);
+        hashFunctionScopes(compiler.functionTree, &main, compiler.variables, compiler.locstants);
+
+        compiler.cache = cache;
+        compiler.nextCache.contextHash =
+            hashCompileContext(options, compiler.globals, compiler.getfenvUsed, compiler.setfenvUsed, compiler.typeAliases, *source);
+
+        // execution profiles aren't part of the cache key, so we don't reuse code that could have been compiled with a different profile
+        if (cache->contextHash == compiler.nextCache.contextHash && !options.profileLineHits)
+        {
+            for (const CompileCache::Function& cf : cache->functions)
+                if (!cf.path.empty())
+                    compiler.cachedFunctions[cf.path] = &cf;
+
+            compiler.cachedFunctionIds.resize(cache->functions.size(), ~0u);
+        }
+    }
+
     // gathers all functions with the invariant that all function references are to functions earlier in the list
     // for example, function foo() return function() end end will result in two vector entries, [0] = anonymous and [1] = foo
     std::vector<AstExprFunction*> functions;
@@ -3849,9 +4632,6 @@ void compileOrThrow(BytecodeBuilder& bytecode, const ParseResult& parseResult, c
     for (AstExprFunction* expr : functions)
         compiler.compileFunction(expr);
 
-    AstExprFunction main(root->location, /*generics= */ AstArray<AstGenericType>(), /*genericPacks= */ AstArray<AstGenericTypePack>(),
-        /* self= */ nullptr, AstArray<AstLocal*>(), /* vararg= */ true, /* varargLocation= */ Luau::Location(), root, /* functionDepth= */ 0,
-        /* debugname= */ AstName());
     uint32_t mainid = compiler.compileFunction(&main);
 
     const Compiler::Function* mainf = compiler.functions.find(&main);
@@ -3859,13 +4639,74 @@ void compileOrThrow(BytecodeBuilder& bytecode, const ParseResult& parseResult, c
 
     bytecode.setMainFunction(mainid);
     bytecode.finalize();
+
+    if (cache)
+    {
+        for (auto [func, id] : compiler.reusedFunctions)
+        {
+            const Compiler::Function* f = compiler.functions.find(func);
+            LUAU_ASSERT(f);
+
+            CompileCache::Function& cf = compiler.nextCache.functions[f->id];
+            cf = std::move(cache->functions[id]);
+
+            // saved line information needs to match the new location of the function
+            int lineOffset = int(func->location.begin.line) - cf.line;
+
+            for (int& line : cf.code.lines)
+                line += lineOffset;
+
+            cf.code.debuglinedefined += lineOffset;
+            cf.line = int(func->location.begin.line);
+            cf.id = f->id;
+        }
+
+        *cache = std::move(compiler.nextCache);
+    }
+}
+
+void compileOrThrow(BytecodeBuilder& bytecode, const ParseResult& parseResult, const AstNameTable& names, const CompileOptions& inputOptions)
+{
+    LUAU_TIMETRACE_SCOPE("compileOrThrow", "Compiler");
+
+    LUAU_ASSERT(parseResult.root);
+    LUAU_ASSERT(parseResult.errors.empty());
+
+    CompileOptions options = inputOptions;
+
+    for (const HotComment& hc : parseResult.hotcomments)
+        if (hc.header && hc.content.compare(0, 9, "optimize ") == 0)
+            options.optimizationLevel = std::max(0, std::min(2, atoi(hc.content.c_str() + 9)));
+
+    compileRoot(bytecode, parseResult.root, names, options, nullptr, nullptr);
 }
 
-void compileOrThrow(BytecodeBuilder& bytecode, const std::string& source, const CompileOptions& options, const ParseOptions& parseOptions)
+void compileBundleOrThrow(BytecodeBuilder& bytecode, const std::vector<BundleModule>& modules, const AstNameTable& names, const CompileOptions& options)
+{
+    LUAU_TIMETRACE_SCOPE("compileBundleOrThrow", "Compiler");
+
+    LUAU_ASSERT(!modules.empty());
+
+    Bundle bundle;
+    resolveBundle(bundle, modules);
+
+    // the bundle chunk runs bundled module roots in order, with the entry module last so that its return statement returns from the chunk
+    std::vector<AstStat*> body;
+    body.reserve(bundle.order.size());
+
+    for (size_t index : bundle.order)
+        body.push_back(modules[index].root);
+
+    AstStatBlock root(modules[0].root->location, AstArray<AstStat*>{body.data(), body.size()});
+
+    compileRoot(bytecode, &root, names, options, &bundle, &modules);
+}
+
+void compileOrThrow(BytecodeBuilder& bytecode, std::string_view source, const CompileOptions& options, const ParseOptions& parseOptions)
 {
     Allocator allocator;
     AstNameTable names(allocator);
-    ParseResult result = Parser::parse(source.c_str(), source.size(), names, allocator, parseOptions);
+    ParseResult result = Parser::parse(source.data(), source.size(), names, allocator, parseOptions);
 
     if (!result.errors.empty())
         throw ParseErrors(result.errors);
@@ -3873,13 +4714,36 @@ void compileOrThrow(BytecodeBuilder& bytecode, const std::string& source, const
     compileOrThrow(bytecode, result, names, options);
 }
 
-std::string compile(const std::string& source, const CompileOptions& options, const ParseOptions& parseOptions, BytecodeEncoder* encoder)
+void compileOrThrow(
+    BytecodeBuilder& bytecode, std::string_view source, CompileCache& cache, const CompileOptions& inputOptions, const ParseOptions& parseOptions)
+{
+    LUAU_TIMETRACE_SCOPE("compileOrThrow", "Compiler");
+
+    Allocator allocator;
+    AstNameTable names(allocator);
+    ParseResult result = Parser::parse(source.data(), source.size(), names, allocator, parseOptions);
+
+    if (!result.errors.empty())
+        throw ParseErrors(result.errors);
+
+    CompileOptions options = inputOptions;
+
+    for (const HotComment& hc : result.hotcomments)
+        if (hc.header && hc.content.compare(0, 9, "optimize ") == 0)
+            options.optimizationLevel = std::max(0, std::min(2, atoi(hc.content.c_str() + 9)));
+
+    bytecode.setFunctionSaving(true);
+
+    compileRoot(bytecode, result.root, names, options, nullptr, nullptr, &cache, &source);
+}
+
+std::string compile(std::string_view source, const CompileOptions& options, const ParseOptions& parseOptions, BytecodeEncoder* encoder)
 {
     LUAU_TIMETRACE_SCOPE("compile", "Compiler");
 
     Allocator allocator;
     AstNameTable names(allocator);
-    ParseResult result = Parser::parse(source.c_str(), source.size(), names, allocator, parseOptions);
+    ParseResult result = Parser::parse(source.data(), source.size(), names, allocator, parseOptions);
 
     if (!result.errors.empty())
     {
@@ -197,17 +197,20 @@ struct ConstantVisitor : AstVisitor
     DenseHashMap<AstLocal*, Constant>& locals;
 
     const DenseHashMap<AstExprCall*, int>* builtins;
+    const DenseHashMap<AstExprIndexName*, AstExpr*>* fields;
 
     bool wasEmpty = false;
 
     std::vector<Constant> builtinArgs;
 
     ConstantVisitor(DenseHashMap<AstExpr*, Constant>& constants, DenseHashMap<AstLocal*, Variable>& variables,
-        DenseHashMap<AstLocal*, Constant>& locals, const DenseHashMap<AstExprCall*, int>* builtins)
+        DenseHashMap<AstLocal*, Constant>& locals, const DenseHashMap<AstExprCall*, int>* builtins,
+        const DenseHashMap<AstExprIndexName*, AstExpr*>* fields)
         : constants(constants)
         , variables(variables)
         , locals(locals)
         , builtins(builtins)
+        , fields(fields)
     {
         // since we do a single pass over the tree, if the initial state was empty we don't need to clear out old entries
         wasEmpty = constants.empty() && locals.empty();
@@ -296,6 +299,11 @@ struct ConstantVisitor : AstVisitor
         else if (AstExprIndexName* expr = node->as<AstExprIndexName>())
         {
             analyze(expr->expr);
+
+            // fields of other modules in a bundle that are known to hold a specific value
+            if (AstExpr* const* value = fields ? fields->find(expr) : nullptr)
+                if (const Constant* c = constants.find(*value))
+                    result = *c;
         }
         else if (AstExprIndexExpr* expr = node->as<AstExprIndexExpr>())
         {
@@ -437,9 +445,10 @@ struct ConstantVisitor : AstVisitor
 };
 
 void foldConstants(DenseHashMap<AstExpr*, Constant>& constants, DenseHashMap<AstLocal*, Variable>& variables,
-    DenseHashMap<AstLocal*, Constant>& locals, const DenseHashMap<AstExprCall*, int>* builtins, AstNode* root)
+    DenseHashMap<AstLocal*, Constant>& locals, const DenseHashMap<AstExprCall*, int>* builtins,
+    const DenseHashMap<AstExprIndexName*, AstExpr*>* fields, AstNode* root)
 {
-    ConstantVisitor visitor{constants, variables, locals, builtins};
+    ConstantVisitor visitor{constants, variables, locals, builtins, fields};
     root->visit(&visitor);
 }
 
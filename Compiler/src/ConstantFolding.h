@@ -43,7 +43,8 @@ struct Constant
 };
 
 void foldConstants(DenseHashMap<AstExpr*, Constant>& constants, DenseHashMap<AstLocal*, Variable>& variables,
-    DenseHashMap<AstLocal*, Constant>& locals, const DenseHashMap<AstExprCall*, int>* builtins, AstNode* root);
+    DenseHashMap<AstLocal*, Constant>& locals, const DenseHashMap<AstExprCall*, int>* builtins,
+    const DenseHashMap<AstExprIndexName*, AstExpr*>* fields, AstNode* root);
 
 } // namespace Compile
 } // namespace Luau
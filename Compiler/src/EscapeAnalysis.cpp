@@ -0,0 +1,164 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#include "EscapeAnalysis.h"
+
+#include "Luau/Lexer.h"
+
+namespace Luau
+{
+namespace Compile
+{
+
+// conservative limit for the number of registers a single table can be replaced with
+static const size_t kMaxScalarFields = 8;
+
+struct EscapeVisitor : AstVisitor
+{
+    struct Candidate
+    {
+        AstLocal* local = nullptr;
+        std::vector<AstName> keys;
+        bool escaped = false;
+    };
+
+    const DenseHashMap<AstLocal*, Variable>& variables;
+    const AstNameTable& names;
+
+    DenseHashMap<AstLocal*, size_t> candidateIndex;
+    std::vector<Candidate> candidates;
+
+    EscapeVisitor(const DenseHashMap<AstLocal*, Variable>& variables, const AstNameTable& names)
+        : variables(variables)
+        , names(names)
+        , candidateIndex(nullptr)
+    {
+    }
+
+    Candidate* getCandidate(AstLocal* local)
+    {
+        const size_t* index = candidateIndex.find(local);
+
+        return index ? &candidates[*index] : nullptr;
+    }
+
+    void addKey(Candidate& c, AstName key)
+    {
+        for (AstName k : c.keys)
+            if (k == key)
+                return;
+
+        c.keys.push_back(key);
+
+        // tables with too many fields would use too many registers
+        if (c.keys.size() > kMaxScalarFields)
+            c.escaped = true;
+    }
+
+    bool visit(AstStatLocal* node) override
+    {
+        if (node->vars.size != 1 || node->values.size != 1)
+            return true;
+
+        AstLocal* local = node->vars.data[0];
+        AstExprTable* table = node->values.data[0]->as<AstExprTable>();
+
+        if (!table || table->items.size > kMaxScalarFields)
+            return true;
+
+        // the local must keep referring to the same table
+        const Variable* v = variables.find(local);
+        if (!v || v->written)
+            return true;
+
+        Candidate c;
+        c.local = local;
+
+        for (const AstExprTable::Item& item : table->items)
+        {
+            if (item.kind != AstExprTable::Item::Record)
+                return true;
+
+            AstExprConstantString* key = item.key->as<AstExprConstantString>();
+            LUAU_ASSERT(key);
+
+            AstName name = names.getWithType(key->value.data, key->value.size).first;
+
+            // record keys are always identifiers, so they are in the name table; we need them to be unique to map items to fields 1-1
+            if (!name.value)
+                return true;
+
+            for (AstName k : c.keys)
+                if (k == name)
+                    return true;
+
+            c.keys.push_back(name);
+        }
+
+        candidateIndex[local] = candidates.size();
+        candidates.push_back(std::move(c));
+
+        return true;
+    }
+
+    bool visit(AstExprIndexName* node) override
+    {
+        if (AstExprLocal* expr = node->expr->as<AstExprLocal>())
+        {
+            if (Candidate* c = getCandidate(expr->local))
+            {
+                // fields can only be kept in registers of the function that owns the table
+                if (expr->upvalue)
+                    c->escaped = true;
+                else
+                    addKey(*c, node->index);
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool visit(AstExprCall* node) override
+    {
+        // method calls pass the table as the first argument
+        if (node->self)
+            if (AstExprIndexName* func = node->func->as<AstExprIndexName>())
+                if (AstExprLocal* expr = func->expr->as<AstExprLocal>())
+                    if (Candidate* c = getCandidate(expr->local))
+                        c->escaped = true;
+
+        return true;
+    }
+
+    bool visit(AstExprLocal* node) override
+    {
+        // any use of the table other than a field access with a constant key may observe the table itself
+        if (Candidate* c = getCandidate(node->local))
+            c->escaped = true;
+
+        return false;
+    }
+};
+
+void analyzeTableEscapes(DenseHashMap<AstLocal*, ScalarTable>& tables, const DenseHashMap<AstLocal*, Variable>& variables,
+    const AstNameTable& names, AstNode* root)
+{
+    EscapeVisitor visitor{variables, names};
+    root->visit(&visitor);
+
+    for (const EscapeVisitor::Candidate& c : visitor.candidates)
+    {
+        // tables without any fields are left alone; they are rare in real code but are commonly used to create garbage on purpose
+        if (c.escaped || c.keys.empty())
+            continue;
+
+        ScalarTable& table = tables[c.local];
+        table.fields.reserve(c.keys.size());
+
+        for (AstName key : c.keys)
+            table.fields.emplace_back(key, c.local->location, nullptr, c.local->functionDepth, c.local->loopDepth, nullptr);
+    }
+}
+
+} // namespace Compile
+} // namespace Luau
@@ -0,0 +1,31 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#pragma once
+
+#include "Luau/Ast.h"
+#include "Luau/DenseHash.h"
+
+#include "ValueTracking.h"
+
+#include <vector>
+
+namespace Luau
+{
+class AstNameTable;
+}
+
+namespace Luau
+{
+namespace Compile
+{
+
+struct ScalarTable
+{
+    // one synthetic local per field; the first fields correspond to constructor items in order, the rest are only assigned after construction
+    std::vector<AstLocal> fields;
+};
+
+void analyzeTableEscapes(DenseHashMap<AstLocal*, ScalarTable>& tables, const DenseHashMap<AstLocal*, Variable>& variables,
+    const AstNameTable& names, AstNode* root);
+
+} // namespace Compile
+} // namespace Luau
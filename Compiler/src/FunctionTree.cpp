@@ -0,0 +1,321 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#include "FunctionTree.h"
+
+#include <algorithm>
+
+#include <string.h>
+
+namespace Luau
+{
+namespace Compile
+{
+
+static const uint64_t kHashSeed = 14695981039346656037ull;
+
+static uint64_t hashBytes(uint64_t hash, const char* data, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= uint8_t(data[i]);
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+static uint64_t hashString(const char* data)
+{
+    return data ? hashBytes(kHashSeed, data, strlen(data)) : 0;
+}
+
+struct SourceText
+{
+    std::string_view source;
+    std::vector<size_t> lineOffsets;
+
+    SourceText(std::string_view source)
+        : source(source)
+    {
+        lineOffsets.push_back(0);
+
+        for (size_t i = 0; i < source.size(); ++i)
+            if (source[i] == '\n')
+                lineOffsets.push_back(i + 1);
+    }
+
+    size_t getOffset(const Position& pos) const
+    {
+        if (pos.line >= lineOffsets.size())
+            return source.size();
+
+        return std::min(lineOffsets[pos.line] + pos.column, source.size());
+    }
+
+    uint64_t hash(uint64_t hash, size_t begin, size_t end) const
+    {
+        return begin < end ? hashBytes(hash, source.data() + begin, end - begin) : hash;
+    }
+
+    uint64_t hash(uint64_t hash, const Location& location) const
+    {
+        return this->hash(hash, getOffset(location.begin), getOffset(location.end));
+    }
+};
+
+struct FunctionTreeVisitor : AstVisitor
+{
+    FunctionTree& tree;
+
+    std::vector<AstExprFunction*> stack;
+    DenseHashMap<std::string, unsigned int> pathCounts{""};
+
+    FunctionTreeVisitor(FunctionTree& tree)
+        : tree(tree)
+    {
+    }
+
+    void declare(AstLocal* local)
+    {
+        LUAU_ASSERT(!stack.empty());
+
+        std::vector<AstLocal*>& locals = tree.functions[stack.back()].locals;
+
+        tree.locals[local] = unsigned(locals.size());
+        locals.push_back(local);
+    }
+
+    bool visit(AstExprFunction* node) override
+    {
+        FunctionNode& fn = tree.functions[node];
+
+        if (stack.empty())
+        {
+            fn.path = "main";
+        }
+        else
+        {
+            AstExprFunction* parent = stack.back();
+            FunctionNode& pn = tree.functions[parent];
+
+            // functions are named after their debug name along with the index among siblings with the same name
+            std::string base = pn.path + "/" + (node->debugname.value ? node->debugname.value : "");
+            unsigned int& count = pathCounts[base];
+
+            fn.path = base + "#" + std::to_string(count++);
+            fn.parent = parent;
+
+            pn.children.push_back(node);
+        }
+
+        tree.paths[fn.path] = node;
+
+        stack.push_back(node);
+
+        if (node->self)
+            declare(node->self);
+
+        for (AstLocal* arg : node->args)
+            declare(arg);
+
+        node->body->visit(this);
+
+        stack.pop_back();
+
+        return false;
+    }
+
+    bool visit(AstStatLocal* node) override
+    {
+        // note: values are visited first since the locals aren't in scope yet
+        for (AstExpr* expr : node->values)
+            expr->visit(this);
+
+        for (AstLocal* local : node->vars)
+            declare(local);
+
+        return false;
+    }
+
+    bool visit(AstStatLocalFunction* node) override
+    {
+        declare(node->name);
+
+        return true;
+    }
+
+    bool visit(AstStatFor* node) override
+    {
+        declare(node->var);
+
+        return true;
+    }
+
+    bool visit(AstStatForIn* node) override
+    {
+        for (AstLocal* local : node->vars)
+            declare(local);
+
+        return true;
+    }
+};
+
+void buildFunctionTree(FunctionTree& tree, AstExprFunction* root, std::string_view source)
+{
+    FunctionTreeVisitor visitor{tree};
+    root->visit(&visitor);
+
+    SourceText text{source};
+
+    for (auto& [func, fn] : tree.functions)
+    {
+        size_t begin = text.getOffset(func->location.begin);
+        size_t end = text.getOffset(func->location.end);
+
+        fn.hash = text.hash(kHashSeed, begin, end);
+
+        std::vector<Location> nested;
+
+        for (AstExprFunction* child : fn.children)
+            nested.push_back(child->location);
+
+        std::sort(nested.begin(), nested.end(), [](const Location& l, const Location& r) {
+            return l.begin < r.begin;
+        });
+
+        // nested functions are replaced with a marker so that the hash only changes when the function's own code changes
+        uint64_t ownHash = kHashSeed;
+        size_t offset = begin;
+
+        for (const Location& location : nested)
+        {
+            ownHash = text.hash(ownHash, offset, text.getOffset(location.begin));
+            ownHash = mixHash(ownHash, ~0ull);
+            offset = std::max(offset, text.getOffset(location.end));
+        }
+
+        fn.ownHash = text.hash(ownHash, offset, end);
+    }
+}
+
+static uint64_t hashConstant(uint64_t hash, const Constant& value)
+{
+    hash = mixHash(hash, value.type);
+
+    switch (value.type)
+    {
+    case Constant::Type_Boolean:
+        return mixHash(hash, value.valueBoolean);
+
+    case Constant::Type_Number:
+    {
+        uint64_t bits = 0;
+        static_assert(sizeof(bits) == sizeof(value.valueNumber), "Expecting double to be 64-bit");
+        memcpy(&bits, &value.valueNumber, sizeof(bits));
+        return mixHash(hash, bits);
+    }
+
+    case Constant::Type_String:
+        return mixHash(hashBytes(hash, value.valueString, value.stringLength), value.stringLength);
+
+    default:
+        return hash;
+    }
+}
+
+static void hashFunctionScope(FunctionTree& tree, AstExprFunction* func, uint64_t scopeHash, const DenseHashMap<AstLocal*, Variable>& variables,
+    const DenseHashMap<AstLocal*, Constant>& locstants)
+{
+    FunctionNode& fn = tree.functions[func];
+    fn.scopeHash = scopeHash;
+
+    // nested functions observe the code of this function along with the state of its locals
+    uint64_t hash = mixHash(scopeHash, fn.ownHash);
+
+    for (AstLocal* local : fn.locals)
+    {
+        const Variable* lv = variables.find(local);
+        const Constant* lc = locstants.find(local);
+
+        hash = mixHash(hash, lv && lv->written);
+        hash = lc ? hashConstant(hash, *lc) : mixHash(hash, ~0ull);
+    }
+
+    for (AstExprFunction* child : fn.children)
+        hashFunctionScope(tree, child, hash, variables, locstants);
+}
+
+void hashFunctionScopes(FunctionTree& tree, AstExprFunction* root, const DenseHashMap<AstLocal*, Variable>& variables,
+    const DenseHashMap<AstLocal*, Constant>& locstants)
+{
+    hashFunctionScope(tree, root, kHashSeed, variables, locstants);
+}
+
+uint64_t hashCompileContext(const CompileOptions& options, const DenseHashMap<AstName, Global>& globals, bool getfenvUsed, bool setfenvUsed,
+    const DenseHashMap<AstName, AstStatTypeAlias*>& typeAliases, std::string_view source)
+{
+    uint64_t hash = kHashSeed;
+
+    hash = mixHash(hash, options.optimizationLevel);
+    hash = mixHash(hash, options.debugLevel);
+    hash = mixHash(hash, options.coverageLevel);
+    hash = mixHash(hash, options.debugInfoSection);
+    hash = mixHash(hash, options.constantPool);
+    hash = mixHash(hash, options.typeInfoLevel);
+    hash = mixHash(hash, options.reverseArithConstants);
+    hash = mixHash(hash, hashString(options.vectorLib));
+    hash = mixHash(hash, hashString(options.vectorCtor));
+    hash = mixHash(hash, getfenvUsed);
+    hash = mixHash(hash, setfenvUsed);
+
+    // table iteration order depends on insertion order, so entries are combined in an order-independent way
+    uint64_t globalsHash = 0;
+
+    for (auto& [name, global] : globals)
+        globalsHash += mixHash(hashString(name.value), uint64_t(global));
+
+    hash = mixHash(hash, globalsHash);
+
+    // argument type annotations can refer to type aliases anywhere in the module
+    if (options.typeInfoLevel >= 1)
+    {
+        SourceText text{source};
+        uint64_t aliasesHash = 0;
+
+        // aliases declared more than once are stored as null and don't resolve to a type, so only their name contributes
+        for (auto& [name, alias] : typeAliases)
+            aliasesHash += alias ? text.hash(hashString(name.value), alias->location) : mixHash(hashString(name.value), ~0ull);
+
+        hash = mixHash(hash, aliasesHash);
+    }
+
+    return hash;
+}
+
+bool getUpvalueKey(const FunctionTree& tree, AstLocal* local, CompileCache::Upvalue& result)
+{
+    const unsigned int* index = tree.locals.find(local);
+    if (!index)
+        return false;
+
+    result.depth = local->functionDepth;
+    result.index = *index;
+    return true;
+}
+
+AstLocal* findUpvalue(const FunctionTree& tree, AstExprFunction* func, const CompileCache::Upvalue& key)
+{
+    for (const FunctionNode* fn = tree.functions.find(func); fn && fn->parent; fn = tree.functions.find(fn->parent))
+    {
+        if (fn->parent->functionDepth != key.depth)
+            continue;
+
+        const FunctionNode* pn = tree.functions.find(fn->parent);
+
+        return pn && key.index < pn->locals.size() ? pn->locals[key.index] : nullptr;
+    }
+
+    return nullptr;
+}
+
+} // namespace Compile
+} // namespace Luau
@@ -0,0 +1,72 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#pragma once
+
+#include "Luau/Ast.h"
+#include "Luau/CompileCache.h"
+#include "Luau/Compiler.h"
+#include "Luau/DenseHash.h"
+
+#include "ConstantFolding.h"
+#include "ValueTracking.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Luau
+{
+namespace Compile
+{
+
+struct FunctionNode
+{
+    // stable identifier of the function; see CompileCache
+    std::string path;
+
+    AstExprFunction* parent = nullptr;
+    std::vector<AstExprFunction*> children;
+
+    // locals declared by the function itself (including arguments) in declaration order
+    std::vector<AstLocal*> locals;
+
+    // hash of the function source text, and hash of the source text that excludes nested functions
+    uint64_t hash = 0;
+    uint64_t ownHash = 0;
+
+    // hash of all enclosing scopes; filled by hashFunctionScopes
+    uint64_t scopeHash = 0;
+};
+
+struct FunctionTree
+{
+    DenseHashMap<AstExprFunction*, FunctionNode> functions{nullptr};
+    DenseHashMap<std::string, AstExprFunction*> paths{""};
+
+    // index of the local in the declaration order of the function that declares it
+    DenseHashMap<AstLocal*, unsigned int> locals{nullptr};
+};
+
+inline uint64_t mixHash(uint64_t hash, uint64_t value)
+{
+    // FNV-1a over the 8 bytes of the value
+    for (int i = 0; i < 8; ++i)
+    {
+        hash ^= (value >> (i * 8)) & 0xff;
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+void buildFunctionTree(FunctionTree& tree, AstExprFunction* root, std::string_view source);
+void hashFunctionScopes(FunctionTree& tree, AstExprFunction* root, const DenseHashMap<AstLocal*, Variable>& variables,
+    const DenseHashMap<AstLocal*, Constant>& locstants);
+
+uint64_t hashCompileContext(const CompileOptions& options, const DenseHashMap<AstName, Global>& globals, bool getfenvUsed, bool setfenvUsed,
+    const DenseHashMap<AstName, AstStatTypeAlias*>& typeAliases, std::string_view source);
+
+bool getUpvalueKey(const FunctionTree& tree, AstLocal* local, CompileCache::Upvalue& result);
+AstLocal* findUpvalue(const FunctionTree& tree, AstExprFunction* func, const CompileCache::Upvalue& key);
+
+} // namespace Compile
+} // namespace Luau
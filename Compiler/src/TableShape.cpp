@@ -1,6 +1,8 @@
 // This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
 #include "TableShape.h"
 
+#include <algorithm>
+
 namespace Luau
 {
 namespace Compile
@@ -9,6 +11,12 @@ namespace Compile
 // conservative limit for the loop bound that establishes table array size
 static const int kMaxLoopBound = 16;
 
+// array size prediction for loops with bounds that aren't known at compile time; skips the first few reallocations without wasting much space
+static const int kDynamicLoopBound = 8;
+
+// limit for the depth of method calls that are followed from constructors
+static const int kMaxMethodDepth = 4;
+
 static AstExprTable* getTableHint(AstExpr* expr)
 {
     // unadorned table literal
@@ -24,45 +32,178 @@ static AstExprTable* getTableHint(AstExpr* expr)
     return nullptr;
 }
 
-struct ShapeVisitor : AstVisitor
+static AstLocal* getMetatableHint(AstExpr* expr)
 {
-    struct Hasher
+    // setmetatable(table literal, local)
+    if (AstExprCall* call = expr->as<AstExprCall>(); call && !call->self && call->args.size == 2)
+        if (AstExprGlobal* func = call->func->as<AstExprGlobal>(); func && func->name == "setmetatable")
+            if (AstExprLocal* mt = call->args.data[1]->as<AstExprLocal>())
+                return mt->local;
+
+    return nullptr;
+}
+
+struct PairHasher
+{
+    template<typename T>
+    size_t operator()(const std::pair<T*, AstName>& p) const
     {
-        size_t operator()(const std::pair<AstExprTable*, AstName>& p) const
-        {
-            return DenseHashPointer()(p.first) ^ std::hash<AstName>()(p.second);
-        }
-    };
+        return DenseHashPointer()(p.first) ^ std::hash<AstName>()(p.second);
+    }
+};
 
+using Methods = DenseHashMap<std::pair<AstLocal*, AstName>, AstExprFunction*, PairHasher>;
+
+// collects methods defined on local tables, e.g. function C:init() or function C.init(self)
+struct MethodVisitor : AstVisitor
+{
+    Methods& methods;
+
+    MethodVisitor(Methods& methods)
+        : methods(methods)
+    {
+    }
+
+    bool visit(AstStatFunction* node) override
+    {
+        if (AstExprIndexName* index = node->name->as<AstExprIndexName>())
+            if (AstExprLocal* object = index->expr->as<AstExprLocal>())
+                methods[{object->local, index->index}] = node->func;
+
+        return true;
+    }
+};
+
+// collects fields that a method assigns to its first argument, following method calls on the same object
+struct MethodFieldVisitor : AstVisitor
+{
+    const Methods& methods;
+    AstLocal* self;
+    AstLocal* metatable;
+
+    std::vector<AstName>& result;
+    std::vector<AstExprFunction*>& followed;
+    std::vector<AstExprFunction*>& stack;
+
+    MethodFieldVisitor(const Methods& methods, AstLocal* self, AstLocal* metatable, std::vector<AstName>& result,
+        std::vector<AstExprFunction*>& followed, std::vector<AstExprFunction*>& stack)
+        : methods(methods)
+        , self(self)
+        , metatable(metatable)
+        , result(result)
+        , followed(followed)
+        , stack(stack)
+    {
+    }
+
+    bool visit(AstStatAssign* node) override
+    {
+        for (size_t i = 0; i < node->vars.size; ++i)
+            if (AstExprIndexName* index = node->vars.data[i]->as<AstExprIndexName>())
+                if (AstExprLocal* object = index->expr->as<AstExprLocal>(); object && object->local == self)
+                    result.push_back(index->index);
+
+        return true;
+    }
+
+    bool visit(AstExprCall* node) override
+    {
+        if (AstExprFunction* func = findMethodCall(methods, node, self, metatable))
+            collectMethodFields(methods, func, metatable, result, followed, stack);
+
+        return true;
+    }
+
+    bool visit(AstExprFunction*) override
+    {
+        // nested functions may run at any point later, so their assignments don't contribute to the shape
+        return false;
+    }
+
+    static AstExprFunction* findMethodCall(const Methods& methods, AstExprCall* call, AstLocal* object, AstLocal* metatable)
+    {
+        AstExprIndexName* index = call->func->as<AstExprIndexName>();
+        if (!index)
+            return nullptr;
+
+        AstExprLocal* target = index->expr->as<AstExprLocal>();
+        if (!target)
+            return nullptr;
+
+        // object:method(...) where object has a known metatable
+        if (call->self && target->local == object && metatable)
+            if (AstExprFunction* const* func = methods.find({metatable, index->index}))
+                return *func;
+
+        // Class.method(object, ...)
+        if (!call->self && call->args.size > 0)
+            if (AstExprLocal* arg = call->args.data[0]->as<AstExprLocal>(); arg && arg->local == object)
+                if (AstExprFunction* const* func = methods.find({target->local, index->index}))
+                    return *func;
+
+        return nullptr;
+    }
+
+    static void collectMethodFields(const Methods& methods, AstExprFunction* func, AstLocal* metatable, std::vector<AstName>& result,
+        std::vector<AstExprFunction*>& followed, std::vector<AstExprFunction*>& stack)
+    {
+        if (stack.size() >= size_t(kMaxMethodDepth) || std::find(stack.begin(), stack.end(), func) != stack.end())
+            return;
+
+        AstLocal* self = func->self ? func->self : func->args.size > 0 ? func->args.data[0] : nullptr;
+        if (!self)
+            return;
+
+        if (std::find(followed.begin(), followed.end(), func) == followed.end())
+            followed.push_back(func);
+
+        stack.push_back(func);
+
+        MethodFieldVisitor visitor(methods, self, metatable, result, followed, stack);
+        func->body->visit(&visitor);
+
+        stack.pop_back();
+    }
+};
+
+struct ShapeVisitor : AstVisitor
+{
     DenseHashMap<AstExprTable*, TableShape>& shapes;
+    const Methods& methods;
 
     DenseHashMap<AstLocal*, AstExprTable*> tables;
-    DenseHashSet<std::pair<AstExprTable*, AstName>, Hasher> fields;
+    DenseHashMap<AstExprTable*, AstLocal*> metatables;
+    DenseHashSet<std::pair<AstExprTable*, AstName>, PairHasher> fields;
 
     DenseHashMap<AstLocal*, unsigned int> loops; // iterator => upper bound for 1..k
 
-    ShapeVisitor(DenseHashMap<AstExprTable*, TableShape>& shapes)
+    ShapeVisitor(DenseHashMap<AstExprTable*, TableShape>& shapes, const Methods& methods)
         : shapes(shapes)
+        , methods(methods)
         , tables(nullptr)
+        , metatables(nullptr)
         , fields(std::pair<AstExprTable*, AstName>())
         , loops(nullptr)
     {
     }
 
+    void addField(AstExprTable* table, AstName index)
+    {
+        std::pair<AstExprTable*, AstName> field = {table, index};
+
+        if (!fields.contains(field))
+        {
+            fields.insert(field);
+            shapes[table].hashSize += 1;
+        }
+    }
+
     void assignField(AstExpr* expr, AstName index)
     {
         if (AstExprLocal* lv = expr->as<AstExprLocal>())
         {
             if (AstExprTable** table = tables.find(lv->local))
-            {
-                std::pair<AstExprTable*, AstName> field = {*table, index};
-
-                if (!fields.contains(field))
-                {
-                    fields.insert(field);
-                    shapes[*table].hashSize += 1;
-                }
-            }
+                addField(*table, index);
         }
     }
 
@@ -112,8 +253,52 @@ struct ShapeVisitor : AstVisitor
         // track local -> table association so that we can update table size prediction in assignField
         if (node->vars.size == 1 && node->values.size == 1)
             if (AstExprTable* table = getTableHint(node->values.data[0]); table && table->items.size == 0)
+            {
                 tables[node->vars.data[0]] = table;
 
+                if (AstLocal* metatable = getMetatableHint(node->values.data[0]))
+                    metatables[table] = metatable;
+            }
+
+        return true;
+    }
+
+    bool visit(AstExprCall* node) override
+    {
+        // constructors often call methods that initialize more fields, e.g. self:init() or Class.init(self)
+        AstExprLocal* object = nullptr;
+
+        if (AstExprIndexName* index = node->func->as<AstExprIndexName>(); index && node->self)
+            object = index->expr->as<AstExprLocal>();
+        else if (node->args.size > 0)
+            object = node->args.data[0]->as<AstExprLocal>();
+
+        AstExprTable** table = object ? tables.find(object->local) : nullptr;
+
+        if (table)
+        {
+            AstLocal** metatable = metatables.find(*table);
+
+            if (AstExprFunction* func = MethodFieldVisitor::findMethodCall(methods, node, object->local, metatable ? *metatable : nullptr))
+            {
+                std::vector<AstName> result;
+                std::vector<AstExprFunction*> followed;
+                std::vector<AstExprFunction*> stack;
+
+                MethodFieldVisitor::collectMethodFields(methods, func, metatable ? *metatable : nullptr, result, followed, stack);
+
+                for (AstName name : result)
+                    addField(*table, name);
+
+                // the prediction depends on the method bodies, which incremental compilation needs to know about
+                std::vector<AstExprFunction*>& dependencies = shapes[*table].methods;
+
+                for (AstExprFunction* method : followed)
+                    if (std::find(dependencies.begin(), dependencies.end(), method) == dependencies.end())
+                        dependencies.push_back(method);
+            }
+        }
+
         return true;
     }
 
@@ -143,6 +328,8 @@ struct ShapeVisitor : AstVisitor
 
         if (from && to && from->value == 1.0 && to->value >= 1.0 && to->value <= double(kMaxLoopBound) && !node->step)
             loops[node->var] = unsigned(to->value);
+        else if (from && !to && from->value == 1.0 && !node->step)
+            loops[node->var] = kDynamicLoopBound;
 
         return true;
     }
@@ -150,7 +337,12 @@ struct ShapeVisitor : AstVisitor
 
 void predictTableShapes(DenseHashMap<AstExprTable*, TableShape>& shapes, AstNode* root)
 {
-    ShapeVisitor visitor{shapes};
+    Methods methods({nullptr, AstName()});
+
+    MethodVisitor methodVisitor{methods};
+    root->visit(&methodVisitor);
+
+    ShapeVisitor visitor{shapes, methods};
     root->visit(&visitor);
 }
 
@@ -4,6 +4,8 @@
 #include "Luau/Ast.h"
 #include "Luau/DenseHash.h"
 
+#include <vector>
+
 namespace Luau
 {
 namespace Compile
@@ -13,6 +15,9 @@ struct TableShape
 {
     unsigned int arraySize = 0;
     unsigned int hashSize = 0;
+
+    // methods called from the constructor whose bodies contributed fields to the prediction
+    std::vector<AstExprFunction*> methods;
 };
 
 void predictTableShapes(DenseHashMap<AstExprTable*, TableShape>& shapes, AstNode* root);
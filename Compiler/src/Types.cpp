@@ -0,0 +1,168 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#include "Types.h"
+
+#include "Luau/Bytecode.h"
+
+namespace Luau
+{
+namespace Compile
+{
+
+// since type aliases may refer to other type aliases, we limit the resolution depth to guard against cycles
+static const int kMaxAliasDepth = 8;
+
+struct TypeMapVisitor : AstVisitor
+{
+    DenseHashMap<AstName, AstStatTypeAlias*>& typeAliases;
+
+    TypeMapVisitor(DenseHashMap<AstName, AstStatTypeAlias*>& typeAliases)
+        : typeAliases(typeAliases)
+    {
+    }
+
+    bool visit(AstStatTypeAlias* node) override
+    {
+        // aliases with the same name may be declared in different scopes; we don't track scoping so we forget the type in that case
+        // the null entry stays in the map so that any further aliases with this name are ignored as well
+        if (AstStatTypeAlias** alias = typeAliases.find(node->name))
+            *alias = nullptr;
+        else
+            typeAliases[node->name] = node;
+
+        return false;
+    }
+
+    bool visit(AstType* node) override
+    {
+        return false;
+    }
+};
+
+static bool isGeneric(AstName name, const AstArray<AstGenericType>& generics)
+{
+    for (const AstGenericType& gt : generics)
+        if (gt.name == name)
+            return true;
+
+    return false;
+}
+
+static uint8_t getPrimitiveType(AstName name)
+{
+    if (name == "nil")
+        return LBC_TYPE_NIL;
+    else if (name == "boolean")
+        return LBC_TYPE_BOOLEAN;
+    else if (name == "number")
+        return LBC_TYPE_NUMBER;
+    else if (name == "string")
+        return LBC_TYPE_STRING;
+    else if (name == "thread")
+        return LBC_TYPE_THREAD;
+    else if (name == "vector")
+        return LBC_TYPE_VECTOR;
+    else
+        return LBC_TYPE_ANY;
+}
+
+static uint8_t getType(const AstType* ty, const AstArray<AstGenericType>& generics, const DenseHashMap<AstName, AstStatTypeAlias*>& typeAliases,
+    int depth)
+{
+    if (const AstTypeReference* ref = ty->as<AstTypeReference>())
+    {
+        if (ref->prefix || ref->hasParameterList || isGeneric(ref->name, generics))
+            return LBC_TYPE_ANY;
+
+        if (AstStatTypeAlias* const* alias = typeAliases.find(ref->name); alias && *alias)
+        {
+            if ((*alias)->generics.size || (*alias)->genericPacks.size || depth >= kMaxAliasDepth)
+                return LBC_TYPE_ANY;
+
+            return getType((*alias)->type, generics, typeAliases, depth + 1);
+        }
+
+        return getPrimitiveType(ref->name);
+    }
+    else if (ty->is<AstTypeTable>())
+    {
+        return LBC_TYPE_TABLE;
+    }
+    else if (ty->is<AstTypeFunction>())
+    {
+        return LBC_TYPE_FUNCTION;
+    }
+    else if (ty->is<AstTypeSingletonBool>())
+    {
+        return LBC_TYPE_BOOLEAN;
+    }
+    else if (ty->is<AstTypeSingletonString>())
+    {
+        return LBC_TYPE_STRING;
+    }
+    else if (const AstTypeUnion* un = ty->as<AstTypeUnion>())
+    {
+        // only T? (aka T | nil) is representable; any other union degrades to 'any'
+        bool optional = false;
+        uint8_t type = LBC_TYPE_NIL;
+
+        for (AstType* part : un->types)
+        {
+            uint8_t et = getType(part, generics, typeAliases, depth + 1);
+
+            if (et == LBC_TYPE_NIL)
+                optional = true;
+            else if (type == LBC_TYPE_NIL || type == et)
+                type = et;
+            else
+                return LBC_TYPE_ANY;
+        }
+
+        if (type == LBC_TYPE_ANY || (type & LBC_TYPE_OPTIONAL_BIT))
+            return LBC_TYPE_ANY;
+
+        return optional && type != LBC_TYPE_NIL ? uint8_t(type | LBC_TYPE_OPTIONAL_BIT) : type;
+    }
+
+    return LBC_TYPE_ANY;
+}
+
+void buildTypeMap(DenseHashMap<AstName, AstStatTypeAlias*>& typeAliases, AstNode* root)
+{
+    TypeMapVisitor visitor(typeAliases);
+    root->visit(&visitor);
+}
+
+std::string getFunctionType(const AstExprFunction* func, const DenseHashMap<AstName, AstStatTypeAlias*>& typeAliases)
+{
+    bool self = func->self != 0;
+
+    std::string typeInfo;
+    typeInfo.reserve(func->args.size + self + 2);
+
+    typeInfo.push_back(LBC_TYPE_FUNCTION);
+    typeInfo.push_back(uint8_t(self + func->args.size));
+
+    if (self)
+        typeInfo.push_back(LBC_TYPE_ANY);
+
+    bool haveNonAnyParam = false;
+
+    for (AstLocal* arg : func->args)
+    {
+        uint8_t ty = arg->annotation ? getType(arg->annotation, func->generics, typeAliases, 0) : LBC_TYPE_ANY;
+
+        if (ty != LBC_TYPE_ANY)
+            haveNonAnyParam = true;
+
+        typeInfo.push_back(ty);
+    }
+
+    // if all parameters are 'any', the type information is useless
+    if (!haveNonAnyParam)
+        return std::string();
+
+    return typeInfo;
+}
+
+} // namespace Compile
+} // namespace Luau
@@ -0,0 +1,20 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#pragma once
+
+#include "Luau/Ast.h"
+#include "Luau/DenseHash.h"
+
+#include <string>
+
+namespace Luau
+{
+namespace Compile
+{
+
+void buildTypeMap(DenseHashMap<AstName, AstStatTypeAlias*>& typeAliases, AstNode* root);
+
+// returns encoded function type information (see LuauBytecodeType) or an empty string if none of the arguments have a useful type
+std::string getFunctionType(const AstExprFunction* func, const DenseHashMap<AstName, AstStatTypeAlias*>& typeAliases);
+
+} // namespace Compile
+} // namespace Luau
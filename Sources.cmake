@@ -12,6 +12,7 @@ endif()
 # Luau.Ast Sources
 target_sources(Luau.Ast PRIVATE
     Ast/include/Luau/Ast.h
+    Ast/include/Luau/AstSerializer.h
     Ast/include/Luau/Confusables.h
     Ast/include/Luau/Lexer.h
     Ast/include/Luau/Location.h
@@ -22,6 +23,7 @@ target_sources(Luau.Ast PRIVATE
     Ast/include/Luau/TimeTrace.h
 
     Ast/src/Ast.cpp
+    Ast/src/AstSerializer.cpp
     Ast/src/Confusables.cpp
     Ast/src/Lexer.cpp
     Ast/src/Location.cpp
@@ -33,6 +35,7 @@ target_sources(Luau.Ast PRIVATE
 # Luau.Compiler Sources
 target_sources(Luau.Compiler PRIVATE
     Compiler/include/Luau/BytecodeBuilder.h
+    Compiler/include/Luau/CompileCache.h
     Compiler/include/Luau/Compiler.h
     Compiler/include/luacode.h
 
@@ -40,16 +43,24 @@ target_sources(Luau.Compiler PRIVATE
     Compiler/src/Compiler.cpp
     Compiler/src/Builtins.cpp
     Compiler/src/BuiltinFolding.cpp
+    Compiler/src/Bundle.cpp
     Compiler/src/ConstantFolding.cpp
     Compiler/src/CostModel.cpp
+    Compiler/src/EscapeAnalysis.cpp
+    Compiler/src/FunctionTree.cpp
     Compiler/src/TableShape.cpp
+    Compiler/src/Types.cpp
     Compiler/src/ValueTracking.cpp
     Compiler/src/lcode.cpp
     Compiler/src/Builtins.h
     Compiler/src/BuiltinFolding.h
+    Compiler/src/Bundle.h
     Compiler/src/ConstantFolding.h
     Compiler/src/CostModel.h
+    Compiler/src/EscapeAnalysis.h
+    Compiler/src/FunctionTree.h
     Compiler/src/TableShape.h
+    Compiler/src/Types.h
     Compiler/src/ValueTracking.h
 )
 
@@ -325,6 +336,7 @@ if(TARGET Luau.UnitTest)
         tests/AssemblyBuilderX64.test.cpp
         tests/AstJsonEncoder.test.cpp
         tests/AstQuery.test.cpp
+        tests/AstSerializer.test.cpp
         tests/AstVisitor.test.cpp
         tests/Autocomplete.test.cpp
         tests/BuiltinDefinitions.test.cpp
@@ -1269,7 +1269,7 @@ void* lua_newuserdatadtor(lua_State* L, size_t sz, void (*dtor)(void*))
     return u->data;
 }
 
-static const char* aux_upvalue(StkId fi, int n, TValue** val)
+static const char* aux_upvalue(lua_State* L, StkId fi, int n, TValue** val)
 {
     Closure* f;
     if (!ttisfunction(fi))
@@ -1289,6 +1289,7 @@ static const char* aux_upvalue(StkId fi, int n, TValue** val)
             return NULL;
         TValue* r = &f->l.uprefs[n - 1];
         *val = ttisupval(r) ? upvalue(r)->v : r;
+        luau_loaddebuginfo(L, p);
         if (!(1 <= n && n <= p->sizeupvalues)) // don't have a name for this upvalue
             return "";
         return getstr(p->upvalues[n - 1]);
@@ -1299,7 +1300,7 @@ const char* lua_getupvalue(lua_State* L, int funcindex, int n)
 {
     luaC_threadbarrier(L);
     TValue* val;
-    const char* name = aux_upvalue(index2addr(L, funcindex), n, &val);
+    const char* name = aux_upvalue(L, index2addr(L, funcindex), n, &val);
     if (name)
     {
         setobj2s(L, L->top, val);
@@ -1313,7 +1314,7 @@ const char* lua_setupvalue(lua_State* L, int funcindex, int n)
     api_checknelems(L, 1);
     StkId fi = index2addr(L, funcindex);
     TValue* val;
-    const char* name = aux_upvalue(fi, n, &val);
+    const char* name = aux_upvalue(L, fi, n, &val);
     if (name)
     {
         L->top--;
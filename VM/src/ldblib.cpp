@@ -102,6 +102,32 @@ static int db_info(lua_State* L)
     return results;
 }
 
+static void addframe(luaL_Buffer* buf, lua_Debug* ar, int currentline)
+{
+    if (ar->source)
+        luaL_addstring(buf, ar->short_src);
+
+    if (currentline > 0)
+    {
+        char line[32]; // manual conversion for performance
+        char* lineend = line + sizeof(line);
+        char* lineptr = lineend;
+        for (unsigned int r = currentline; r > 0; r /= 10)
+            *--lineptr = '0' + (r % 10);
+
+        luaL_addchar(buf, ':');
+        luaL_addlstring(buf, lineptr, lineend - lineptr, -1);
+    }
+
+    if (ar->name)
+    {
+        luaL_addstring(buf, " function ");
+        luaL_addstring(buf, ar->name);
+    }
+
+    luaL_addchar(buf, '\n');
+}
+
 static int db_traceback(lua_State* L)
 {
     int arg;
@@ -125,28 +151,79 @@ static int db_traceback(lua_State* L)
         if (strcmp(ar.what, "C") == 0)
             continue;
 
-        if (ar.source)
-            luaL_addstring(&buf, ar.short_src);
+        addframe(&buf, &ar, ar.currentline);
+    }
 
-        if (ar.currentline > 0)
-        {
-            char line[32]; // manual conversion for performance
-            char* lineend = line + sizeof(line);
-            char* lineptr = lineend;
-            for (unsigned int r = ar.currentline; r > 0; r /= 10)
-                *--lineptr = '0' + (r % 10);
-
-            luaL_addchar(&buf, ':');
-            luaL_addlstring(&buf, lineptr, lineend - lineptr, -1);
-        }
+    luaL_pushresult(&buf);
+    return 1;
+}
+
+// Stack snapshots store (function, line) pairs for each Lua frame in a frozen table; the text that debug.traceback would
+// produce is only built on conversion to string, so error handlers that never read the traceback don't pay for formatting.
+static const char* const kSnapshotMeta = "debug.snapshot";
+
+static int db_capture(lua_State* L)
+{
+    int arg;
+    lua_State* L1 = getthread(L, &arg);
+    int level = luaL_optinteger(L, arg + 1, (L == L1) ? 1 : 0);
+    luaL_argcheck(L, level >= 0, arg + 1, "level can't be negative");
+
+    // If L1 != L, L1 can be in any state, and therefore there are no guarantees about its stack space
+    if (L != L1)
+        lua_rawcheckstack(L1, 1); // for 'f' option
 
-        if (ar.name)
+    int depth = lua_stackdepth(L1);
+    lua_createtable(L, depth > level ? (depth - level) * 2 : 0, 0);
+
+    int n = 0;
+    lua_Debug ar;
+    for (int i = level; lua_getinfo(L1, i, "fl", &ar); ++i)
+    {
+        if (L1 != L)
+            lua_xmove(L1, L, 1);
+
+        // C functions are skipped by traceback, so we don't need to keep them alive
+        if (lua_iscfunction(L, -1))
         {
-            luaL_addstring(&buf, " function ");
-            luaL_addstring(&buf, ar.name);
+            lua_pop(L, 1);
+            continue;
         }
 
-        luaL_addchar(&buf, '\n');
+        lua_rawseti(L, -2, ++n);
+        lua_pushinteger(L, ar.currentline);
+        lua_rawseti(L, -2, ++n);
+    }
+
+    luaL_getmetatable(L, kSnapshotMeta);
+    lua_setmetatable(L, -2);
+    lua_setreadonly(L, -1, true);
+    return 1;
+}
+
+static int snapshot_tostring(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+
+    luaL_Buffer buf;
+    luaL_buffinit(L, &buf);
+
+    int n = lua_objlen(L, 1);
+
+    for (int i = 1; i + 1 <= n; i += 2)
+    {
+        lua_rawgeti(L, 1, i);
+        lua_rawgeti(L, 1, i + 1);
+        int currentline = lua_tointeger(L, -1);
+        lua_pop(L, 1);
+
+        luaL_checktype(L, -1, LUA_TFUNCTION);
+
+        lua_Debug ar;
+        lua_getinfo(L, -1, "sn", &ar);
+        lua_pop(L, 1);
+
+        addframe(&buf, &ar, currentline);
     }
 
     luaL_pushresult(&buf);
@@ -156,11 +233,27 @@ static int db_traceback(lua_State* L)
 static const luaL_Reg dblib[] = {
     {"info", db_info},
     {"traceback", db_traceback},
+    {"capture", db_capture},
     {NULL, NULL},
 };
 
+static void createsnapshotmeta(lua_State* L)
+{
+    luaL_newmetatable(L, kSnapshotMeta);
+
+    lua_pushcfunction(L, snapshot_tostring, "__tostring");
+    lua_setfield(L, -2, "__tostring");
+
+    lua_pushstring(L, "the metatable is locked");
+    lua_setfield(L, -2, "__metatable");
+
+    lua_setreadonly(L, -1, true);
+    lua_pop(L, 1);
+}
+
 int luaopen_debug(lua_State* L)
 {
     luaL_register(L, LUA_DBLIBNAME, dblib);
+    createsnapshotmeta(L);
     return 1;
 }
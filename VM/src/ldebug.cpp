@@ -7,6 +7,7 @@
 #include "lmem.h"
 #include "lgc.h"
 #include "ldo.h"
+#include "lvm.h"
 #include "lbytecode.h"
 
 #include <string.h>
@@ -23,6 +24,8 @@ static int currentpc(lua_State* L, CallInfo* ci)
 
 static int currentline(lua_State* L, CallInfo* ci)
 {
+    luau_loaddebuginfo(L, ci_func(ci)->l.p);
+
     return luaG_getline(ci_func(ci)->l.p, currentpc(L, ci));
 }
 
@@ -66,6 +69,8 @@ const char* lua_getlocal(lua_State* L, int level, int n)
 
     CallInfo* ci = L->ci - level;
     Proto* fp = getluaproto(ci);
+    if (fp)
+        luau_loaddebuginfo(L, fp);
     const LocVar* var = fp ? luaF_getlocal(fp, n, currentpc(L, ci)) : NULL;
     if (var)
     {
@@ -83,6 +88,8 @@ const char* lua_setlocal(lua_State* L, int level, int n)
 
     CallInfo* ci = L->ci - level;
     Proto* fp = getluaproto(ci);
+    if (fp)
+        luau_loaddebuginfo(L, fp);
     const LocVar* var = fp ? luaF_getlocal(fp, n, currentpc(L, ci)) : NULL;
     if (var)
         setobj2s(L, ci->base + var->reg, L->top - 1);
@@ -332,6 +339,8 @@ void luaG_pusherror(lua_State* L, const char* error)
 
 void luaG_breakpoint(lua_State* L, Proto* p, int line, bool enable)
 {
+    luau_loaddebuginfo(L, p);
+
     if (p->lineinfo)
     {
         for (int i = 0; i < p->sizecode; ++i)
@@ -402,8 +411,10 @@ void lua_singlestep(lua_State* L, int enabled)
     L->singlestep = bool(enabled);
 }
 
-static int getmaxline(Proto* p)
+static int getmaxline(lua_State* L, Proto* p)
 {
+    luau_loaddebuginfo(L, p);
+
     int result = -1;
 
     for (int i = 0; i < p->sizecode; ++i)
@@ -414,7 +425,7 @@ static int getmaxline(Proto* p)
 
     for (int i = 0; i < p->sizep; ++i)
     {
-        int psize = getmaxline(p->p[i]);
+        int psize = getmaxline(L, p->p[i]);
         result = result < psize ? psize : result;
     }
 
@@ -423,8 +434,10 @@ static int getmaxline(Proto* p)
 
 // Find the line number with instructions. If the provided line doesn't have any instruction, it should return the next line number with
 // instructions.
-static int getnextline(Proto* p, int line)
+static int getnextline(lua_State* L, Proto* p, int line)
 {
+    luau_loaddebuginfo(L, p);
+
     int closest = -1;
     if (p->lineinfo)
     {
@@ -446,7 +459,7 @@ static int getnextline(Proto* p, int line)
     for (int i = 0; i < p->sizep; ++i)
     {
         // Find the closest line number to the intended one.
-        int candidate = getnextline(p->p[i], line);
+        int candidate = getnextline(L, p->p[i], line);
         if (closest == -1 || (candidate >= line && candidate < closest))
         {
             closest = candidate;
@@ -463,7 +476,7 @@ int lua_breakpoint(lua_State* L, int funcindex, int line, int enabled)
 
     Proto* p = clvalue(func)->l.p;
     // Find line number to add the breakpoint to.
-    int target = getnextline(p, line);
+    int target = getnextline(L, p, line);
 
     if (target != -1)
     {
@@ -474,8 +487,10 @@ int lua_breakpoint(lua_State* L, int funcindex, int line, int enabled)
     return target;
 }
 
-static void getcoverage(Proto* p, int depth, int* buffer, size_t size, void* context, lua_Coverage callback)
+static void getcoverage(lua_State* L, Proto* p, int depth, int* buffer, size_t size, void* context, lua_Coverage callback)
 {
+    luau_loaddebuginfo(L, p);
+
     memset(buffer, -1, size * sizeof(int));
 
     for (int i = 0; i < p->sizecode; ++i)
@@ -497,7 +512,7 @@ static void getcoverage(Proto* p, int depth, int* buffer, size_t size, void* con
     callback(context, debugname, linedefined, depth, buffer, size);
 
     for (int i = 0; i < p->sizep; ++i)
-        getcoverage(p->p[i], depth + 1, buffer, size, context, callback);
+        getcoverage(L, p->p[i], depth + 1, buffer, size, context, callback);
 }
 
 void lua_getcoverage(lua_State* L, int funcindex, void* context, lua_Coverage callback)
@@ -507,13 +522,13 @@ void lua_getcoverage(lua_State* L, int funcindex, void* context, lua_Coverage ca
 
     Proto* p = clvalue(func)->l.p;
 
-    size_t size = getmaxline(p) + 1;
+    size_t size = getmaxline(L, p) + 1;
     if (size == 0)
         return;
 
     int* buffer = luaM_newarray(L, size, int, 0);
 
-    getcoverage(p, 0, buffer, size, context, callback);
+    getcoverage(L, p, 0, buffer, size, context, callback);
 
     luaM_freearray(L, buffer, size, int, 0);
 }
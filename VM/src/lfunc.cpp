@@ -31,6 +31,11 @@ Proto* luaF_newproto(lua_State* L)
     f->source = NULL;
     f->debugname = NULL;
     f->debuginsn = NULL;
+    f->typeinfo = NULL;
+    f->sizetypeinfo = 0;
+    f->lazydebug = NULL;
+    f->lazydebugoffset = 0;
+    f->kowner = NULL;
 
 #if LUA_CUSTOM_EXECUTION
     f->execdata = NULL;
@@ -147,16 +152,22 @@ void luaF_freeproto(lua_State* L, Proto* f, lua_Page* page)
 {
     luaM_freearray(L, f->code, f->sizecode, Instruction, f->memcat);
     luaM_freearray(L, f->p, f->sizep, Proto*, f->memcat);
-    luaM_freearray(L, f->k, f->sizek, TValue, f->memcat);
+    if (!f->kowner)
+        luaM_freearray(L, f->k, f->sizek, TValue, f->memcat);
     if (f->lineinfo)
         luaM_freearray(L, f->lineinfo, f->sizelineinfo, uint8_t, f->memcat);
     luaM_freearray(L, f->locvars, f->sizelocvars, struct LocVar, f->memcat);
     luaM_freearray(L, f->upvalues, f->sizeupvalues, TString*, f->memcat);
     if (f->debuginsn)
         luaM_freearray(L, f->debuginsn, f->sizecode, uint8_t, f->memcat);
+    if (f->typeinfo)
+        luaM_freearray(L, f->typeinfo, f->sizetypeinfo, uint8_t, f->memcat);
+    if (f->lazydebug)
+        luaF_releasedebuginfo(L, f->lazydebug);
 
 #if LUA_CUSTOM_EXECUTION
-    if (f->execdata)
+    // execution callbacks may hold on to data of functions that no longer have execdata, e.g. after deoptimization
+    if (f->execdata || L->global->ecb.destroy)
     {
         LUAU_ASSERT(L->global->ecb.destroy);
         L->global->ecb.destroy(L, f);
@@ -166,6 +177,18 @@ void luaF_freeproto(lua_State* L, Proto* f, lua_Page* page)
     luaM_freegco(L, f, sizeof(Proto), f->memcat, page);
 }
 
+void luaF_releasedebuginfo(lua_State* L, LazyDebugInfo* info)
+{
+    LUAU_ASSERT(info->refs > 0);
+
+    if (--info->refs > 0)
+        return;
+
+    luaM_freearray(L, info->data, info->size, char, info->memcat);
+    luaM_freearray(L, info->strings, info->sizestrings, uint32_t, info->memcat);
+    luaM_free_(L, info, sizeof(LazyDebugInfo), info->memcat);
+}
+
 void luaF_freeclosure(lua_State* L, Closure* c, lua_Page* page)
 {
     int size = c->isC ? sizeCclosure(c->nupvalues) : sizeLclosure(c->nupvalues);
@@ -16,5 +16,6 @@ LUAI_FUNC void luaF_closeupval(lua_State* L, UpVal* uv, bool dead);
 LUAI_FUNC void luaF_freeproto(lua_State* L, Proto* f, struct lua_Page* page);
 LUAI_FUNC void luaF_freeclosure(lua_State* L, Closure* c, struct lua_Page* page);
 LUAI_FUNC void luaF_freeupval(lua_State* L, UpVal* uv, struct lua_Page* page);
+LUAI_FUNC void luaF_releasedebuginfo(lua_State* L, LazyDebugInfo* info);
 LUAI_FUNC const LocVar* luaF_getlocal(const Proto* func, int local_number, int pc);
 LUAI_FUNC const LocVar* luaF_findlocal(const Proto* func, int local_reg, int pc);
@@ -356,6 +356,8 @@ static void traverseproto(global_State* g, Proto* f)
         stringmark(f->debugname);
     for (i = 0; i < f->sizek; i++) // mark literals
         markvalue(g, &f->k[i]);
+    if (f->kowner)
+        markobject(g, f->kowner);
     for (i = 0; i < f->sizeupvalues; i++)
     { // mark upvalue names
         if (f->upvalues[i])
@@ -498,7 +500,7 @@ static size_t propagatemark(global_State* g)
         Proto* p = gco2p(o);
         g->gray = p->gclist;
         traverseproto(g, p);
-        return sizeof(Proto) + sizeof(Instruction) * p->sizecode + sizeof(Proto*) * p->sizep + sizeof(TValue) * p->sizek + p->sizelineinfo +
+        return sizeof(Proto) + sizeof(Instruction) * p->sizecode + sizeof(Proto*) * p->sizep + sizeof(TValue) * p->sizek + p->sizelineinfo + p->sizetypeinfo +
                sizeof(LocVar) * p->sizelocvars + sizeof(TString*) * p->sizeupvalues;
     }
     default:
@@ -122,6 +122,9 @@ static void validateproto(global_State* g, Proto* f)
     for (int i = 0; i < f->sizek; ++i)
         validateref(g, obj2gco(f), &f->k[i]);
 
+    if (f->kowner)
+        validateobjref(g, obj2gco(f), obj2gco(f->kowner));
+
     for (int i = 0; i < f->sizeupvalues; ++i)
         if (f->upvalues[i])
             validateobjref(g, obj2gco(f), obj2gco(f->upvalues[i]));
@@ -475,7 +478,7 @@ static void dumpthread(FILE* f, lua_State* th)
 
 static void dumpproto(FILE* f, Proto* p)
 {
-    size_t size = sizeof(Proto) + sizeof(Instruction) * p->sizecode + sizeof(Proto*) * p->sizep + sizeof(TValue) * p->sizek + p->sizelineinfo +
+    size_t size = sizeof(Proto) + sizeof(Instruction) * p->sizecode + sizeof(Proto*) * p->sizep + sizeof(TValue) * p->sizek + p->sizelineinfo + p->sizetypeinfo +
                   sizeof(LocVar) * p->sizelocvars + sizeof(TString*) * p->sizeupvalues;
 
     fprintf(f, "{\"type\":\"proto\",\"cat\":%d,\"size\":%d", p->memcat, int(size));
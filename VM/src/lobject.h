@@ -254,6 +254,21 @@ typedef struct Udata
     };
 } Udata;
 
+/*
+** Debug information that is decoded on first use; shared by all prototypes of a chunk
+*/
+typedef struct LazyDebugInfo
+{
+    int refs; // number of prototypes that haven't decoded their debug info yet
+    uint8_t memcat;
+
+    char* data; // encoded debug info section
+    size_t size;
+
+    uint32_t* strings; // offsets of string table entries in data
+    int sizestrings;
+} LazyDebugInfo;
+
 /*
 ** Function Prototypes
 */
@@ -275,6 +290,11 @@ typedef struct Proto
     TString* debugname;
     uint8_t* debuginsn; // a copy of code[] array with just opcodes
 
+    uint8_t* typeinfo;  // encoded function type information (see LuauBytecodeType), or NULL
+
+    LazyDebugInfo* lazydebug; // when set, lineinfo/locvars/upvalues haven't been decoded yet (see luau_loaddebuginfo)
+    struct Proto* kowner;     // when set, k is shared with (and owned by) another prototype that is kept alive by this one
+
 #if LUA_CUSTOM_EXECUTION
     void* execdata;
 #endif
@@ -288,9 +308,11 @@ typedef struct Proto
     int sizeupvalues;
     int sizek;
     int sizelineinfo;
+    int sizetypeinfo;
     int linegaplog2;
     int linedefined;
     int bytecodeid;
+    int lazydebugoffset;
 
 
     uint8_t nups; // number of upvalues
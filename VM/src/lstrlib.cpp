@@ -1323,14 +1323,14 @@ static KOption getoption(Header* h, const char** fmt, int* size)
 
 /*
 ** Read, classify, and fill other details about the next option.
-** 'psize' is filled with option's size, 'notoalign' with its
-** alignment requirements.
+** 'psize' is filled with option's size, 'palign' with its
+** alignment requirements (0 if none).
 ** Local variable 'size' gets the size to be aligned. (Kpadal option
 ** always gets its full alignment, other options are limited by
 ** the maximum alignment ('maxalign'). Kchar option needs no alignment
 ** despite its size.
 */
-static KOption getdetails(Header* h, size_t totalsize, const char** fmt, int* psize, int* ntoalign)
+static KOption getdetails(Header* h, const char** fmt, int* psize, int* palign)
 {
     KOption opt = getoption(h, fmt, psize);
     int align = *psize; // usually, alignment follows size
@@ -1340,18 +1340,26 @@ static KOption getdetails(Header* h, size_t totalsize, const char** fmt, int* ps
             luaL_argerror(h->L, 1, "invalid next option for option 'X'");
     }
     if (align <= 1 || opt == Kchar) // need no alignment?
-        *ntoalign = 0;
+        *palign = 0;
     else
     {
         if (align > h->maxalign) // enforce maximum alignment
             align = h->maxalign;
         if ((align & (align - 1)) != 0) // is 'align' not a power of 2?
             luaL_argerror(h->L, 1, "format asks for alignment not power of 2");
-        *ntoalign = (align - (int)(totalsize & (align - 1))) & (align - 1);
+        *palign = align;
     }
     return opt;
 }
 
+/*
+** Number of padding bytes needed to align 'totalsize' to 'align'.
+*/
+static int getntoalign(size_t totalsize, int align)
+{
+    return align == 0 ? 0 : (align - (int)(totalsize & (align - 1))) & (align - 1);
+}
+
 /*
 ** Pack integer 'n' with 'size' bytes and 'islittle' endianness.
 ** The final 'if' handles the case when 'size' is larger than
@@ -1396,25 +1404,217 @@ static void copywithendian(volatile char* dest, volatile const char* src, int si
     }
 }
 
-static int str_pack(lua_State* L)
+/*
+** Unpack an integer with 'size' bytes and 'islittle' endianness.
+** If size is smaller than the size of a Lua integer and integer
+** is signed, must do sign extension (propagating the sign to the
+** higher bits); if size is larger than the size of a Lua integer,
+** it must check the unread bytes to see whether they do not cause an
+** overflow.
+*/
+static long long unpackint(lua_State* L, const char* str, int islittle, int size, int issigned)
 {
-    luaL_Buffer b;
+    unsigned long long res = 0;
+    int i;
+    int limit = (size <= SZINT) ? size : SZINT;
+    for (i = limit - 1; i >= 0; i--)
+    {
+        res <<= NB;
+        res |= (unsigned char)str[islittle ? i : size - 1 - i];
+    }
+    if (size < SZINT)
+    { // real size smaller than int?
+        if (issigned)
+        { // needs sign extension?
+            unsigned long long mask = (unsigned long long)1 << (size * NB - 1);
+            res = ((res ^ mask) - mask); // do sign extension
+        }
+    }
+    else if (size > SZINT)
+    { // must check unread bytes
+        int mask = (!issigned || (long long)res >= 0) ? 0 : MC;
+        for (i = limit; i < size; i++)
+        {
+            if ((unsigned char)str[islittle ? i : size - 1 - i] != mask)
+                luaL_error(L, "%d-byte integer does not fit into Lua Integer", size);
+        }
+    }
+    return (long long)res;
+}
+
+/*
+** Compiled format for pack/unpack. Formats are parsed once into a flat
+** list of options and cached per format string, so that encoding many
+** small records doesn't pay for re-parsing the format on every call.
+*/
+typedef struct PackOption
+{
+    unsigned char opt;      // KOption
+    unsigned char islittle; // endianness of the option
+    unsigned char native;   // option has native endianness and a size that maps to a C type
+    int size;
+    int align; // 0 if the option needs no alignment
+} PackOption;
+
+typedef struct PackFormat
+{
+    int count;   // number of options
+    int nvalues; // number of values produced/consumed by options
+    PackOption options[1];
+} PackFormat;
+
+// maximum number of formats cached per function before the cache is reset
+#define MAXPACKCACHE 64
+
+static const PackFormat* compileformat(lua_State* L, const char* fmt, size_t len)
+{
+    // each option consumes at least one character so the length of the format string is an upper bound
+    PackFormat* pf = (PackFormat*)lua_newuserdata(L, offsetof(PackFormat, options) + (len + 1) * sizeof(PackOption));
+    pf->count = 0;
+    pf->nvalues = 0;
+
     Header h;
-    const char* fmt = luaL_checkstring(L, 1); // format string
-    int arg = 1;                              // current argument to pack
-    size_t totalsize = 0;                     // accumulate total size of result
     initheader(L, &h);
-    lua_pushnil(L); // mark to separate arguments from string buffer
-    luaL_buffinit(L, &b);
     while (*fmt != '\0')
     {
-        int size, ntoalign;
-        KOption opt = getdetails(&h, totalsize, &fmt, &size, &ntoalign);
+        int size, align;
+        KOption opt = getdetails(&h, &fmt, &size, &align);
+        if (opt == Knop)
+            continue;
+
+        PackOption& po = pf->options[pf->count++];
+        po.opt = (unsigned char)opt;
+        po.islittle = (unsigned char)h.islittle;
+        po.native = h.islittle == nativeendian.little && (size == 1 || size == 2 || size == 4 || size == 8);
+        po.size = size;
+        po.align = align;
+
+        if (opt != Kpadding && opt != Kpaddalign)
+            pf->nvalues++;
+    }
+
+    return pf;
+}
+
+/*
+** Returns compiled format for the format string at 'arg'. Expects the
+** cache table and the number of cached entries in the first two upvalues.
+** The result is kept alive by the cache table; the cache is only reset
+** here so the pointer stays valid for the duration of the call.
+*/
+static const PackFormat* getformat(lua_State* L, int arg)
+{
+    size_t len;
+    const char* fmt = luaL_checklstring(L, arg, &len);
+
+    lua_pushvalue(L, arg);
+    lua_rawget(L, lua_upvalueindex(1));
+    const PackFormat* pf = (const PackFormat*)lua_touserdata(L, -1);
+    lua_pop(L, 1);
+
+    if (pf)
+        return pf;
+
+    int cached = lua_tointeger(L, lua_upvalueindex(2));
+    if (cached >= MAXPACKCACHE)
+    {
+        lua_newtable(L);
+        lua_replace(L, lua_upvalueindex(1));
+        cached = 0;
+    }
+
+    lua_pushinteger(L, cached + 1);
+    lua_replace(L, lua_upvalueindex(2));
+
+    lua_pushvalue(L, arg);
+    pf = compileformat(L, fmt, len);
+    lua_rawset(L, lua_upvalueindex(1));
+
+    return pf;
+}
+
+/*
+** Pack integer 'n' truncated to 'size' bytes in native layout; 'size'
+** must be 1, 2, 4 or 8.
+*/
+static void packnative(luaL_Buffer* b, unsigned long long n, int size)
+{
+    char buff[8];
+    switch (size)
+    {
+    case 1:
+        buff[0] = (char)(n & MC);
+        break;
+    case 2:
+    {
+        uint16_t v = (uint16_t)n;
+        memcpy(buff, &v, sizeof(v));
+        break;
+    }
+    case 4:
+    {
+        uint32_t v = (uint32_t)n;
+        memcpy(buff, &v, sizeof(v));
+        break;
+    }
+    default:
+        LUAU_ASSERT(size == 8);
+        memcpy(buff, &n, sizeof(n));
+        break;
+    }
+    luaL_addlstring(b, buff, size, -1);
+}
+
+/*
+** Unpack an integer with 'size' bytes in native layout; 'size' must be
+** 1, 2, 4 or 8.
+*/
+static long long unpacknative(const char* str, int size, int issigned)
+{
+    switch (size)
+    {
+    case 1:
+        return issigned ? (long long)(int8_t)str[0] : (long long)(uint8_t)str[0];
+    case 2:
+    {
+        uint16_t v;
+        memcpy(&v, str, sizeof(v));
+        return issigned ? (long long)(int16_t)v : (long long)v;
+    }
+    case 4:
+    {
+        uint32_t v;
+        memcpy(&v, str, sizeof(v));
+        return issigned ? (long long)(int32_t)v : (long long)v;
+    }
+    default:
+    {
+        LUAU_ASSERT(size == 8);
+        long long v;
+        memcpy(&v, str, sizeof(v));
+        return v;
+    }
+    }
+}
+
+static int str_pack(lua_State* L)
+{
+    luaL_Buffer b;
+    const PackFormat* pf = getformat(L, 1);
+    int arg = 1;          // current argument to pack
+    size_t totalsize = 0; // accumulate total size of result
+    lua_pushnil(L);       // mark to separate arguments from string buffer
+    luaL_buffinit(L, &b);
+    for (int i = 0; i < pf->count; i++)
+    {
+        const PackOption& po = pf->options[i];
+        int size = po.size;
+        int ntoalign = getntoalign(totalsize, po.align);
         totalsize += ntoalign + size;
         while (ntoalign-- > 0)
             luaL_addchar(&b, LUAL_PACKPADBYTE); // fill alignment
         arg++;
-        switch (opt)
+        switch (po.opt)
         {
         case Kint:
         { // signed integers
@@ -1424,7 +1624,10 @@ static int str_pack(lua_State* L)
                 long long lim = (long long)1 << ((size * NB) - 1);
                 luaL_argcheck(L, -lim <= n && n < lim, arg, "integer overflow");
             }
-            packint(&b, n, h.islittle, size, (n < 0));
+            if (po.native)
+                packnative(&b, (unsigned long long)n, size);
+            else
+                packint(&b, n, po.islittle, size, (n < 0));
             break;
         }
         case Kuint:
@@ -1432,14 +1635,30 @@ static int str_pack(lua_State* L)
             long long n = (long long)luaL_checknumber(L, arg);
             if (size < SZINT) // need overflow check?
                 luaL_argcheck(L, (unsigned long long)n < ((unsigned long long)1 << (size * NB)), arg, "unsigned overflow");
-            packint(&b, (unsigned long long)n, h.islittle, size, 0);
+            if (po.native)
+                packnative(&b, (unsigned long long)n, size);
+            else
+                packint(&b, (unsigned long long)n, po.islittle, size, 0);
             break;
         }
         case Kfloat:
         { // floating-point options
+            double n = luaL_checknumber(L, arg); // get argument
+            if (po.native)
+            {
+                char buff[sizeof(double)];
+                if (size == sizeof(float))
+                {
+                    float f = (float)n;
+                    memcpy(buff, &f, sizeof(f));
+                }
+                else
+                    memcpy(buff, &n, sizeof(n));
+                luaL_addlstring(&b, buff, size, -1);
+                break;
+            }
             volatile Ftypes u;
             char buff[MAXINTSIZE];
-            double n = luaL_checknumber(L, arg); // get argument
             if (size == sizeof(u.f))
                 u.f = (float)n; // copy it into 'u'
             else if (size == sizeof(u.d))
@@ -1447,7 +1666,7 @@ static int str_pack(lua_State* L)
             else
                 u.n = n;
             // move 'u' to final result, correcting endianness if needed
-            copywithendian(buff, u.buff, size, h.islittle);
+            copywithendian(buff, u.buff, size, po.islittle);
             luaL_addlstring(&b, buff, size, -1);
             break;
         }
@@ -1466,7 +1685,7 @@ static int str_pack(lua_State* L)
             size_t len;
             const char* s = luaL_checklstring(L, arg, &len);
             luaL_argcheck(L, size >= (int)sizeof(size_t) || len < ((size_t)1 << (size * NB)), arg, "string length does not fit in given size");
-            packint(&b, len, h.islittle, size, 0); // pack length
+            packint(&b, len, po.islittle, size, 0); // pack length
             luaL_addlstring(&b, s, len, -1);
             totalsize += len;
             break;
@@ -1484,7 +1703,6 @@ static int str_pack(lua_State* L)
         case Kpadding:
             luaL_addchar(&b, LUAL_PACKPADBYTE); // FALLTHROUGH
         case Kpaddalign:
-        case Knop:
             arg--; // undo increment
             break;
         }
@@ -1495,16 +1713,13 @@ static int str_pack(lua_State* L)
 
 static int str_packsize(lua_State* L)
 {
-    Header h;
-    const char* fmt = luaL_checkstring(L, 1); // format string
-    int totalsize = 0;                        // accumulate total size of result
-    initheader(L, &h);
-    while (*fmt != '\0')
+    const PackFormat* pf = getformat(L, 1);
+    int totalsize = 0; // accumulate total size of result
+    for (int i = 0; i < pf->count; i++)
     {
-        int size, ntoalign;
-        KOption opt = getdetails(&h, totalsize, &fmt, &size, &ntoalign);
-        luaL_argcheck(L, opt != Kstring && opt != Kzstr, 1, "variable-length format");
-        size += ntoalign; // total space used by option
+        const PackOption& po = pf->options[i];
+        luaL_argcheck(L, po.opt != Kstring && po.opt != Kzstr, 1, "variable-length format");
+        int size = po.size + getntoalign(totalsize, po.align); // total space used by option
         luaL_argcheck(L, totalsize <= MAXSSIZE - size, 1, "format result too large");
         totalsize += size;
     }
@@ -1513,47 +1728,92 @@ static int str_packsize(lua_State* L)
 }
 
 /*
-** Unpack an integer with 'size' bytes and 'islittle' endianness.
-** If size is smaller than the size of a Lua integer and integer
-** is signed, must do sign extension (propagating the sign to the
-** higher bits); if size is larger than the size of a Lua integer,
-** it must check the unread bytes to see whether they do not cause an
-** overflow.
+** Unpack a single option at 'pos', advancing it past the option data.
+** Returns the number of values pushed onto the stack (0 or 1).
 */
-static long long unpackint(lua_State* L, const char* str, int islittle, int size, int issigned)
+static int unpackoption(lua_State* L, const PackOption& po, const char* data, size_t ld, int* ppos)
 {
-    unsigned long long res = 0;
-    int i;
-    int limit = (size <= SZINT) ? size : SZINT;
-    for (i = limit - 1; i >= 0; i--)
+    int pos = *ppos;
+    int size = po.size;
+    int ntoalign = getntoalign(pos, po.align);
+    luaL_argcheck(L, (size_t)ntoalign + size <= ld - pos, 2, "data string too short");
+    pos += ntoalign; // skip alignment
+    int n = 1;
+    switch (po.opt)
     {
-        res <<= NB;
-        res |= (unsigned char)str[islittle ? i : size - 1 - i];
+    case Kint:
+    {
+        long long res = po.native ? unpacknative(data + pos, size, true) : unpackint(L, data + pos, po.islittle, size, true);
+        lua_pushnumber(L, (double)res);
+        break;
     }
-    if (size < SZINT)
-    { // real size smaller than int?
-        if (issigned)
-        { // needs sign extension?
-            unsigned long long mask = (unsigned long long)1 << (size * NB - 1);
-            res = ((res ^ mask) - mask); // do sign extension
-        }
+    case Kuint:
+    {
+        unsigned long long res = po.native ? unpacknative(data + pos, size, false) : unpackint(L, data + pos, po.islittle, size, false);
+        lua_pushnumber(L, (double)res);
+        break;
     }
-    else if (size > SZINT)
-    { // must check unread bytes
-        int mask = (!issigned || (long long)res >= 0) ? 0 : MC;
-        for (i = limit; i < size; i++)
+    case Kfloat:
+    {
+        double num;
+        if (po.native)
         {
-            if ((unsigned char)str[islittle ? i : size - 1 - i] != mask)
-                luaL_error(L, "%d-byte integer does not fit into Lua Integer", size);
+            if (size == sizeof(float))
+            {
+                float f;
+                memcpy(&f, data + pos, sizeof(f));
+                num = (double)f;
+            }
+            else
+                memcpy(&num, data + pos, sizeof(num));
+        }
+        else
+        {
+            volatile Ftypes u;
+            copywithendian(u.buff, data + pos, size, po.islittle);
+            if (size == sizeof(u.f))
+                num = (double)u.f;
+            else if (size == sizeof(u.d))
+                num = (double)u.d;
+            else
+                num = u.n;
         }
+        lua_pushnumber(L, num);
+        break;
     }
-    return (long long)res;
+    case Kchar:
+    {
+        lua_pushlstring(L, data + pos, size);
+        break;
+    }
+    case Kstring:
+    {
+        size_t len = (size_t)unpackint(L, data + pos, po.islittle, size, 0);
+        luaL_argcheck(L, len <= ld - pos - size, 2, "data string too short");
+        lua_pushlstring(L, data + pos + size, len);
+        pos += (int)len; // skip string
+        break;
+    }
+    case Kzstr:
+    {
+        size_t len = strlen(data + pos);
+        luaL_argcheck(L, pos + len < ld, 2, "unfinished string for format 'z'");
+        lua_pushlstring(L, data + pos, len);
+        pos += (int)len + 1; // skip string plus final '\0'
+        break;
+    }
+    case Kpaddalign:
+    case Kpadding:
+        n = 0;
+        break;
+    }
+    *ppos = pos + size;
+    return n;
 }
 
 static int str_unpack(lua_State* L)
 {
-    Header h;
-    const char* fmt = luaL_checkstring(L, 1);
+    const PackFormat* pf = getformat(L, 1);
     size_t ld;
     const char* data = luaL_checklstring(L, 2, &ld);
     int pos = posrelat(luaL_optinteger(L, 3, 1), ld) - 1;
@@ -1561,75 +1821,257 @@ static int str_unpack(lua_State* L)
         pos = 0;
     int n = 0; // number of results
     luaL_argcheck(L, size_t(pos) <= ld, 3, "initial position out of string");
-    initheader(L, &h);
-    while (*fmt != '\0')
+    // stack space for all items + next position
+    luaL_checkstack(L, pf->nvalues + 1, "too many results");
+    for (int i = 0; i < pf->count; i++)
+        n += unpackoption(L, pf->options[i], data, ld, &pos);
+    lua_pushinteger(L, pos + 1); // next position
+    return n + 1;
+}
+
+/*
+** unpackmany(fmt, s, count [, pos]) -> table of 'count' consecutive
+** records unpacked into a flat array, and the next position.
+*/
+static int str_unpackmany(lua_State* L)
+{
+    const PackFormat* pf = getformat(L, 1);
+    size_t ld;
+    const char* data = luaL_checklstring(L, 2, &ld);
+    int count = luaL_checkinteger(L, 3);
+    int pos = posrelat(luaL_optinteger(L, 4, 1), ld) - 1;
+    if (pos < 0)
+        pos = 0;
+    luaL_argcheck(L, count >= 0, 3, "count can't be negative");
+    luaL_argcheck(L, size_t(pos) <= ld, 4, "initial position out of string");
+    luaL_argcheck(L, pf->nvalues == 0 || count <= MAXSSIZE / pf->nvalues, 3, "count is too large");
+
+    // each record consumes at least the fixed sizes of its options, so the data string bounds the number of values we preallocate for
+    size_t recordsize = 0;
+    for (int i = 0; i < pf->count; i++)
+        recordsize += pf->options[i].size;
+
+    size_t maxrecords = (ld - pos) / (recordsize > 0 ? recordsize : 1);
+    int prealloc = size_t(count) < maxrecords ? count : int(maxrecords);
+
+    lua_createtable(L, prealloc * pf->nvalues, 0);
+    int index = 0;
+    for (int r = 0; r < count; r++)
     {
-        int size, ntoalign;
-        KOption opt = getdetails(&h, pos, &fmt, &size, &ntoalign);
-        luaL_argcheck(L, (size_t)ntoalign + size <= ld - pos, 2, "data string too short");
-        pos += ntoalign; // skip alignment
-        // stack space for item + next position
-        luaL_checkstack(L, 2, "too many results");
-        n++;
-        switch (opt)
-        {
-        case Kint:
-        {
-            long long res = unpackint(L, data + pos, h.islittle, size, true);
-            lua_pushnumber(L, (double)res);
-            break;
-        }
-        case Kuint:
-        {
-            unsigned long long res = unpackint(L, data + pos, h.islittle, size, false);
-            lua_pushnumber(L, (double)res);
-            break;
-        }
-        case Kfloat:
+        for (int i = 0; i < pf->count; i++)
         {
-            volatile Ftypes u;
-            double num;
-            copywithendian(u.buff, data + pos, size, h.islittle);
-            if (size == sizeof(u.f))
-                num = (double)u.f;
-            else if (size == sizeof(u.d))
-                num = (double)u.d;
-            else
-                num = u.n;
-            lua_pushnumber(L, num);
-            break;
+            if (unpackoption(L, pf->options[i], data, ld, &pos))
+                lua_rawseti(L, -2, ++index);
         }
-        case Kchar:
+    }
+    lua_pushinteger(L, pos + 1); // next position
+    return 2;
+}
+
+// }======================================================
+
+/*
+** {======================================================
+** BASE64 and HEX
+** =======================================================
+*/
+
+static const char kBase64Digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char kHexDigits[] = "0123456789abcdef";
+
+// decoding tables map characters to digit values; 0xff marks characters outside of the alphabet
+static const unsigned char kBase64Values[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0x3f,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+    0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char kHexValues[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static int str_base64encode(lua_State* L)
+{
+    size_t l;
+    const unsigned char* s = (const unsigned char*)luaL_checklstring(L, 1, &l);
+
+    if (l / 3 >= MAXSSIZE / 4) // may overflow?
+        luaL_error(L, "resulting string too large");
+
+    size_t size = (l + 2) / 3 * 4;
+
+    luaL_Buffer b;
+    char* ptr = luaL_buffinitsize(L, &b, size);
+
+    size_t i = 0;
+    for (; i + 3 <= l; i += 3)
+    {
+        unsigned v = (s[i] << 16) | (s[i + 1] << 8) | s[i + 2];
+        ptr[0] = kBase64Digits[(v >> 18) & 63];
+        ptr[1] = kBase64Digits[(v >> 12) & 63];
+        ptr[2] = kBase64Digits[(v >> 6) & 63];
+        ptr[3] = kBase64Digits[v & 63];
+        ptr += 4;
+    }
+
+    if (i + 1 == l)
+    {
+        unsigned v = s[i] << 16;
+        ptr[0] = kBase64Digits[(v >> 18) & 63];
+        ptr[1] = kBase64Digits[(v >> 12) & 63];
+        ptr[2] = '=';
+        ptr[3] = '=';
+    }
+    else if (i + 2 == l)
+    {
+        unsigned v = (s[i] << 16) | (s[i + 1] << 8);
+        ptr[0] = kBase64Digits[(v >> 18) & 63];
+        ptr[1] = kBase64Digits[(v >> 12) & 63];
+        ptr[2] = kBase64Digits[(v >> 6) & 63];
+        ptr[3] = '=';
+    }
+
+    luaL_pushresultsize(&b, size);
+    return 1;
+}
+
+static int str_base64decode(lua_State* L)
+{
+    size_t l;
+    const unsigned char* s = (const unsigned char*)luaL_checklstring(L, 1, &l);
+
+    // padding is required so the input must consist of whole 4-character groups
+    if (l % 4 != 0)
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    size_t pad = (l > 0 && s[l - 1] == '=') ? (s[l - 2] == '=' ? 2 : 1) : 0;
+    size_t size = l / 4 * 3 - pad;
+
+    luaL_Buffer b;
+    char* ptr = luaL_buffinitsize(L, &b, size);
+
+    // the last group is decoded separately to handle padding
+    size_t full = pad ? l - 4 : l;
+
+    for (size_t i = 0; i < full; i += 4)
+    {
+        unsigned a = kBase64Values[s[i]], c = kBase64Values[s[i + 1]], d = kBase64Values[s[i + 2]], e = kBase64Values[s[i + 3]];
+
+        if ((a | c | d | e) & 0x80)
         {
-            lua_pushlstring(L, data + pos, size);
-            break;
+            lua_pushnil(L);
+            return 1;
         }
-        case Kstring:
+
+        unsigned v = (a << 18) | (c << 12) | (d << 6) | e;
+        ptr[0] = char(v >> 16);
+        ptr[1] = char(v >> 8);
+        ptr[2] = char(v);
+        ptr += 3;
+    }
+
+    if (pad)
+    {
+        unsigned a = kBase64Values[s[l - 4]], c = kBase64Values[s[l - 3]], d = pad == 1 ? kBase64Values[s[l - 2]] : 0;
+
+        if ((a | c | d) & 0x80)
         {
-            size_t len = (size_t)unpackint(L, data + pos, h.islittle, size, 0);
-            luaL_argcheck(L, len <= ld - pos - size, 2, "data string too short");
-            lua_pushlstring(L, data + pos + size, len);
-            pos += (int)len; // skip string
-            break;
+            lua_pushnil(L);
+            return 1;
         }
-        case Kzstr:
+
+        unsigned v = (a << 18) | (c << 12) | (d << 6);
+        ptr[0] = char(v >> 16);
+        if (pad == 1)
+            ptr[1] = char(v >> 8);
+    }
+
+    luaL_pushresultsize(&b, size);
+    return 1;
+}
+
+static int str_hexencode(lua_State* L)
+{
+    size_t l;
+    const unsigned char* s = (const unsigned char*)luaL_checklstring(L, 1, &l);
+
+    if (l >= MAXSSIZE / 2) // may overflow?
+        luaL_error(L, "resulting string too large");
+
+    luaL_Buffer b;
+    char* ptr = luaL_buffinitsize(L, &b, l * 2);
+
+    for (size_t i = 0; i < l; ++i)
+    {
+        ptr[0] = kHexDigits[s[i] >> 4];
+        ptr[1] = kHexDigits[s[i] & 15];
+        ptr += 2;
+    }
+
+    luaL_pushresultsize(&b, l * 2);
+    return 1;
+}
+
+static int str_hexdecode(lua_State* L)
+{
+    size_t l;
+    const unsigned char* s = (const unsigned char*)luaL_checklstring(L, 1, &l);
+
+    if (l % 2 != 0)
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    luaL_Buffer b;
+    char* ptr = luaL_buffinitsize(L, &b, l / 2);
+
+    for (size_t i = 0; i < l; i += 2)
+    {
+        unsigned hi = kHexValues[s[i]], lo = kHexValues[s[i + 1]];
+
+        if ((hi | lo) & 0x80)
         {
-            size_t len = strlen(data + pos);
-            luaL_argcheck(L, pos + len < ld, 2, "unfinished string for format 'z'");
-            lua_pushlstring(L, data + pos, len);
-            pos += (int)len + 1; // skip string plus final '\0'
-            break;
-        }
-        case Kpaddalign:
-        case Kpadding:
-        case Knop:
-            n--; // undo increment
-            break;
+            lua_pushnil(L);
+            return 1;
         }
-        pos += size;
+
+        *ptr++ = char((hi << 4) | lo);
     }
-    lua_pushinteger(L, pos + 1); // next position
-    return n + 1;
+
+    luaL_pushresultsize(&b, l / 2);
+    return 1;
 }
 
 // }======================================================
@@ -1649,12 +2091,33 @@ static const luaL_Reg strlib[] = {
     {"sub", str_sub},
     {"upper", str_upper},
     {"split", str_split},
+    {"base64encode", str_base64encode},
+    {"base64decode", str_base64decode},
+    {"hexencode", str_hexencode},
+    {"hexdecode", str_hexdecode},
+    {NULL, NULL},
+};
+
+static const luaL_Reg strpacklib[] = {
     {"pack", str_pack},
     {"packsize", str_packsize},
     {"unpack", str_unpack},
+    {"unpackmany", str_unpackmany},
     {NULL, NULL},
 };
 
+static void createpackfunctions(lua_State* L)
+{
+    // each function gets its own compiled format cache and the number of entries in it as upvalues
+    for (const luaL_Reg* l = strpacklib; l->name; l++)
+    {
+        lua_newtable(L);
+        lua_pushinteger(L, 0);
+        lua_pushcclosure(L, l->func, l->name, 2);
+        lua_setfield(L, -2, l->name);
+    }
+}
+
 static void createmetatable(lua_State* L)
 {
     lua_createtable(L, 0, 1); // create metatable for strings
@@ -1673,6 +2136,7 @@ static void createmetatable(lua_State* L)
 int luaopen_string(lua_State* L)
 {
     luaL_register(L, LUA_STRLIBNAME, strlib);
+    createpackfunctions(L);
     createmetatable(L);
 
     return 1;
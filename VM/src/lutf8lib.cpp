@@ -4,10 +4,36 @@
 
 #include "lcommon.h"
 
+#include <string.h>
+
 #define MAXUNICODE 0x10FFFF
 
 #define iscont(p) ((*(p)&0xC0) == 0x80)
 
+// SWAR helpers that let us process 8 bytes at a time on long runs of text
+#define UTF8_WORD 8
+
+static uint64_t loadword(const char* s)
+{
+    uint64_t result;
+    memcpy(&result, s, sizeof(result));
+    return result;
+}
+
+// returns true if none of the bytes in the word have the high bit set
+static bool isasciiword(uint64_t w)
+{
+    return (w & 0x8080808080808080ull) == 0;
+}
+
+// returns the number of bytes in the word that are not continuation bytes (10xxxxxx)
+static int countstarts(uint64_t w)
+{
+    uint64_t cont = w & ~(w << 1) & 0x8080808080808080ull;
+    int conts = int(((cont >> 7) * 0x0101010101010101ull) >> 56);
+    return UTF8_WORD - conts;
+}
+
 // from strlib
 // translate a relative string position: negative means back from end
 static int u_posrelat(int pos, size_t len)
@@ -68,6 +94,14 @@ static int utflen(lua_State* L)
     luaL_argcheck(L, --posj < (int)len, 3, "final position out of string");
     while (posi <= posj)
     {
+        // skip runs of ASCII characters; every byte is a valid single-byte sequence
+        if (posi + UTF8_WORD - 1 <= posj && isasciiword(loadword(s + posi)))
+        {
+            posi += UTF8_WORD;
+            n += UTF8_WORD;
+            continue;
+        }
+
         const char* s1 = utf8_decode(s + posi, NULL);
         if (s1 == NULL)
         {                                 // conversion error?
@@ -218,6 +252,18 @@ static int byteoffset(lua_State* L)
         else
         {
             n--; // do not move for 1st character
+
+            // skip whole words as long as the character we're looking for is past them
+            while (n > UTF8_WORD && posi + UTF8_WORD < (int)len)
+            {
+                int starts = countstarts(loadword(s + posi + 1));
+                if (starts >= n)
+                    break;
+
+                posi += UTF8_WORD;
+                n -= starts;
+            }
+
             while (n > 0 && posi < (int)len)
             {
                 do
@@ -250,6 +296,13 @@ static int iter_aux(lua_State* L)
     }
     if (n >= (int)len)
         return 0; // no more codepoints
+    else if ((unsigned char)s[n] < 0x80 && !iscont(s + n + 1))
+    {
+        // fast path for ASCII characters; the check for continuation byte mirrors the one below
+        lua_pushinteger(L, n + 1);
+        lua_pushinteger(L, (unsigned char)s[n]);
+        return 2;
+    }
     else
     {
         int code;
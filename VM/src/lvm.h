@@ -32,3 +32,4 @@ LUAI_FUNC void luau_execute(lua_State* L);
 LUAI_FUNC int luau_precall(lua_State* L, struct lua_TValue* func, int nresults);
 LUAI_FUNC void luau_poscall(lua_State* L, StkId first);
 LUAI_FUNC void luau_callhook(lua_State* L, lua_Hook hook, void* userdata);
+LUAI_FUNC void luau_loaddebuginfo(lua_State* L, Proto* p);
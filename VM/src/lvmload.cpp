@@ -100,6 +100,90 @@ static TString* readString(TempBuffer<TString*>& strings, const char* data, size
     return id == 0 ? NULL : strings[id - 1];
 }
 
+static TString* readString(lua_State* L, TempBuffer<TString*>& strings, const char* data, size_t size, size_t& offset)
+{
+    return readString(strings, data, size, offset);
+}
+
+static TString* readString(lua_State* L, LazyDebugInfo* info, const char* data, size_t size, size_t& offset)
+{
+    unsigned int id = readVarInt(data, size, offset);
+
+    if (id == 0)
+        return NULL;
+
+    LUAU_ASSERT(int(id) <= info->sizestrings);
+
+    size_t stroffset = info->strings[id - 1];
+    unsigned int length = readVarInt(info->data, info->size, stroffset);
+
+    return luaS_newlstr(L, info->data + stroffset, length);
+}
+
+// decodes line info and local/upvalue names; strings are either the chunk string table or the debug info section
+template<typename Strings>
+static void loadDebugInfo(lua_State* L, Proto* p, Strings& strings, const char* data, size_t size, size_t& offset)
+{
+    uint8_t lineinfo = read<uint8_t>(data, size, offset);
+
+    if (lineinfo)
+    {
+        p->linegaplog2 = read<uint8_t>(data, size, offset);
+
+        int intervals = ((p->sizecode - 1) >> p->linegaplog2) + 1;
+        int absoffset = (p->sizecode + 3) & ~3;
+
+        p->sizelineinfo = absoffset + intervals * sizeof(int);
+        p->lineinfo = luaM_newarray(L, p->sizelineinfo, uint8_t, p->memcat);
+        p->abslineinfo = (int*)(p->lineinfo + absoffset);
+
+        uint8_t lastoffset = 0;
+        for (int j = 0; j < p->sizecode; ++j)
+        {
+            lastoffset += read<uint8_t>(data, size, offset);
+            p->lineinfo[j] = lastoffset;
+        }
+
+        int lastline = 0;
+        for (int j = 0; j < intervals; ++j)
+        {
+            lastline += read<int32_t>(data, size, offset);
+            p->abslineinfo[j] = lastline;
+        }
+    }
+
+    uint8_t debuginfo = read<uint8_t>(data, size, offset);
+
+    if (debuginfo)
+    {
+        p->sizelocvars = readVarInt(data, size, offset);
+        p->locvars = luaM_newarray(L, p->sizelocvars, LocVar, p->memcat);
+
+        for (int j = 0; j < p->sizelocvars; ++j)
+        {
+            p->locvars[j].varname = readString(L, strings, data, size, offset);
+            p->locvars[j].startpc = readVarInt(data, size, offset);
+            p->locvars[j].endpc = readVarInt(data, size, offset);
+            p->locvars[j].reg = read<uint8_t>(data, size, offset);
+
+            // lazily decoded names may be attached to a prototype that the collector has already marked
+            if (p->locvars[j].varname)
+                luaC_objbarrier(L, p, p->locvars[j].varname);
+        }
+
+        p->sizeupvalues = readVarInt(data, size, offset);
+        p->upvalues = luaM_newarray(L, p->sizeupvalues, TString*, p->memcat);
+
+        for (int j = 0; j < p->sizeupvalues; ++j)
+        {
+            p->upvalues[j] = readString(L, strings, data, size, offset);
+
+            if (p->upvalues[j])
+                luaC_objbarrier(L, p, p->upvalues[j]);
+        }
+    }
+}
+
 static void resolveImportSafe(lua_State* L, Table* env, TValue* k, uint32_t id)
 {
     struct ResolveImport
@@ -139,6 +223,127 @@ static void resolveImportSafe(lua_State* L, Table* env, TValue* k, uint32_t id)
     }
 }
 
+static void loadPoolConstant(lua_State* L, Table* envt, TempBuffer<TString*>& strings, TempBuffer<TValue>& pool, unsigned int index, const char* data,
+    size_t size, size_t& offset)
+{
+    TValue* k = &pool[index];
+
+    switch (read<uint8_t>(data, size, offset))
+    {
+    case LBC_CONSTANT_NIL:
+        setnilvalue(k);
+        break;
+
+    case LBC_CONSTANT_BOOLEAN:
+    {
+        uint8_t v = read<uint8_t>(data, size, offset);
+        setbvalue(k, v);
+        break;
+    }
+
+    case LBC_CONSTANT_NUMBER:
+    {
+        double v = read<double>(data, size, offset);
+        setnvalue(k, v);
+        break;
+    }
+
+    case LBC_CONSTANT_STRING:
+    {
+        TString* v = readString(strings, data, size, offset);
+        setsvalue(L, k, v);
+        break;
+    }
+
+    case LBC_CONSTANT_IMPORT:
+    {
+        // pool imports list path components as pool indices, so we gather them into a temporary constant table for resolution
+        int count = readVarInt(data, size, offset);
+        LUAU_ASSERT(count >= 1 && count <= 3);
+
+        TValue path[3];
+        for (int i = 0; i < count; ++i)
+            setobj(L, &path[i], &pool[readVarInt(data, size, offset)]);
+
+        uint32_t iid = (uint32_t(count) << 30) | (1 << 10) | 2;
+        resolveImportSafe(L, envt, path, iid);
+        setobj(L, k, L->top - 1);
+        L->top--;
+        break;
+    }
+
+    case LBC_CONSTANT_TABLE:
+    {
+        int keys = readVarInt(data, size, offset);
+        Table* h = luaH_new(L, 0, keys);
+        for (int i = 0; i < keys; ++i)
+        {
+            int key = readVarInt(data, size, offset);
+            TValue* val = luaH_set(L, h, &pool[key]);
+            setnvalue(val, 0.0);
+        }
+        sethvalue(L, k, h);
+        break;
+    }
+
+    default:
+        LUAU_ASSERT(!"Unexpected constant kind");
+    }
+}
+
+static uint32_t hashConstants(const TValue* k, int sizek)
+{
+    // FNV-1a inspired hash over constant tags and payloads
+    uint32_t hash = 2166136261 ^ uint32_t(sizek);
+
+    for (int i = 0; i < sizek; ++i)
+    {
+        uint64_t bits = 0;
+
+        if (ttisnumber(&k[i]))
+            memcpy(&bits, &nvalue(&k[i]), sizeof(bits));
+        else if (ttisboolean(&k[i]))
+            bits = bvalue(&k[i]);
+        else if (iscollectable(&k[i]))
+            bits = uintptr_t(gcvalue(&k[i]));
+
+        hash = (hash ^ uint32_t(ttype(&k[i]))) * 16777619;
+        hash = (hash ^ uint32_t(bits)) * 16777619;
+        hash = (hash ^ uint32_t(bits >> 32)) * 16777619;
+    }
+
+    // multiplication only carries differences upwards, so the high bits are folded down for the bucket mask to see them
+    return hash ^ (hash >> 16);
+}
+
+static bool equalConstants(const Proto* p, const Proto* q)
+{
+    if (p->sizek != q->sizek)
+        return false;
+
+    for (int i = 0; i < p->sizek; ++i)
+    {
+        const TValue* a = &p->k[i];
+        const TValue* b = &q->k[i];
+
+        // numbers are compared bitwise since 0.0 and -0.0 are equal but not interchangeable as constants
+        if (ttisnumber(a) && ttisnumber(b))
+        {
+            if (memcmp(&nvalue(a), &nvalue(b), sizeof(double)) != 0)
+                return false;
+        }
+        else if (ttisvector(a) && ttisvector(b))
+        {
+            if (memcmp(vvalue(a), vvalue(b), sizeof(float) * LUA_VECTOR_SIZE) != 0)
+                return false;
+        }
+        else if (!luaO_rawequalObj(a, b))
+            return false;
+    }
+
+    return true;
+}
+
 int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size, int env)
 {
     size_t offset = 0;
@@ -184,10 +389,31 @@ int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size
         offset += length;
     }
 
+    // constant pool; function constant tables refer to its entries, so imports are resolved and table templates are created once per chunk
+    unsigned int poolCount = version >= LBC_VERSION_CONSTANTPOOL ? readVarInt(data, size, offset) : 0;
+    TempBuffer<TValue> pool(L, poolCount);
+
+    for (unsigned int i = 0; i < poolCount; ++i)
+        loadPoolConstant(L, envt, strings, pool, i, data, size, offset);
+
     // proto table
     unsigned int protoCount = readVarInt(data, size, offset);
     TempBuffer<Proto*> protos(L, protoCount);
 
+    // prototypes with identical constant tables share them; this is an open addressing hash table of constant table owners
+    size_t sharedkMask = 0;
+
+    if (poolCount)
+    {
+        while (sharedkMask + 1 < protoCount * 2)
+            sharedkMask = sharedkMask * 2 + 1;
+    }
+
+    TempBuffer<Proto*> sharedk(L, poolCount ? sharedkMask + 1 : 0);
+
+    for (size_t i = 0; i < sharedk.count; ++i)
+        sharedk[i] = NULL;
+
     for (unsigned int i = 0; i < protoCount; ++i)
     {
         Proto* p = luaF_newproto(L);
@@ -216,9 +442,31 @@ int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size
         }
 #endif
 
+        bool hasClosures = false;
+
         for (int j = 0; j < p->sizek; ++j)
         {
-            switch (read<uint8_t>(data, size, offset))
+            uint8_t kind;
+
+            // with a constant pool, constants are 1-based pool references and closures are stored inline after a 0 marker
+            if (version >= LBC_VERSION_CONSTANTPOOL)
+            {
+                unsigned int ref = readVarInt(data, size, offset);
+
+                if (ref)
+                {
+                    setobj(L, &p->k[j], &pool[ref - 1]);
+                    continue;
+                }
+
+                kind = LBC_CONSTANT_CLOSURE;
+            }
+            else
+            {
+                kind = read<uint8_t>(data, size, offset);
+            }
+
+            switch (kind)
             {
             case LBC_CONSTANT_NIL:
                 setnilvalue(&p->k[j]);
@@ -274,6 +522,7 @@ int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size
                 Closure* cl = luaF_newLclosure(L, protos[fid]->nups, envt, protos[fid]);
                 cl->preload = (cl->nupvalues > 0);
                 setclvalue(L, &p->k[j], cl);
+                hasClosures = true;
                 break;
             }
 
@@ -282,6 +531,26 @@ int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size
             }
         }
 
+        // closure constants are unique to each function, so only constant tables without them are worth sharing
+        if (sharedk.count && p->sizek && !hasClosures)
+        {
+            size_t bucket = hashConstants(p->k, p->sizek) & sharedkMask;
+
+            while (sharedk[bucket] && !equalConstants(sharedk[bucket], p))
+                bucket = (bucket + 1) & sharedkMask;
+
+            if (Proto* owner = sharedk[bucket])
+            {
+                luaM_freearray(L, p->k, p->sizek, TValue, p->memcat);
+                p->k = owner->k;
+                p->kowner = owner;
+            }
+            else
+            {
+                sharedk[bucket] = p;
+            }
+        }
+
         p->sizep = readVarInt(data, size, offset);
         p->p = luaM_newarray(L, p->sizep, Proto*, p->memcat);
         for (int j = 0; j < p->sizep; ++j)
@@ -293,64 +562,71 @@ int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size
         p->linedefined = readVarInt(data, size, offset);
         p->debugname = readString(strings, data, size, offset);
 
-        uint8_t lineinfo = read<uint8_t>(data, size, offset);
+        loadDebugInfo(L, p, strings, data, size, offset);
 
-        if (lineinfo)
+        if (version >= LBC_VERSION_TYPEINFO)
         {
-            p->linegaplog2 = read<uint8_t>(data, size, offset);
-
-            int intervals = ((p->sizecode - 1) >> p->linegaplog2) + 1;
-            int absoffset = (p->sizecode + 3) & ~3;
-
-            p->sizelineinfo = absoffset + intervals * sizeof(int);
-            p->lineinfo = luaM_newarray(L, p->sizelineinfo, uint8_t, p->memcat);
-            p->abslineinfo = (int*)(p->lineinfo + absoffset);
+            unsigned int typesize = readVarInt(data, size, offset);
 
-            uint8_t lastoffset = 0;
-            for (int j = 0; j < p->sizecode; ++j)
+            if (typesize)
             {
-                lastoffset += read<uint8_t>(data, size, offset);
-                p->lineinfo[j] = lastoffset;
-            }
-
-            int lastline = 0;
-            for (int j = 0; j < intervals; ++j)
-            {
-                lastline += read<int32_t>(data, size, offset);
-                p->abslineinfo[j] = lastline;
+                p->sizetypeinfo = typesize;
+                p->typeinfo = luaM_newarray(L, p->sizetypeinfo, uint8_t, p->memcat);
+                memcpy(p->typeinfo, data + offset, typesize);
+                offset += typesize;
             }
         }
 
-        uint8_t debuginfo = read<uint8_t>(data, size, offset);
+        protos[i] = p;
+    }
+
+    // "main" proto is pushed to Lua stack
+    uint32_t mainid = readVarInt(data, size, offset);
+    Proto* main = protos[mainid];
+
+    // debug info section is kept in encoded form and decoded for each proto on first use
+    if (version >= LBC_VERSION_DEBUGSECTION)
+    {
+        LazyDebugInfo* info = (LazyDebugInfo*)luaM_new_(L, sizeof(LazyDebugInfo), L->activememcat);
+        info->refs = 1;
+        info->memcat = L->activememcat;
+        info->size = size - offset;
+        info->data = luaM_newarray(L, info->size, char, info->memcat);
+        memcpy(info->data, data + offset, info->size);
+
+        size_t sectionoffset = 0;
+
+        info->sizestrings = readVarInt(info->data, info->size, sectionoffset);
+        info->strings = luaM_newarray(L, info->sizestrings, uint32_t, info->memcat);
 
-        if (debuginfo)
+        for (int i = 0; i < info->sizestrings; ++i)
         {
-            p->sizelocvars = readVarInt(data, size, offset);
-            p->locvars = luaM_newarray(L, p->sizelocvars, LocVar, p->memcat);
+            info->strings[i] = uint32_t(sectionoffset);
 
-            for (int j = 0; j < p->sizelocvars; ++j)
-            {
-                p->locvars[j].varname = readString(strings, data, size, offset);
-                p->locvars[j].startpc = readVarInt(data, size, offset);
-                p->locvars[j].endpc = readVarInt(data, size, offset);
-                p->locvars[j].reg = read<uint8_t>(data, size, offset);
-            }
+            unsigned int length = readVarInt(info->data, info->size, sectionoffset);
+            sectionoffset += length;
+        }
 
-            p->sizeupvalues = readVarInt(data, size, offset);
-            p->upvalues = luaM_newarray(L, p->sizeupvalues, TString*, p->memcat);
+        for (unsigned int i = 0; i < protoCount; ++i)
+        {
+            unsigned int length = readVarInt(info->data, info->size, sectionoffset);
 
-            for (int j = 0; j < p->sizeupvalues; ++j)
+            // functions with inline debug info have an empty record; this happens when the section is only present due to a newer version
+            if (length)
             {
-                p->upvalues[j] = readString(strings, data, size, offset);
+                protos[i]->lazydebug = info;
+                protos[i]->lazydebugoffset = int(sectionoffset);
+                info->refs++;
             }
+
+            sectionoffset += length;
         }
 
-        protos[i] = p;
-    }
+        LUAU_ASSERT(sectionoffset == info->size);
 
-    // "main" proto is pushed to Lua stack
-    uint32_t mainid = readVarInt(data, size, offset);
-    Proto* main = protos[mainid];
+        // the extra reference keeps the section alive while it's being attached and releases it if no function needs it
+        luaF_releasedebuginfo(L, info);
+    }
 
     luaC_threadbarrier(L);
 
@@ -362,3 +638,17 @@ int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size
 
     return 0;
 }
+
+void luau_loaddebuginfo(lua_State* L, Proto* p)
+{
+    LazyDebugInfo* info = p->lazydebug;
+
+    if (!info)
+        return;
+
+    size_t offset = p->lazydebugoffset;
+    loadDebugInfo(L, p, info, info->data, info->size, offset);
+
+    p->lazydebug = NULL;
+    luaF_releasedebuginfo(L, info);
+}
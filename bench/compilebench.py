@@ -0,0 +1,163 @@
+#!/usr/bin/python3
+# This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+
+# Measures compilation throughput of 'luau --compile=null' over a synthetic corpus of generated modules
+# Parsing and compilation time are reported per MB of source; compilation time includes bytecode finalization
+# The corpus is generated deterministically so that results are comparable between runs and builds
+
+import argparse
+import os
+import random
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+scriptdir = os.path.dirname(os.path.realpath(__file__))
+defaultVm = 'luau.exe' if os.name == "nt" else './luau'
+
+argumentParser = argparse.ArgumentParser(description='Benchmark compilation throughput on a synthetic corpus')
+argumentParser.add_argument('--vm', dest='vm', default=defaultVm, help='Luau executable to test (' + defaultVm + ' by default)')
+argumentParser.add_argument('--size', dest='size', type=int, default=64, help='Size of the generated corpus in MB')
+argumentParser.add_argument('--file-size', dest='fileSize', type=int, default=16, help='Approximate size of each generated file in KB')
+argumentParser.add_argument('--corpus', dest='corpus', help='Use an existing folder with source files instead of generating one')
+argumentParser.add_argument('--keep', dest='keep', help='Generate the corpus into this folder and keep it after the run')
+argumentParser.add_argument('--threads', dest='threads', default='1,0', help='Comma-separated list of thread counts to test (0 uses all cores)')
+argumentParser.add_argument('--runs', dest='runs', type=int, default=3, help='Number of runs for each thread count; the fastest run is reported')
+argumentParser.add_argument('-O', dest='optimize', type=int, default=1, help='Optimization level to compile with')
+argumentParser.add_argument('--seed', dest='seed', type=int, default=42, help='Random seed for corpus generation')
+
+statsRe = re.compile(r'Read ([\d.]+) MB in ([\d.]+)s, parsed in ([\d.]+)s \([\d.]+ MB/s\), compiled in ([\d.]+)s \([\d.]+ MB/s\); ([\d.]+)s wall time using (\d+) threads')
+
+class Generator:
+    def __init__(self, rng):
+        self.rng = rng
+        self.counter = 0
+
+    def name(self, prefix):
+        self.counter += 1
+        return "{}{}".format(prefix, self.counter)
+
+    def expr(self, names, depth=0):
+        r = self.rng.random()
+
+        if depth > 2 or r < 0.3:
+            return self.rng.choice(names) if names and r < 0.2 else str(self.rng.randint(0, 1000))
+        elif r < 0.5:
+            return "{} {} {}".format(self.expr(names, depth + 1), self.rng.choice(["+", "-", "*", "/", "..", "==", "<", "and", "or"]), self.expr(names, depth + 1))
+        elif r < 0.6:
+            return '"{}"'.format(self.name("str"))
+        elif r < 0.7:
+            return "math.{}({})".format(self.rng.choice(["abs", "floor", "max", "min", "sqrt"]), self.expr(names, depth + 1))
+        elif r < 0.8:
+            return "{{ x = {}, y = {}, [{}] = true }}".format(self.expr(names, depth + 1), self.expr(names, depth + 1), self.expr(names, depth + 1))
+        elif r < 0.9 and names:
+            return "{}.field{}".format(self.rng.choice(names), self.rng.randint(0, 20))
+        else:
+            return "if {} then {} else {}".format(self.expr(names, depth + 1), self.expr(names, depth + 1), self.expr(names, depth + 1))
+
+    def block(self, out, indent, names, depth):
+        for _ in range(self.rng.randint(2, 6)):
+            r = self.rng.random()
+            pad = "    " * indent
+
+            if r < 0.35:
+                local = self.name("v")
+                out.append("{}local {}: number = {}".format(pad, local, self.expr(names)))
+                names = names + [local]
+            elif r < 0.5 and depth < 3:
+                var = self.name("i")
+                out.append("{}for {} = 1, {} do".format(pad, var, self.expr(names)))
+                self.block(out, indent + 1, names + [var], depth + 1)
+                out.append(pad + "end")
+            elif r < 0.6 and depth < 3:
+                key, value = self.name("k"), self.name("v")
+                out.append("{}for {}, {} in pairs({}) do".format(pad, key, value, self.rng.choice(names) if names else "_G"))
+                self.block(out, indent + 1, names + [key, value], depth + 1)
+                out.append(pad + "end")
+            elif r < 0.75 and depth < 3:
+                out.append("{}if {} then".format(pad, self.expr(names)))
+                self.block(out, indent + 1, names, depth + 1)
+                out.append(pad + "else")
+                self.block(out, indent + 1, names, depth + 1)
+                out.append(pad + "end")
+            elif r < 0.9 and names:
+                out.append("{}{}:method{}({}, {})".format(pad, self.rng.choice(names), self.rng.randint(0, 10), self.expr(names), self.expr(names)))
+            else:
+                out.append("{}print(`value {{({})}}`)".format(pad, self.expr(names)))
+
+    def module(self, size):
+        out = ["--!strict", "local M = {}", ""]
+        length = 0
+
+        while length < size:
+            fn = self.name("f")
+            args = [self.name("a") for _ in range(self.rng.randint(0, 4))]
+
+            start = len(out)
+            out.append("function M.{}({})".format(fn, ", ".join(a + ": any" for a in args)))
+            self.block(out, 1, args, 0)
+            out.append("    return {}".format(self.expr(args)))
+            out.append("end")
+            out.append("")
+
+            length += sum(len(l) + 1 for l in out[start:])
+
+        out.append("return M")
+        return "\n".join(out) + "\n"
+
+def generateCorpus(folder, arguments):
+    rng = random.Random(arguments.seed)
+    generator = Generator(rng)
+
+    total = 0
+    index = 0
+
+    while total < arguments.size * 1024 * 1024:
+        source = generator.module(arguments.fileSize * 1024)
+
+        with open(os.path.join(folder, "module{}.luau".format(index)), "w") as f:
+            f.write(source)
+
+        total += len(source)
+        index += 1
+
+    print("Generated {} files, {:.1f} MB".format(index, total / (1024 * 1024)))
+
+def runCompile(arguments, folder, threads):
+    command = [arguments.vm, "--compile=null", "-O" + str(arguments.optimize), "-j" + str(threads), folder]
+    output = subprocess.check_output(command, stderr=subprocess.STDOUT).decode("utf-8", errors="replace")
+
+    match = statsRe.search(output)
+
+    if not match:
+        print("Unexpected output from {}:\n{}".format(" ".join(command), output), file=sys.stderr)
+        sys.exit(1)
+
+    return [float(match.group(i)) for i in range(1, 6)] + [int(match.group(6))]
+
+def main():
+    arguments = argumentParser.parse_args()
+
+    folder = arguments.corpus or arguments.keep or tempfile.mkdtemp(prefix="luau-compilebench-")
+
+    try:
+        if not arguments.corpus:
+            os.makedirs(folder, exist_ok=True)
+            generateCorpus(folder, arguments)
+
+        print("{:>8} {:>10} {:>12} {:>12} {:>12}".format("Threads", "Wall (s)", "Wall MB/s", "Parse MB/s", "Compile MB/s"))
+
+        for threads in [int(t) for t in arguments.threads.split(",")]:
+            best = min((runCompile(arguments, folder, threads) for _ in range(arguments.runs)), key=lambda r: r[4])
+            size, read, parse, compile, wall, used = best
+
+            # with multiple threads, parse and compile times are summed over all threads, so they measure per-core throughput
+            print("{:>8} {:>10.3f} {:>12.1f} {:>12.1f} {:>12.1f}".format(used, wall, size / wall, size / parse, size / compile))
+    finally:
+        if not arguments.corpus and not arguments.keep:
+            shutil.rmtree(folder)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,66 @@
+#!/usr/bin/python3
+# This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+
+# Measures lexer throughput of 'luau-ast --lex' over the source files of the benchmark suite
+# When a baseline executable is provided, both executables are measured and the relative speedup is reported
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+scriptdir = os.path.dirname(os.path.realpath(__file__))
+defaultAst = 'luau-ast.exe' if os.name == "nt" else './luau-ast'
+
+argumentParser = argparse.ArgumentParser(description='Benchmark lexer throughput on the benchmark corpus')
+argumentParser.add_argument('--ast', dest='ast', default=defaultAst, help='luau-ast executable to test (' + defaultAst + ' by default)')
+argumentParser.add_argument('--baseline', dest='baseline', help='luau-ast executable to compare against')
+argumentParser.add_argument('--folder', dest='folder', default=scriptdir, help='Folder with source files (the benchmark folder by default)')
+argumentParser.add_argument('--runs', dest='runs', type=int, default=5, help='Number of runs for each executable; the fastest run is reported')
+
+statsRe = re.compile(r'Lexed ([\d.]+) MB \((\d+) lexemes\) in ([\d.]+)s: ([\d.]+) MB/s')
+
+def collectFiles(folder):
+    result = []
+
+    for root, dirs, files in os.walk(folder):
+        for name in sorted(files):
+            if name.endswith(".lua") or name.endswith(".luau"):
+                result.append(os.path.join(root, name))
+
+    return sorted(result)
+
+def runLex(executable, files):
+    command = [executable, "--lex"] + files
+    output = subprocess.check_output(command, stderr=subprocess.STDOUT).decode("utf-8", errors="replace")
+
+    match = statsRe.search(output)
+
+    if not match:
+        print("Unexpected output from {}:\n{}".format(executable, output), file=sys.stderr)
+        sys.exit(1)
+
+    return float(match.group(4))
+
+def measure(executable, files, runs):
+    return max(runLex(executable, files) for _ in range(runs))
+
+def main():
+    arguments = argumentParser.parse_args()
+
+    files = collectFiles(arguments.folder)
+    size = sum(os.path.getsize(f) for f in files)
+
+    print("Lexing {} files, {:.1f} KB".format(len(files), size / 1024))
+
+    throughput = measure(arguments.ast, files, arguments.runs)
+    print("{:>12}: {:8.1f} MB/s".format("luau-ast", throughput))
+
+    if arguments.baseline:
+        baseline = measure(arguments.baseline, files, arguments.runs)
+        print("{:>12}: {:8.1f} MB/s".format("baseline", baseline))
+        print("{:>12}: {:8.2f}x".format("speedup", throughput / baseline))
+
+if __name__ == "__main__":
+    main()
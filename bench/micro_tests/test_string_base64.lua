@@ -0,0 +1,21 @@
+local bench = script and require(script.Parent.bench_support) or require("bench_support")
+
+bench.runCode(function()
+	local src = string.rep("abcdefghijklmnopqrstuvwxyz0123456789", 1000)
+	local str = ""
+	for i=1,100 do
+		str = string.base64encode(src)
+		str = string.base64decode(str)
+	end
+	assert(str == src)
+end, "string: base64 encode/decode")
+
+bench.runCode(function()
+	local src = string.rep("abcdefghijklmnopqrstuvwxyz0123456789", 1000)
+	local str = ""
+	for i=1,100 do
+		str = string.hexencode(src)
+		str = string.hexdecode(str)
+	end
+	assert(str == src)
+end, "string: hex encode/decode")
@@ -478,4 +478,27 @@ TEST_CASE_FIXTURE(JsonEncoderFixture, "encode_AstTypePackExplicit")
     CHECK(toJson(root->body.data[1]) == expected);
 }
 
+TEST_CASE_FIXTURE(JsonEncoderFixture, "encode_to_output")
+{
+    std::string source = "local t = {}\n";
+    for (int i = 0; i < 5000; ++i)
+        source += "t[" + std::to_string(i) + "] = \"value\\n\" .. -" + std::to_string(i) + ".5 -- comment\n";
+
+    ParseOptions opts;
+    opts.captureComments = true;
+    ParseResult result = Parser::parse(source.data(), source.size(), names, allocator, opts);
+    REQUIRE(result.errors.empty());
+
+    std::string output;
+    size_t chunks = 0;
+
+    toJson(result.root, result.commentLocations, [&](std::string_view chunk) {
+        output.append(chunk.data(), chunk.size());
+        chunks++;
+    });
+
+    CHECK(output == toJson(result.root, result.commentLocations));
+    CHECK(chunks > 1);
+}
+
 TEST_SUITE_END();
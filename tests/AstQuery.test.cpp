@@ -282,4 +282,68 @@ TEST_CASE_FIXTURE(Fixture, "Luau_selectively_query_for_a_different_boolean_2")
     REQUIRE(snd->value == true);
 }
 
+TEST_CASE_FIXTURE(Fixture, "location_index_matches_traversal")
+{
+    std::string source = R"(
+--!strict
+local t: { x: number, [string]: boolean } = { x = 1, y = true }
+type Fn<T> = (T, ...number) -> (string, T)
+
+local function f(a: number, b: string?): (number, string)
+    for i = 1, a do
+        if t[b or ""] then return i, `value {b}` elseif i > 2 then break end
+    end
+    return a :: number, if b then b else "" .. tostring(a)
+end
+
+print(f(1, "a"), t.x + #"abc", function(...) return ... end)
+local x = f(
+)";
+
+    for (bool supportTypeAliasGoToDeclaration : {false, true})
+    {
+        ScopedFastFlag sff{"SupportTypeAliasGoToDeclaration", supportTypeAliasGoToDeclaration};
+
+        check(source);
+
+        SourceModule* module = getMainSourceModule();
+        std::shared_ptr<AstLocationIndex> index = buildAstLocationIndex(module->root);
+
+        for (unsigned int line = 0; line < 16; ++line)
+        {
+            for (unsigned int column = 0; column < 80; ++column)
+            {
+                Position pos{line, column};
+
+                module->locationIndex = nullptr;
+                std::vector<AstNode*> ancestry = findAstAncestryOfPosition(*module, pos);
+                std::vector<AstNode*> ancestryWithTypes = findAstAncestryOfPosition(*module, pos, /* includeTypes= */ true);
+                AstNode* node = findNodeAtPosition(*module, pos);
+
+                module->locationIndex = index;
+                CHECK(findAstAncestryOfPosition(*module, pos) == ancestry);
+                CHECK(findAstAncestryOfPosition(*module, pos, /* includeTypes= */ true) == ancestryWithTypes);
+                CHECK(findNodeAtPosition(*module, pos) == node);
+            }
+        }
+    }
+}
+
+TEST_CASE_FIXTURE(Fixture, "location_index_built_by_frontend")
+{
+    frontend.options.indexAstLocations = true;
+
+    check(R"(
+local a = 1
+local b = a + 2
+    )");
+
+    SourceModule* module = getMainSourceModule();
+    REQUIRE(module->locationIndex);
+
+    AstExpr* expr = findExprAtPosition(*module, Position(2, 10));
+    REQUIRE(expr);
+    CHECK(expr->is<AstExprLocal>());
+}
+
 TEST_SUITE_END();
@@ -0,0 +1,155 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#include "Luau/AstSerializer.h"
+#include "Luau/AstJsonEncoder.h"
+#include "Luau/Parser.h"
+
+#include "ScopedFlags.h"
+#include "doctest.h"
+
+using namespace Luau;
+
+struct AstSerializerFixture
+{
+    Allocator allocator;
+    AstNameTable names{allocator};
+
+    ParseResult parse(const std::string& source)
+    {
+        ParseOptions options;
+        options.allowDeclarationSyntax = true;
+        options.captureComments = true;
+        return Parser::parse(source.data(), source.size(), names, allocator, options);
+    }
+
+    // decodes into a separate allocator and name table to make sure that nothing is shared with the original tree
+    void checkRoundTrip(const std::string& source)
+    {
+        ParseResult result = parse(source);
+        std::string data = serializeParseResult(result, source.data(), source.size());
+
+        Allocator decodedAllocator;
+        AstNameTable decodedNames(decodedAllocator);
+
+        std::optional<ParseResult> decoded =
+            deserializeParseResult(data.data(), data.size(), source.data(), source.size(), decodedNames, decodedAllocator);
+        REQUIRE(decoded);
+
+        CHECK(toJson(decoded->root) == toJson(result.root));
+        CHECK(decoded->lines == result.lines);
+
+        REQUIRE(decoded->errors.size() == result.errors.size());
+        for (size_t i = 0; i < result.errors.size(); ++i)
+        {
+            CHECK(decoded->errors[i].getLocation() == result.errors[i].getLocation());
+            CHECK(decoded->errors[i].getMessage() == result.errors[i].getMessage());
+        }
+
+        REQUIRE(decoded->hotcomments.size() == result.hotcomments.size());
+        for (size_t i = 0; i < result.hotcomments.size(); ++i)
+        {
+            CHECK(decoded->hotcomments[i].header == result.hotcomments[i].header);
+            CHECK(decoded->hotcomments[i].location == result.hotcomments[i].location);
+            CHECK(decoded->hotcomments[i].content == result.hotcomments[i].content);
+        }
+
+        REQUIRE(decoded->commentLocations.size() == result.commentLocations.size());
+        for (size_t i = 0; i < result.commentLocations.size(); ++i)
+        {
+            CHECK(decoded->commentLocations[i].type == result.commentLocations[i].type);
+            CHECK(decoded->commentLocations[i].location == result.commentLocations[i].location);
+        }
+    }
+};
+
+TEST_SUITE_BEGIN("AstSerializerTests");
+
+TEST_CASE_FIXTURE(AstSerializerFixture, "round_trip")
+{
+    checkRoundTrip(R"(
+--!strict
+--!optimize 2
+local M = {}
+
+type Point<T = number, U... = ...string> = { x: T, y: T, [string]: boolean, tag: "point" | false }
+export type Fn = <T>(a: T, ...number) -> (T, ...any)
+
+-- comment
+function M.f(a: number, b, ...: string): number
+    local t = { 1, 2, x = a, [b] = 0x10, 1e300, 0.1 }
+    for i = 1, #t, 2 do
+        if t[i] then continue elseif i > 2 then break else t[i] = nil end
+    end
+    for k, v in pairs(t) do
+        t[k] += v
+    end
+    while a < 10 do a = a + 1 end
+    repeat a -= 1 until a < 0
+    local s = `value {a} and {b :: string}`
+    return if a then -a else not b, ...
+end
+
+function M:method(x)
+    local function inner() return self, x end
+    return inner()
+end
+
+declare function print(...: any): ()
+declare class Foo
+    x: number
+    function method(self, n: number): string
+end
+declare bar: typeof(M)
+
+return M
+)");
+}
+
+TEST_CASE_FIXTURE(AstSerializerFixture, "round_trip_with_errors")
+{
+    checkRoundTrip("local a = 1 +\nlocal b: = 2\nfunction f(\nprint(a)");
+}
+
+TEST_CASE_FIXTURE(AstSerializerFixture, "rejects_stale_or_corrupted_data")
+{
+    std::string source = "local x = 1\nreturn x";
+    ParseResult result = parse(source);
+
+    std::string data = serializeParseResult(result, source.data(), source.size());
+
+    CHECK(deserializeParseResult(data.data(), data.size(), source.data(), source.size(), names, allocator));
+
+    std::string changed = "local y = 1\nreturn y";
+    CHECK(!deserializeParseResult(data.data(), data.size(), changed.data(), changed.size(), names, allocator));
+
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        std::string corrupted = data;
+        corrupted[i] ^= 1;
+
+        CHECK(!deserializeParseResult(corrupted.data(), corrupted.size(), source.data(), source.size(), names, allocator));
+    }
+
+    CHECK(!deserializeParseResult(data.data(), data.size() - 1, source.data(), source.size(), names, allocator));
+}
+
+TEST_CASE_FIXTURE(AstSerializerFixture, "rejects_deeply_nested_data")
+{
+    std::string source;
+    for (int i = 0; i < 100; ++i)
+        source += "local function f() ";
+    for (int i = 0; i < 100; ++i)
+        source += "end ";
+
+    // nested functions produce three nodes per level of parser recursion, which is within the limit
+    checkRoundTrip(source);
+
+    ParseResult result = parse(source);
+    std::string data = serializeParseResult(result, source.data(), source.size());
+
+    // data that is nested deeper than the parser allows is rejected instead of being decoded recursively
+    ScopedFastInt flag("LuauRecursionLimit", 50);
+
+    CHECK(!deserializeParseResult(data.data(), data.size(), source.data(), source.size(), names, allocator));
+}
+
+TEST_SUITE_END();
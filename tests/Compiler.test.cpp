@@ -1,6 +1,8 @@
 // This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
 #include "Luau/Compiler.h"
 #include "Luau/BytecodeBuilder.h"
+#include "Luau/CompileCache.h"
+#include "Luau/Parser.h"
 #include "Luau/StringUtils.h"
 
 #include "ScopedFlags.h"
@@ -49,6 +51,29 @@ static std::string compileFunction0Coverage(const char* source, int level)
     return bcb.dumpFunction(0);
 }
 
+static std::string compileBundle(const std::vector<std::pair<const char*, const char*>>& sources, uint32_t id, int optimizationLevel = 1)
+{
+    Allocator allocator;
+    AstNameTable names(allocator);
+    std::vector<BundleModule> modules;
+
+    for (auto [name, source] : sources)
+    {
+        ParseResult result = Parser::parse(source, strlen(source), names, allocator);
+        REQUIRE(result.errors.empty());
+
+        modules.push_back({name, result.root});
+    }
+
+    Luau::BytecodeBuilder bcb;
+    bcb.setDumpFlags(Luau::BytecodeBuilder::Dump_Code);
+    Luau::CompileOptions options;
+    options.optimizationLevel = optimizationLevel;
+    Luau::compileBundleOrThrow(bcb, modules, names, options);
+
+    return bcb.dumpFunction(id);
+}
+
 TEST_SUITE_BEGIN("Compiler");
 
 TEST_CASE("CompileToBytecode")
@@ -818,6 +843,52 @@ RETURN R0 1
 )");
 }
 
+TEST_CASE("TableSizePredictionConstructor")
+{
+    // fields assigned by methods called from the constructor are included in the prediction
+    CHECK_EQ("\n" + compileFunction(R"(
+local C = {}
+C.__index = C
+
+function C.new(n)
+    local self = setmetatable({}, C)
+    self.a = 1
+    self:init(n)
+    C.reset(self)
+    return self
+end
+
+function C:init(n)
+    self.b = n
+    self.c = n
+    self:reset()
+end
+
+function C.reset(self)
+    self.d = 0
+    self.a = 0
+end
+)",
+                        0),
+        R"(
+NEWTABLE R2 4 0
+GETUPVAL R3 0
+FASTCALL2 61 R2 R3 L0
+GETIMPORT R1 1 [setmetatable]
+CALL R1 2 1
+L0: LOADN R2 1
+SETTABLEKS R2 R1 K2 ['a']
+MOVE R4 R0
+NAMECALL R2 R1 K3 ['init']
+CALL R2 2 0
+GETUPVAL R3 0
+GETTABLEKS R2 R3 K4 ['reset']
+MOVE R3 R1
+CALL R2 1 0
+RETURN R1 1
+)");
+}
+
 TEST_CASE("TableSizePredictionLoop")
 {
     CHECK_EQ("\n" + compileFunction0(R"(
@@ -837,6 +908,111 @@ L0: LOADN R4 0
 SETTABLE R4 R0 R3
 FORNLOOP R1 L0
 L1: RETURN R0 1
+)");
+
+    // loops with bounds that aren't known at compile time use a small fixed prediction
+    CHECK_EQ("\n" + compileFunction0(R"(
+local n = ...
+local t = {}
+for i=1,n do
+    t[i] = 0
+end
+return t
+)"),
+        R"(
+GETVARARGS R0 1
+NEWTABLE R1 0 8
+LOADN R4 1
+MOVE R2 R0
+LOADN R3 1
+FORNPREP R2 L1
+L0: LOADN R5 0
+SETTABLE R5 R1 R4
+FORNLOOP R2 L0
+L1: RETURN R1 1
+)");
+}
+
+TEST_CASE("ScalarTables")
+{
+    // tables that only have their fields accessed with constant keys are kept in registers at O2
+    CHECK_EQ("\n" + compileFunction(R"(
+local function length(x, y)
+    local p = {x = x, y = y}
+    p.z = p.x * p.x + p.y * p.y
+    return math.sqrt(p.z)
+end
+)",
+                        0, 2),
+        R"(
+MOVE R2 R0
+MOVE R3 R1
+LOADNIL R4
+MUL R5 R2 R2
+MUL R6 R3 R3
+ADD R4 R5 R6
+FASTCALL1 25 R4 L0
+MOVE R6 R4
+GETIMPORT R5 2 [math.sqrt]
+CALL R5 1 -1
+L0: RETURN R5 -1
+)");
+
+    // multiple assignment must observe the old field values
+    CHECK_EQ("\n" + compileFunction(R"(
+local p = {x = 1, y = 2}
+p.x, p.y = p.y, p.x
+return p.x
+)",
+                        0, 2),
+        R"(
+LOADN R0 1
+LOADN R1 2
+MOVE R2 R1
+MOVE R1 R0
+MOVE R0 R2
+RETURN R0 1
+)");
+
+    // tables that escape, are indexed dynamically or are captured keep using table instructions
+    CHECK_EQ("\n" + compileFunction(R"(
+local a = {x = 1}
+local b = {x = 2}
+local c = {x = 3}
+print(a, b[1], function() return c.x end)
+)",
+                        1, 2),
+        R"(
+DUPTABLE R0 1
+LOADN R1 1
+SETTABLEKS R1 R0 K0 ['x']
+DUPTABLE R1 1
+LOADN R2 2
+SETTABLEKS R2 R1 K0 ['x']
+DUPTABLE R2 1
+LOADN R3 3
+SETTABLEKS R3 R2 K0 ['x']
+GETIMPORT R3 3 [print]
+MOVE R4 R0
+GETTABLEN R5 R1 1
+DUPCLOSURE R6 K4 []
+CAPTURE VAL R2
+CALL R3 3 0
+RETURN R0 0
+)");
+
+    // the optimization is disabled at O1
+    CHECK_EQ("\n" + compileFunction(R"(
+local p = {x = 1}
+return p.x
+)",
+                        0, 1),
+        R"(
+DUPTABLE R0 1
+LOADN R1 1
+SETTABLEKS R1 R0 K0 ['x']
+GETTABLEKS R1 R0 K0 ['x']
+RETURN R1 1
 )");
 }
 
@@ -2892,22 +3068,478 @@ return foo(a) + foo(assert(b))
     Luau::CompileOptions options;
     options.optimizationLevel = 2;
 
-    Luau::compileOrThrow(bcb, source, options);
+    Luau::compileOrThrow(bcb, source, options);
+
+    std::string remarks = bcb.dumpSourceRemarks();
+
+    CHECK_EQ(remarks, R"(
+local a, b = ...
+
+local function foo(x)
+    -- remark: builtin math.abs/1
+    return(math.abs(x))
+end
+
+-- remark: builtin assert/1
+-- remark: inlining succeeded (cost 2, profit 2.50x, depth 0)
+return foo(a) + foo(assert(b))
+)");
+}
+
+TEST_CASE("ProfileGuidedRemarks")
+{
+    const char* source = R"(
+local function foo(x)
+    return x * 2
+end
+
+local a = foo(1)
+local b = foo(2)
+
+for i=1,40 do a += i end
+for i=1,2 do b += i end
+
+return a + b
+)";
+
+    // lines 6 and 10 never ran, lines 7 and 9 are hot, everything else wasn't recorded
+    int hits[] = {-1, -1, -1, -1, -1, -1, 0, 1000, -1, 1000, 0, -1, -1};
+
+    Luau::BytecodeBuilder bcb;
+    bcb.setDumpFlags(Luau::BytecodeBuilder::Dump_Source | Luau::BytecodeBuilder::Dump_Remarks);
+    bcb.setDumpSource(source);
+
+    Luau::CompileOptions options;
+    options.optimizationLevel = 2;
+    options.profileLineHits = hits;
+    options.profileLineCount = int(std::size(hits));
+
+    Luau::compileOrThrow(bcb, source, options);
+
+    std::string remarks = bcb.dumpSourceRemarks();
+
+    CHECK_EQ(remarks, R"(
+local function foo(x)
+    return x * 2
+end
+
+-- remark: inlining failed: cold call site
+local a = foo(1)
+-- remark: inlining succeeded (cost 0, profit 3.00x, depth 0)
+local b = foo(2)
+
+-- remark: loop unroll succeeded (iterations 40, cost 40, profit 2.00x)
+for i=1,40 do a += i end
+-- remark: loop unroll failed: cold loop
+for i=1,2 do b += i end
+
+return a + b
+)");
+}
+
+TEST_CASE("Bundle")
+{
+    const char* mathx = R"(
+local M = {}
+
+M.scale = 4
+
+function M.square(x)
+    return x * x
+end
+
+return M
+)";
+
+    const char* util = R"(
+return { name = "util", answer = 42 }
+)";
+
+    const char* main = R"(
+local mathx = require("mathx")
+local util = require("util")
+return mathx.square(5) + mathx.scale, util.answer, require("other")
+)";
+
+    // dependencies run first and their results are kept in registers; require calls resolve to these registers
+    CHECK_EQ("\n" + compileBundle({{"main", main}, {"mathx", mathx}, {"util", util}}, 1, 1), R"(
+NEWTABLE R1 2 0
+LOADN R2 4
+SETTABLEKS R2 R1 K0 ['scale']
+DUPCLOSURE R2 K1 ['square']
+SETTABLEKS R2 R1 K2 ['square']
+MOVE R0 R1
+DUPTABLE R1 5
+LOADK R2 K6 ['util']
+SETTABLEKS R2 R1 K3 ['name']
+LOADN R2 42
+SETTABLEKS R2 R1 K4 ['answer']
+GETTABLEKS R3 R0 K2 ['square']
+LOADN R4 5
+CALL R3 1 1
+GETTABLEKS R4 R0 K0 ['scale']
+ADD R2 R3 R4
+GETTABLEKS R3 R1 K4 ['answer']
+GETIMPORT R4 8 [require]
+LOADK R5 K9 ['other']
+CALL R4 1 -1
+RETURN R2 -1
+)");
+
+    // module fields that are never mutated are inlined and constant folded across modules
+    CHECK_EQ("\n" + compileBundle({{"main", main}, {"mathx", mathx}, {"util", util}}, 1, 2), R"(
+NEWTABLE R1 2 0
+LOADN R2 4
+SETTABLEKS R2 R1 K0 ['scale']
+DUPCLOSURE R2 K1 ['square']
+SETTABLEKS R2 R1 K2 ['square']
+MOVE R0 R1
+DUPTABLE R1 5
+LOADK R2 K6 ['util']
+SETTABLEKS R2 R1 K3 ['name']
+LOADN R2 42
+SETTABLEKS R2 R1 K4 ['answer']
+LOADN R3 25
+ADDK R2 R3 K7 [4]
+LOADN R3 42
+GETIMPORT R4 9 [require]
+LOADK R5 K10 ['other']
+CALL R4 1 -1
+RETURN R2 -1
+)");
+
+    // writing to a module field outside of the module top level prevents its value from being used
+    const char* patch = R"(
+local mathx = require("mathx")
+mathx.scale = 8
+return mathx.scale
+)";
+
+    CHECK_EQ("\n" + compileBundle({{"patch", patch}, {"mathx", mathx}}, 1, 2), R"(
+NEWTABLE R1 2 0
+LOADN R2 4
+SETTABLEKS R2 R1 K0 ['scale']
+DUPCLOSURE R2 K1 ['square']
+SETTABLEKS R2 R1 K2 ['square']
+MOVE R0 R1
+LOADN R1 8
+SETTABLEKS R1 R0 K0 ['scale']
+GETTABLEKS R1 R0 K0 ['scale']
+RETURN R1 1
+)");
+}
+
+TEST_CASE("BundleFallback")
+{
+    // modules that can't be bundled are required at runtime, in the same order as without bundling
+    const char* main = R"(
+local a = require("a")
+return a.value
+)";
+
+    // require cycle
+    CHECK_EQ("\n" + compileBundle({{"main", main}, {"a", "return require('b')"}, {"b", "return require('a')"}}, 0), R"(
+GETIMPORT R0 1 [require]
+LOADK R1 K2 ['a']
+CALL R0 1 1
+GETTABLEKS R1 R0 K3 ['value']
+RETURN R1 1
+)");
+
+    // module arguments and early returns
+    CHECK_EQ("\n" + compileBundle({{"main", main}, {"a", "if ... then return {} end return { value = 1 }"}}, 0), R"(
+GETIMPORT R0 1 [require]
+LOADK R1 K2 ['a']
+CALL R0 1 1
+GETTABLEKS R1 R0 K3 ['value']
+RETURN R1 1
+)");
+
+    // side effects at the top level
+    CHECK_EQ("\n" + compileBundle({{"main", main}, {"a", "print('loading') return { value = 1 }"}}, 0), R"(
+GETIMPORT R0 1 [require]
+LOADK R1 K2 ['a']
+CALL R0 1 1
+GETTABLEKS R1 R0 K3 ['value']
+RETURN R1 1
+)");
+
+    // globals assigned by the entry module aren't visible to modules that are required at runtime
+    const char* globals = R"(
+answer = 42
+local a = require("a")
+return a.value
+)";
+
+    CHECK_EQ("\n" + compileBundle({{"main", globals}, {"a", "return { value = function() return answer end }"}}, 0), R"(
+LOADN R0 42
+SETGLOBAL R0 K0 ['answer']
+GETIMPORT R0 2 [require]
+LOADK R1 K3 ['a']
+CALL R0 1 1
+GETTABLEKS R1 R0 K4 ['value']
+RETURN R1 1
+)");
+
+    // modules that are required at runtime get their own copy of the modules they require
+    const char* shared = R"(
+local a = require("a")
+local b = require("b")
+return a.value + b.value
+)";
+
+    CHECK_EQ("\n" + compileBundle({{"main", shared}, {"a", "print(require('b').value) return { value = 1 }"}, {"b", "return { value = 2 }"}}, 0), R"(
+GETIMPORT R0 1 [require]
+LOADK R1 K2 ['a']
+CALL R0 1 1
+GETIMPORT R1 1 [require]
+LOADK R2 K3 ['b']
+CALL R1 1 1
+GETTABLEKS R3 R0 K4 ['value']
+GETTABLEKS R4 R1 K4 ['value']
+ADD R2 R3 R4
+RETURN R2 1
+)");
+
+    // replacing require affects all modules
+    const char* replaced = R"(
+local old = require
+require = function(name) return old(name) end
+local b = require("b")
+return b.value
+)";
+
+    CHECK_EQ("\n" + compileBundle({{"main", replaced}, {"b", "return { value = 2 }"}}, 1), R"(
+GETGLOBAL R0 K0 ['require']
+DUPCLOSURE R1 K1 []
+CAPTURE VAL R0
+SETGLOBAL R1 K0 ['require']
+GETGLOBAL R1 K0 ['require']
+LOADK R2 K2 ['b']
+CALL R1 1 1
+GETTABLEKS R2 R1 K3 ['value']
+RETURN R2 1
+)");
+}
+
+static std::string compileIncremental(const char* source, Luau::CompileCache* cache, int optimizationLevel, int debugInfoSection = 0)
+{
+    Luau::BytecodeBuilder bcb;
+    Luau::CompileOptions options;
+    options.optimizationLevel = optimizationLevel;
+    options.debugLevel = 2;
+    options.debugInfoSection = debugInfoSection;
+
+    if (cache)
+        Luau::compileOrThrow(bcb, source, *cache, options);
+    else
+        Luau::compileOrThrow(bcb, source, options);
+
+    return bcb.getBytecode();
+}
+
+TEST_CASE("IncrementalCompile")
+{
+    const char* source1 = R"(
+local function square(x)
+    return x * x
+end
+
+local function area(w, h)
+    return w * h
+end
+
+function update(t)
+    for k, v in t do
+        t[k] = square(v) + 1
+    end
+end
+
+return function(x) return area(x, 2) end
+)";
+
+    // area is one line longer, which moves update and the anonymous function
+    const char* source2 = R"(
+local function square(x)
+    return x * x
+end
+
+local function area(w, h)
+    local r = w * h
+    return r
+end
+
+function update(t)
+    for k, v in t do
+        t[k] = square(v) + 1
+    end
+end
+
+return function(x) return area(x, 2) end
+)";
+
+    // square is inlined into update at -O2 so changing it requires recompiling update as well
+    const char* source3 = R"(
+local function square(x)
+    return x * x * 1
+end
+
+local function area(w, h)
+    local r = w * h
+    return r
+end
+
+function update(t)
+    for k, v in t do
+        t[k] = square(v) + 1
+    end
+end
+
+return function(x) return area(x, 2) end
+)";
+
+    for (int optimizationLevel = 0; optimizationLevel <= 2; ++optimizationLevel)
+    {
+        CAPTURE(optimizationLevel);
+
+        Luau::CompileCache cache;
+
+        CHECK(compileIncremental(source1, &cache, optimizationLevel) == compileIncremental(source1, nullptr, optimizationLevel));
+        CHECK_EQ(cache.compiledFunctions, 5);
+        CHECK_EQ(cache.reusedFunctions, 0);
+
+        CHECK(compileIncremental(source1, &cache, optimizationLevel) == compileIncremental(source1, nullptr, optimizationLevel));
+        CHECK_EQ(cache.compiledFunctions, 0);
+        CHECK_EQ(cache.reusedFunctions, 5);
+
+        // the anonymous function inlines area at -O2; update inlines square which is now at a different offset, which changes line info
+        CHECK(compileIncremental(source2, &cache, optimizationLevel) == compileIncremental(source2, nullptr, optimizationLevel));
+        CHECK_EQ(cache.compiledFunctions, optimizationLevel == 2 ? 4 : 2);
+        CHECK_EQ(cache.reusedFunctions, optimizationLevel == 2 ? 1 : 3);
+
+        CHECK(compileIncremental(source3, &cache, optimizationLevel) == compileIncremental(source3, nullptr, optimizationLevel));
+        CHECK_EQ(cache.compiledFunctions, optimizationLevel == 2 ? 3 : 2);
+        CHECK_EQ(cache.reusedFunctions, optimizationLevel == 2 ? 2 : 3);
+
+        // changes to the main function body invalidate everything since functions can observe the values of enclosing locals
+        std::string source4 = "local k = 2" + std::string(source3);
+
+        CHECK(compileIncremental(source4.c_str(), &cache, optimizationLevel) == compileIncremental(source4.c_str(), nullptr, optimizationLevel));
+        CHECK_EQ(cache.compiledFunctions, 5);
+        CHECK_EQ(cache.reusedFunctions, 0);
+
+        // local names are stored separately when debug info is written to a trailing section, which changes the cache context
+        CHECK(compileIncremental(source3, &cache, optimizationLevel, 1) == compileIncremental(source3, nullptr, optimizationLevel, 1));
+        CHECK_EQ(cache.compiledFunctions, 5);
+        CHECK_EQ(cache.reusedFunctions, 0);
+
+        CHECK(compileIncremental(source2, &cache, optimizationLevel, 1) == compileIncremental(source2, nullptr, optimizationLevel, 1));
+        CHECK_EQ(cache.compiledFunctions, optimizationLevel == 2 ? 3 : 2);
+        CHECK_EQ(cache.reusedFunctions, optimizationLevel == 2 ? 2 : 3);
+    }
+}
+
+TEST_CASE("IncrementalCompileTypeAliases")
+{
+    // aliases with the same name in different scopes don't resolve to a type
+    const char* source1 = R"(
+do type T = number end
+do type T = string end
+
+return function(x: T) return x end
+)";
+
+    const char* source2 = R"(
+do type T = number end
+
+return function(x: T) return x end
+)";
+
+    Luau::CompileOptions options;
+    options.typeInfoLevel = 1;
+
+    auto compile = [&](const char* source, Luau::CompileCache* cache)
+    {
+        Luau::BytecodeBuilder bcb;
+
+        if (cache)
+            Luau::compileOrThrow(bcb, source, *cache, options);
+        else
+            Luau::compileOrThrow(bcb, source, options);
+
+        return bcb.getBytecode();
+    };
+
+    Luau::CompileCache cache;
+
+    CHECK(compile(source1, &cache) == compile(source1, nullptr));
+    CHECK_EQ(cache.compiledFunctions, 2);
+    CHECK_EQ(cache.reusedFunctions, 0);
+
+    CHECK(compile(source1, &cache) == compile(source1, nullptr));
+    CHECK_EQ(cache.compiledFunctions, 0);
+    CHECK_EQ(cache.reusedFunctions, 2);
+
+    // the argument type is known once the alias is no longer ambiguous, which changes the context of every function
+    CHECK(compile(source2, &cache) == compile(source2, nullptr));
+    CHECK_EQ(cache.compiledFunctions, 2);
+    CHECK_EQ(cache.reusedFunctions, 0);
+}
+
+TEST_CASE("IncrementalCompileTableShapes")
+{
+    // the size of the table that the constructor allocates depends on the fields that the method it calls assigns
+    const char* source1 = R"(
+local C = {}
+C.__index = C
+
+function C.new()
+    local self = setmetatable({}, C)
+    self.a = 1
+    self:init()
+    return self
+end
+
+function C:init()
+    self.b = 2
+end
+
+return C
+)";
+
+    const char* source2 = R"(
+local C = {}
+C.__index = C
+
+function C.new()
+    local self = setmetatable({}, C)
+    self.a = 1
+    self:init()
+    return self
+end
+
+function C:init()
+    self.b = 2; self.c = 3; self.d = 4; self.e = 5
+end
+
+return C
+)";
 
-    std::string remarks = bcb.dumpSourceRemarks();
+    for (int optimizationLevel = 0; optimizationLevel <= 2; ++optimizationLevel)
+    {
+        CAPTURE(optimizationLevel);
 
-    CHECK_EQ(remarks, R"(
-local a, b = ...
+        Luau::CompileCache cache;
 
-local function foo(x)
-    -- remark: builtin math.abs/1
-    return(math.abs(x))
-end
+        CHECK(compileIncremental(source1, &cache, optimizationLevel) == compileIncremental(source1, nullptr, optimizationLevel));
+        CHECK_EQ(cache.compiledFunctions, 3);
+        CHECK_EQ(cache.reusedFunctions, 0);
 
--- remark: builtin assert/1
--- remark: inlining succeeded (cost 2, profit 2.50x, depth 0)
-return foo(a) + foo(assert(b))
-)");
+        // only the method changes, but table sizes are predicted at -O1 and above so the constructor has to be recompiled as well
+        CHECK(compileIncremental(source2, &cache, optimizationLevel) == compileIncremental(source2, nullptr, optimizationLevel));
+        CHECK_EQ(cache.compiledFunctions, optimizationLevel == 0 ? 2 : 3);
+        CHECK_EQ(cache.reusedFunctions, optimizationLevel == 0 ? 1 : 0);
+    }
 }
 
 TEST_CASE("AssignmentConflict")
@@ -4222,6 +4854,43 @@ RETURN R0 4
 )");
 }
 
+TEST_CASE("ReverseArithConstants")
+{
+    const char* source = R"(
+local a = ...
+return 1 + a, 1 - a, 1 / a, 1 * a, 1 % a, 1 ^ a
+)";
+
+    Luau::BytecodeBuilder bcb;
+    bcb.setDumpFlags(Luau::BytecodeBuilder::Dump_Code);
+    Luau::CompileOptions options;
+    options.reverseArithConstants = 1;
+    Luau::compileOrThrow(bcb, source, options);
+
+    // constants on the left side of non-commutative operations are encoded directly
+    CHECK_EQ("\n" + bcb.dumpFunction(0), R"(
+GETVARARGS R0 1
+LOADN R2 1
+ADD R1 R2 R0
+SUBRK R2 K0 [1] R0
+DIVRK R3 K0 [1] R0
+LOADN R5 1
+MUL R4 R5 R0
+LOADN R6 1
+MOD R5 R6 R0
+LOADN R7 1
+POW R6 R7 R0
+RETURN R1 6
+)");
+
+    // these instructions require a newer bytecode version which is only used when necessary
+    CHECK_EQ(uint8_t(Luau::compile("local a = ... return 1 - a", options)[0]), LBC_VERSION_REVK);
+    CHECK_EQ(uint8_t(Luau::compile("local a = ... return a - 1", options)[0]), LBC_VERSION_TARGET);
+
+    // by default, the constant is loaded into a register and the bytecode doesn't need the newer version
+    CHECK_EQ(uint8_t(Luau::compile("local a = ... return 1 - a")[0]), LBC_VERSION_TARGET);
+}
+
 TEST_CASE("VectorFastCall")
 {
     const char* source = "return Vector3.new(1, 2, 3)";
@@ -4307,6 +4976,54 @@ RETURN R1 6
 )");
 }
 
+TEST_CASE("DebugInfoSection")
+{
+    Luau::CompileOptions options;
+    options.debugLevel = 2;
+
+    std::string embedded = Luau::compile("local alpha = ... return function() return alpha end", options);
+
+    options.debugInfoSection = 1;
+
+    std::string section = Luau::compile("local alpha = ... return function() return alpha end", options);
+
+    CHECK_EQ(uint8_t(embedded[0]), LBC_VERSION_TARGET);
+    CHECK_EQ(uint8_t(section[0]), LBC_VERSION_DEBUGSECTION);
+
+    // names move from the string table at the start of the bytecode to the section's own string table after all functions
+    CHECK_EQ(section.find("alpha"), section.rfind("alpha"));
+    CHECK(embedded.find("alpha") < 8);
+    CHECK(section.find("alpha") > 8);
+}
+
+TEST_CASE("ConstantPool")
+{
+    const char* source = R"(
+local function f(t) return math.floor(t.x), "constant", {x = 1, y = 2} end
+local function g(t) return math.floor(t.y), "constant", {x = 1, y = 2} end
+local function h(t) return math.floor(t.z), "constant", 0.5 end
+return f, g, h
+)";
+
+    Luau::CompileOptions options;
+
+    std::string separate = Luau::compile(source, options);
+
+    options.constantPool = 1;
+
+    std::string pooled = Luau::compile(source, options);
+
+    CHECK_EQ(uint8_t(separate[0]), LBC_VERSION_TARGET);
+    CHECK_EQ(uint8_t(pooled[0]), LBC_VERSION_CONSTANTPOOL);
+
+    // import paths, numbers and table templates are encoded once instead of once per function
+    CHECK(pooled.size() < separate.size());
+
+    double half = 0.5;
+    std::string encoded(reinterpret_cast<const char*>(&half), sizeof(half));
+    CHECK_EQ(pooled.find(encoded), pooled.rfind(encoded));
+}
+
 TEST_CASE("LoopUnrollBasic")
 {
     // forward loops
@@ -4960,6 +5677,164 @@ L3: RETURN R0 0
 )");
 }
 
+TEST_CASE("SelfTailCall")
+{
+    // tail calls to the function itself reassign the arguments and jump back to the start
+    CHECK_EQ("\n" + compileFunction(R"(
+local function fact(n, acc)
+    if n <= 1 then
+        return acc
+    end
+    return fact(n - 1, acc * n)
+end
+)",
+                        0, 2),
+        R"(
+L0: LOADN R2 1
+JUMPIFNOTLE R0 R2 L1
+RETURN R1 1
+L1: SUBK R2 R0 K0 [1]
+MUL R3 R1 R0
+MOVE R0 R2
+MOVE R1 R3
+JUMPBACK L0
+)");
+
+    // arguments that are passed through aren't reassigned, missing arguments are set to nil and extra arguments are still evaluated
+    CHECK_EQ("\n" + compileFunction(R"(
+local function find(t, v, i)
+    i = i or 1
+    if t[i] == v then
+        return i
+    end
+    return find(t, v, i + 1, (print()))
+end
+)",
+                        0, 2),
+        R"(
+L0: ORK R2 R2 K0 [1]
+GETTABLE R3 R0 R2
+JUMPIFNOTEQ R3 R1 L1
+RETURN R2 1
+L1: ADDK R5 R2 K0 [1]
+GETIMPORT R6 2 [print]
+CALL R6 0 1
+MOVE R2 R5
+JUMPBACK L0
+)");
+
+    CHECK_EQ("\n" + compileFunction(R"(
+local function reset(a, b)
+    if a then
+        return reset()
+    end
+    return b
+end
+)",
+                        0, 2),
+        R"(
+L0: JUMPIFNOT R0 L1
+LOADNIL R0
+LOADNIL R1
+JUMPBACK L0
+L1: RETURN R1 1
+)");
+
+    // captured locals are closed before the next iteration
+    CHECK_EQ("\n" + compileFunction(R"(
+local function collect(n, fns)
+    if n == 0 then
+        return fns
+    end
+    local v = n
+    fns[n] = function() v += 1 return v end
+    return collect(n - 1, fns)
+end
+)",
+                        1, 2),
+        R"(
+L0: JUMPXEQKN R0 K0 L1 NOT [0]
+RETURN R1 1
+L1: MOVE R2 R0
+NEWCLOSURE R3 P0
+CAPTURE REF R2
+SETTABLE R3 R1 R0
+SUBK R3 R0 K1 [1]
+CLOSEUPVALS R2
+MOVE R0 R3
+JUMPBACK L0
+)");
+
+    // captured arguments are closed before they are reassigned
+    CHECK_EQ("\n" + compileFunction(R"(
+local function collect(n, fns)
+    if n == 0 then
+        return fns
+    end
+    fns[n] = function() n += 0 return n end
+    return collect(n - 1, fns)
+end
+)",
+                        1, 2),
+        R"(
+L0: JUMPXEQKN R0 K0 L1 NOT [0]
+CLOSEUPVALS R0
+RETURN R1 1
+L1: NEWCLOSURE R2 P0
+CAPTURE REF R0
+SETTABLE R2 R1 R0
+SUBK R2 R0 K1 [1]
+CLOSEUPVALS R0
+MOVE R0 R2
+JUMPBACK L0
+)");
+
+    // calls that aren't tail calls, have a variable number of arguments or happen below O2 are compiled as regular calls
+    CHECK_EQ("\n" + compileFunction(R"(
+local function sum(n, t)
+    if n == 0 then
+        return 0
+    end
+    return n + sum(n - 1, t), sum(n - 1, unpack(t))
+end
+local function spread(n, ...)
+    return spread(...)
+end
+)",
+                        0, 2),
+        R"(
+JUMPXEQKN R0 K0 L0 NOT [0]
+LOADN R2 0
+RETURN R2 1
+L0: GETUPVAL R3 0
+SUBK R4 R0 K1 [1]
+MOVE R5 R1
+CALL R3 2 1
+ADD R2 R0 R3
+GETUPVAL R3 0
+SUBK R4 R0 K1 [1]
+FASTCALL1 53 R1 L1
+MOVE R6 R1
+GETIMPORT R5 3 [unpack]
+CALL R5 1 -1
+L1: CALL R3 -1 -1
+RETURN R2 -1
+)");
+
+    CHECK_EQ("\n" + compileFunction(R"(
+local function loop(n)
+    return loop(n - 1)
+end
+)",
+                        0, 1),
+        R"(
+GETUPVAL R1 0
+SUBK R2 R0 K0 [1]
+CALL R1 1 -1
+RETURN R1 -1
+)");
+}
+
 TEST_CASE("InlineBasic")
 {
     // inline function that returns a constant
@@ -5444,9 +6319,8 @@ CLOSEUPVALS R3
 JUMP L1
 CLOSEUPVALS R3
 L0: LOADNIL R2
-L1: MOVE R3 R2
-MOVE R4 R1
-RETURN R3 2
+L1: MOVE R3 R1
+RETURN R2 2
 )");
 }
 
@@ -5993,7 +6867,6 @@ return foo(42)
                         1, 2),
         R"(
 DUPCLOSURE R0 K0 ['foo']
-CAPTURE VAL R0
 MOVE R1 R0
 LOADN R2 42
 CALL R1 1 -1
@@ -6059,9 +6932,8 @@ return y, x
 )"),
         R"(
 GETVARARGS R0 2
-MOVE R2 R1
-MOVE R3 R0
-RETURN R2 2
+MOVE R2 R0
+RETURN R1 2
 )");
 
     // also double check the optimization doesn't trip on no-argument return (these are rare)
@@ -6083,6 +6955,84 @@ RETURN R0 2
 )");
 }
 
+TEST_CASE("MoveCoalescing")
+{
+    // table constructors are built directly in the local when the items don't refer to it; self-assignments don't need temporaries
+    CHECK_EQ("\n" + compileFunction(R"(
+local t, u = ...
+t = {1, 2, x = u}
+u = {t}
+t, t.x = t, 5
+return u, 1
+)",
+                        0, 1),
+        R"(
+GETVARARGS R0 2
+NEWTABLE R0 1 2
+LOADN R2 1
+LOADN R3 2
+SETLIST R0 R2 2 [1]
+SETTABLEKS R1 R0 K0 ['x']
+NEWTABLE R1 0 1
+MOVE R2 R0
+SETLIST R1 R2 1 [1]
+LOADN R2 5
+SETTABLEKS R2 R0 K0 ['x']
+LOADN R2 1
+RETURN R1 2
+)");
+
+    // tables that refer to the target local still need a temporary, and reverse moves are removed unless they are jump targets
+    CHECK_EQ("\n" + compileFunction(R"(
+local t, u = ...
+t = {t}
+t = u u = t
+while t do t = u u = t end
+)",
+                        0, 1),
+        R"(
+GETVARARGS R0 2
+NEWTABLE R2 0 1
+MOVE R3 R0
+SETLIST R2 R3 1 [1]
+MOVE R0 R2
+MOVE R0 R1
+L0: JUMPIFNOT R0 L1
+MOVE R0 R1
+JUMPBACK L0
+L1: RETURN R0 0
+)");
+
+    // optimization level 0 keeps all moves
+    CHECK_EQ("\n" + compileFunction(R"(
+local t, u = ...
+t = u u = t
+)",
+                        0, 0),
+        R"(
+GETVARARGS R0 2
+MOVE R0 R1
+MOVE R1 R0
+RETURN R0 0
+)");
+
+    // returned locals that are written after their declaration are copied before the values that follow them are evaluated
+    CHECK_EQ("\n" + compileFunction(R"(
+local b = 1
+return b, (function() b = 2 end)()
+)",
+                        1, 1),
+        R"(
+LOADN R0 1
+MOVE R1 R0
+NEWCLOSURE R2 P0
+CAPTURE REF R0
+CALL R2 0 -1
+CLOSEUPVALS R0
+RETURN R1 -1
+)");
+}
+
 TEST_CASE("OptimizationLevel")
 {
     // at optimization level 1, no inlining is performed
@@ -6820,4 +7770,80 @@ RETURN R0 0
 )");
 }
 
+TEST_CASE("FunctionTypeInfo")
+{
+    const char* source = R"(
+type Vec = vector
+type Num = number
+
+local function foo(a: number, b: string?, c: Vec, d: Num, e, f: {x: number}, g: () -> (), h: number | string)
+    return a
+end
+
+local function bar(a, b: any)
+    return a
+end
+
+local obj = {}
+function obj:method(x: boolean)
+    return x
+end
+)";
+
+    Luau::BytecodeBuilder bcb;
+    bcb.setDumpFlags(Luau::BytecodeBuilder::Dump_Code | Luau::BytecodeBuilder::Dump_Types);
+
+    Luau::CompileOptions options;
+    options.typeInfoLevel = 1;
+    Luau::compileOrThrow(bcb, source, options);
+
+    CHECK_EQ("\n" + bcb.dumpFunction(0), R"(
+function(number, string?, vector, number, any, table, function, any)
+RETURN R0 1
+)");
+
+    // functions without useful annotations don't carry type information
+    CHECK_EQ("\n" + bcb.dumpFunction(1), R"(
+RETURN R0 1
+)");
+
+    CHECK_EQ("\n" + bcb.dumpFunction(2), R"(
+function(any, boolean)
+RETURN R1 1
+)");
+
+    // type information requires a newer bytecode version
+    CHECK_EQ(uint8_t(bcb.getBytecode()[0]), LBC_VERSION_TYPEINFO);
+
+    // without the option, types are ignored
+    Luau::BytecodeBuilder bcb2;
+    bcb2.setDumpFlags(Luau::BytecodeBuilder::Dump_Code | Luau::BytecodeBuilder::Dump_Types);
+    Luau::compileOrThrow(bcb2, source);
+
+    CHECK_EQ("\n" + bcb2.dumpFunction(0), R"(
+RETURN R0 1
+)");
+
+    CHECK_EQ(uint8_t(bcb2.getBytecode()[0]), LBC_VERSION_TARGET);
+
+    // aliases declared more than once don't resolve to a type, no matter how many times the name is reused
+    Luau::BytecodeBuilder bcb3;
+    bcb3.setDumpFlags(Luau::BytecodeBuilder::Dump_Code | Luau::BytecodeBuilder::Dump_Types);
+    Luau::compileOrThrow(bcb3, R"(
+do type T = number end
+do type T = string end
+do type T = number end
+
+local function foo(a: T, b: number)
+    return a
+end
+)",
+        options);
+
+    CHECK_EQ("\n" + bcb3.dumpFunction(0), R"(
+function(any, number)
+RETURN R0 1
+)");
+}
+
 TEST_SUITE_END();
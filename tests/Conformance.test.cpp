@@ -499,6 +499,61 @@ static void populateRTTI(lua_State* L, Luau::TypeId type)
     }
 }
 
+TEST_CASE("TypeInfo")
+{
+    lua_CompileOptions copts = defaultOptions();
+    copts.typeInfoLevel = 1;
+
+    runConformance("typeinfo.lua", nullptr, nullptr, nullptr, &copts);
+}
+
+TEST_CASE("TypeInfoDeoptimization")
+{
+    if (!codegen || !Luau::CodeGen::isSupported())
+        return;
+
+    StateRef globalState(luaL_newstate(), lua_close);
+    lua_State* L = globalState.get();
+
+    Luau::CodeGen::create(L);
+    luaL_openlibs(L);
+
+    lua_CompileOptions copts = defaultOptions();
+    copts.typeInfoLevel = 1;
+
+    // argument type guard fails on every call, so the function is deoptimized each time a new copy is loaded
+    std::string source = "local function f(x: number) return x end return f('1')";
+
+    size_t bytecodeSize = 0;
+    char* bytecode = luau_compile(source.data(), source.size(), &copts, &bytecodeSize);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        REQUIRE(luau_load(L, "=TypeInfoDeoptimization", bytecode, bytecodeSize, 0) == 0);
+        Luau::CodeGen::compile(L, -1);
+
+        lua_call(L, 0, 1);
+        CHECK_EQ(std::string(lua_tostring(L, -1)), "1");
+        lua_pop(L, 1);
+
+        CHECK(Luau::CodeGen::getDeoptimizedFunctionCount(L) > 0);
+
+        // native code of deoptimized functions is released together with the functions
+        lua_gc(L, LUA_GCCOLLECT, 0);
+        CHECK_EQ(Luau::CodeGen::getDeoptimizedFunctionCount(L), 0);
+    }
+
+    free(bytecode);
+}
+
+TEST_CASE("ScalarTables")
+{
+    lua_CompileOptions copts = defaultOptions();
+    copts.optimizationLevel = 2;
+
+    runConformance("scalartables.lua", nullptr, nullptr, nullptr, &copts);
+}
+
 TEST_CASE("Types")
 {
     runConformance("types.lua", [](lua_State* L) {
@@ -532,6 +587,87 @@ TEST_CASE("Debug")
     runConformance("debug.lua");
 }
 
+TEST_CASE("DebugInfoSection")
+{
+    lua_CompileOptions copts = defaultOptions();
+    copts.debugLevel = 2;
+    copts.debugInfoSection = 1;
+
+    runConformance("debug.lua", nullptr, nullptr, nullptr, &copts);
+    runConformance("errors.lua", nullptr, nullptr, nullptr, &copts);
+}
+
+TEST_CASE("ReverseArithConstants")
+{
+    lua_CompileOptions copts = defaultOptions();
+    copts.reverseArithConstants = 1;
+
+    runConformance("math.lua", nullptr, nullptr, nullptr, &copts);
+    runConformance("events.lua", nullptr, nullptr, nullptr, &copts);
+}
+
+TEST_CASE("ConstantPool")
+{
+    lua_CompileOptions copts = defaultOptions();
+    copts.constantPool = 1;
+
+    runConformance("basic.lua", nullptr, nullptr, nullptr, &copts);
+    runConformance("closure.lua", nullptr, nullptr, nullptr, &copts);
+    runConformance("constructs.lua", nullptr, nullptr, nullptr, &copts);
+    runConformance("gc.lua", nullptr, nullptr, nullptr, &copts);
+
+    // functions with identical constants share a single constant table after loading
+    std::string source = "local t = {}\n";
+    for (int i = 0; i < 100; ++i)
+        source += "t[" + std::to_string(i) + "] = function(o) return math.max(o.left, o.right), string.format('%d', o.value) end\n";
+    source += "return t\n";
+
+    auto loadSize = [&](int constantPool) {
+        StateRef globalState(luaL_newstate(), lua_close);
+        lua_State* L = globalState.get();
+
+        luaL_openlibs(L);
+
+        lua_CompileOptions options = defaultOptions();
+        options.constantPool = constantPool;
+
+        size_t bytecodeSize = 0;
+        char* bytecode = luau_compile(source.data(), source.size(), &options, &bytecodeSize);
+
+        lua_gc(L, LUA_GCCOLLECT, 0);
+        int before = lua_gc(L, LUA_GCCOUNT, 0) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0);
+
+        int result = luau_load(L, "=ConstantPool", bytecode, bytecodeSize, 0);
+        free(bytecode);
+        REQUIRE(result == 0);
+
+        lua_gc(L, LUA_GCCOLLECT, 0);
+        int after = lua_gc(L, LUA_GCCOUNT, 0) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0);
+
+        // make sure that shared constants survive collection of the function that owns them
+        lua_call(L, 0, 1);
+        lua_pushnil(L);
+        lua_rawseti(L, -2, 0);
+        lua_gc(L, LUA_GCCOLLECT, 0);
+
+        lua_rawgeti(L, -1, 99);
+        lua_newtable(L);
+        lua_pushinteger(L, 1);
+        lua_setfield(L, -2, "left");
+        lua_pushinteger(L, 2);
+        lua_setfield(L, -2, "right");
+        lua_pushinteger(L, 3);
+        lua_setfield(L, -2, "value");
+        lua_call(L, 1, 2);
+        CHECK_EQ(lua_tonumber(L, -2), 2);
+        CHECK_EQ(std::string(lua_tostring(L, -1)), "3");
+
+        return after - before;
+    };
+
+    CHECK(loadSize(1) < loadSize(0));
+}
+
 TEST_CASE("Debugger")
 {
     static int breakhits = 0;
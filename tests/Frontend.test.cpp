@@ -1115,4 +1115,89 @@ TEST_CASE_FIXTURE(BuiltinsFixture, "reexport_type_alias")
     LUAU_REQUIRE_NO_ERRORS(result);
 }
 
+TEST_CASE("source_from_external_storage")
+{
+    struct ViewFileResolver : NullFileResolver
+    {
+        std::weak_ptr<const std::string> released;
+
+        std::optional<SourceCode> readSource(const ModuleName& name) override
+        {
+            // the source is only kept alive by the returned object, which lets the test check that it isn't retained after parsing
+            std::shared_ptr<const std::string> storage = std::make_shared<const std::string>("--!strict\nlocal a: number = 'not a number'\nreturn a");
+            released = storage;
+
+            return SourceCode{{}, SourceCode::Module, storage, *storage};
+        }
+    };
+
+    ViewFileResolver fileResolver;
+    NullConfigResolver configResolver;
+    Frontend frontend{&fileResolver, &configResolver};
+
+    CheckResult result = frontend.check("Module");
+
+    REQUIRE_EQ(1, result.errors.size());
+    CHECK_EQ(Location({1, 0}, {1, 32}), result.errors[0].location);
+    CHECK(fileResolver.released.expired());
+}
+
+TEST_CASE_FIXTURE(FrontendFixture, "parallel_check_matches_sequential_check")
+{
+    fileResolver.source["game/Gui/Modules/A"] = R"(
+        --!strict
+        local a: string = 1
+        return {value = 1}
+    )";
+    fileResolver.source["game/Gui/Modules/B"] = R"(
+        --!strict
+        local A = require(game:GetService('Gui').Modules.A)
+        local b: string = A.value
+        return {value = A.value}
+    )";
+    fileResolver.source["game/Gui/Modules/C"] = R"(
+        --!strict
+        local A = require(game:GetService('Gui').Modules.A)
+        local c: boolean = A.value
+        return {name = "c"}
+    )";
+    fileResolver.source["game/Gui/Modules/D"] = R"(
+        local E = require(game:GetService('Gui').Modules.E)
+        return {}
+    )";
+    fileResolver.source["game/Gui/Modules/E"] = R"(
+        local D = require(game:GetService('Gui').Modules.D)
+        return {}
+    )";
+    fileResolver.source["game/Gui/Modules/F"] = R"(
+        --!strict
+        local Modules = game:GetService('Gui').Modules
+        local B = require(Modules.B)
+        local C = require(Modules.C)
+        local D = require(Modules.D)
+        local f: string = B.value
+        local g: number = C.name
+    )";
+
+    FrontendOptions options;
+    options.typecheckThreads = 4;
+
+    CheckResult parallelResult = frontend.check("game/Gui/Modules/F", options);
+
+    frontend.markDirty("game/Gui/Modules/A");
+    frontend.markDirty("game/Gui/Modules/D");
+
+    CheckResult sequentialResult = frontend.check("game/Gui/Modules/F");
+
+    LUAU_REQUIRE_ERROR_COUNT(7, sequentialResult);
+    REQUIRE_EQ(sequentialResult.errors.size(), parallelResult.errors.size());
+
+    for (size_t i = 0; i < sequentialResult.errors.size(); ++i)
+    {
+        CHECK_EQ(sequentialResult.errors[i].moduleName, parallelResult.errors[i].moduleName);
+        CHECK_EQ(sequentialResult.errors[i].location, parallelResult.errors[i].location);
+        CHECK_EQ(toString(sequentialResult.errors[i]), toString(parallelResult.errors[i]));
+    }
+}
+
 TEST_SUITE_END();
@@ -1,5 +1,6 @@
 // This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
 #include "Luau/Parser.h"
+#include "Luau/AstJsonEncoder.h"
 
 #include "AstQueryDsl.h"
 #include "Fixture.h"
@@ -7,7 +8,10 @@
 
 #include "doctest.h"
 
+#include <algorithm>
+
 #include <limits.h>
+#include <string.h>
 
 using namespace Luau;
 
@@ -47,6 +51,133 @@ std::string getParseError(const std::string& code)
     throw std::runtime_error("Expected a parse error in '" + code + "'");
 }
 
+struct ReparseFixture
+{
+    Allocator allocator;
+    AstNameTable names{allocator};
+    ParseOptions options;
+
+    std::string source;
+    ParseResult result;
+
+    explicit ReparseFixture(const std::string& source)
+        : source(source)
+    {
+        options.captureComments = true;
+
+        result = Parser::parse(source.data(), source.size(), names, allocator, options);
+        REQUIRE(result.errors.empty());
+    }
+
+    static Position position(const std::string& text, size_t offset)
+    {
+        size_t lineStart = offset == 0 ? std::string::npos : text.rfind('\n', offset - 1);
+        unsigned line = unsigned(std::count(text.begin(), text.begin() + offset, '\n'));
+
+        return Position(line, unsigned(lineStart == std::string::npos ? offset : offset - lineStart - 1));
+    }
+
+    // replaces the first occurrence of 'from' after 'offset' with 'to' and returns true if the previous tree was reused
+    bool edit(const std::string& from, const std::string& to, size_t offset = 0)
+    {
+        size_t begin = source.find(from, offset);
+        REQUIRE(begin != std::string::npos);
+
+        return edit(begin, from.size(), to);
+    }
+
+    bool edit(size_t begin, size_t length, const std::string& to)
+    {
+        std::string updated = source.substr(0, begin) + to + source.substr(begin + length);
+        ParseEdit parseEdit{position(source, begin), position(source, begin + length), position(updated, begin + to.size())};
+
+        source = updated;
+
+        AstStatBlock* root = result.root;
+        result = Parser::reparse(source.data(), source.size(), result, parseEdit, names, allocator, options);
+
+        checkFullParse();
+
+        return result.root == root;
+    }
+
+    void checkFullParse()
+    {
+        Allocator fullAllocator;
+        AstNameTable fullNames(fullAllocator);
+        ParseResult full = Parser::parse(source.data(), source.size(), fullNames, fullAllocator, options);
+
+        INFO(source);
+        REQUIRE(full.errors.size() == result.errors.size());
+
+        if (!full.root)
+            return;
+
+        CHECK(toJson(full.root, full.commentLocations) == toJson(result.root, result.commentLocations));
+        CHECK(full.lines == result.lines);
+
+        REQUIRE(full.hotcomments.size() == result.hotcomments.size());
+
+        for (size_t i = 0; i < full.hotcomments.size(); ++i)
+        {
+            CHECK(full.hotcomments[i].header == result.hotcomments[i].header);
+            CHECK(full.hotcomments[i].location == result.hotcomments[i].location);
+            CHECK(full.hotcomments[i].content == result.hotcomments[i].content);
+        }
+    }
+};
+
+struct SkippedFunctionFixture
+{
+    Allocator allocator;
+    AstNameTable names{allocator};
+    ParseOptions options;
+
+    std::string source;
+    ParseResult result;
+
+    explicit SkippedFunctionFixture(const std::string& source)
+        : source(source)
+    {
+        options.captureComments = true;
+        options.skipFunctionBodies = true;
+
+        result = Parser::parse(source.data(), source.size(), names, allocator, options);
+    }
+
+    // parses all skipped bodies, including the nested ones that are skipped while parsing their parents
+    void parseSkippedFunctions()
+    {
+        for (size_t i = 0; i < result.skippedFunctions.size(); ++i)
+            Parser::parseSkippedFunction(source.data(), source.size(), result, result.skippedFunctions[i], names, allocator, options);
+    }
+
+    void checkFullParse()
+    {
+        ParseOptions fullOptions = options;
+        fullOptions.skipFunctionBodies = false;
+
+        Allocator fullAllocator;
+        AstNameTable fullNames(fullAllocator);
+        ParseResult full = Parser::parse(source.data(), source.size(), fullNames, fullAllocator, fullOptions);
+
+        INFO(source);
+        REQUIRE(full.errors.size() == result.errors.size());
+        REQUIRE(full.root);
+
+        CHECK(toJson(full.root, full.commentLocations) == toJson(result.root, result.commentLocations));
+        CHECK(full.lines == result.lines);
+
+        REQUIRE(full.hotcomments.size() == result.hotcomments.size());
+
+        for (size_t i = 0; i < full.hotcomments.size(); ++i)
+        {
+            CHECK(full.hotcomments[i].header == result.hotcomments[i].header);
+            CHECK(full.hotcomments[i].content == result.hotcomments[i].content);
+        }
+    }
+};
+
 } // namespace
 
 TEST_SUITE_BEGIN("AllocatorTests");
@@ -2817,3 +2948,399 @@ TEST_CASE_FIXTURE(Fixture, "missing_default_type_pack_argument_after_variadic_ty
 }
 
 TEST_SUITE_END();
+
+TEST_SUITE_BEGIN("IncrementalParserTests");
+
+TEST_CASE("reparse_statement_in_function_body")
+{
+    ReparseFixture fix(R"(
+--!strict
+local M = {}
+
+function M.foo(a: number, ...)
+    local b = a + 1 -- comment
+    return b, ...
+end
+
+--!nolint
+function M.bar(t: {x: number, [string]: any}): <T>(T) -> T
+    for i, v in t do
+        print(i, v)
+    end
+    return function<T>(x: T) return x end
+end
+
+return M
+)");
+
+    CHECK(fix.edit("a + 1", "a +\n        math.max(a, 2)\n"));
+    CHECK(fix.edit("b, ...", "b, select('#', ...)"));
+    CHECK(fix.edit("print(i, v)", "if i == 1 then continue end print(i, v.y)"));
+    CHECK(fix.edit("-- comment", "--[[ multiline\ncomment ]]"));
+}
+
+TEST_CASE("reparse_reuses_statements_after_the_edit")
+{
+    ReparseFixture fix(R"(
+local x = 1
+local y = x + 2
+print(x, y)
+)");
+
+    AstStatLocal* y = fix.result.root->body.data[1]->as<AstStatLocal>();
+    REQUIRE(y);
+
+    CHECK(fix.edit("1", "1 +\n    (3 * 4)"));
+
+    // the statements after the edited one are reused and refer to the reparsed local
+    CHECK(fix.result.root->body.data[1] == y);
+
+    AstStatLocal* x = fix.result.root->body.data[0]->as<AstStatLocal>();
+    REQUIRE(x);
+
+    AstExprBinary* value = y->values.data[0]->as<AstExprBinary>();
+    REQUIRE(value);
+    REQUIRE(value->left->is<AstExprLocal>());
+    CHECK(value->left->as<AstExprLocal>()->local == x->vars.data[0]);
+
+    // renaming a local changes the bindings of the statements after it, so they are reparsed
+    CHECK(fix.edit("local x", "local z"));
+    CHECK(fix.result.root->body.data[1] != y);
+}
+
+TEST_CASE("reparse_nested_blocks")
+{
+    ReparseFixture fix(R"(
+local function outer(...)
+    local t = {...}
+    while #t > 0 do
+        repeat
+            local v = table.remove(t)
+        until v == nil or v > 1
+        if #t == 1 then
+            do
+                print(t[1])
+            end
+        elseif #t == 2 then
+            break
+        else
+            print(outer)
+        end
+    end
+end
+)");
+
+    CHECK(fix.edit("print(t[1])", "print(t[1], ...)"));
+    CHECK(fix.edit("break", "local n = #t break"));
+    CHECK(fix.edit("print(outer)", "print(outer(t))"));
+    CHECK(fix.edit("local v = table.remove(t)", "local v = table.remove(t, 1)"));
+    CHECK(fix.edit("                print(t[1], ...)", "                local x = 1\n                print(t[1], ...)"));
+}
+
+TEST_CASE("reparse_falls_back_to_full_parse")
+{
+    ReparseFixture fix(R"(
+local function f()
+    return 1
+end
+print(f())
+)");
+
+    // the edit removes the end of the function body
+    CHECK(!fix.edit("end", "en"));
+    CHECK(!fix.result.errors.empty());
+
+    // the previous result has errors
+    CHECK(!fix.edit("en\n", "end\n"));
+    CHECK(fix.result.errors.empty());
+
+    // the edit ends the function body early, so the statements after it belong to the enclosing block
+    CHECK(!fix.edit("return 1", "return 1 end do"));
+    CHECK(fix.edit("return 1 end do", "return 1"));
+
+    // hot comments added before the first statement are module header directives
+    CHECK(fix.edit(0, 0, "--!strict"));
+    REQUIRE(fix.result.hotcomments.size() == 1);
+    CHECK(fix.result.hotcomments[0].header);
+}
+
+TEST_CASE("reparse_while_typing")
+{
+    ReparseFixture fix(R"(
+local function f(a, b)
+    local c = a
+    return c
+end
+
+local function g(x: number): number
+    return x * 2
+end
+
+return f(g(1), 2)
+)");
+
+    const std::string text = "\n    local d = if b then g(c) else `{c} and {b}` -- note\n    c = d";
+    size_t offset = fix.source.find("local c = a") + strlen("local c = a");
+
+    for (size_t i = 0; i < text.size(); ++i)
+        fix.edit(offset + i, 0, text.substr(i, 1));
+
+    CHECK(fix.result.errors.empty());
+
+    for (size_t i = text.size(); i > 0; --i)
+        fix.edit(offset + i - 1, 1, "");
+
+    CHECK(fix.result.errors.empty());
+}
+
+TEST_SUITE_END();
+
+TEST_SUITE_BEGIN("SkippedFunctionBodyTests");
+
+TEST_CASE("skip_function_bodies")
+{
+    SkippedFunctionFixture fix(R"(
+--!strict
+local M = {}
+
+function M.foo(a: number, ...)
+    --!nolint LocalUnused
+    local b = a + 1 -- comment
+    return function(...) return b, ... end
+end
+
+local function bar<T>(t: {x: T}): T
+    repeat
+        local x = t.x
+    until x
+    return t.x
+end
+
+M.baz = { function(x) return if x then function() end else x end }
+
+return M
+)");
+
+    REQUIRE(fix.result.errors.empty());
+    REQUIRE(fix.result.skippedFunctions.size() == 3);
+
+    for (const SkippedFunction& skipped : fix.result.skippedFunctions)
+        CHECK(skipped.function->body->body.size == 0);
+
+    // comments in skipped bodies are captured by the first parse
+    CHECK(fix.result.commentLocations.size() == 3);
+    REQUIRE(fix.result.hotcomments.size() == 2);
+    CHECK(fix.result.hotcomments[1].content == "nolint LocalUnused");
+
+    fix.parseSkippedFunctions();
+
+    CHECK(fix.result.errors.empty());
+    CHECK(fix.result.skippedFunctions.size() == 5);
+
+    fix.checkFullParse();
+}
+
+TEST_CASE("skip_function_bodies_with_expressions_that_look_like_blocks")
+{
+    SkippedFunctionFixture fix(R"(
+type Array<T> = {T}
+
+local function f(a, b)
+    local c = if a then if b then 1 else 2 elseif b then 3 else 4
+    if if a then b else not b then
+        c = (if a then function() if b then return end end else nil)
+    else if b then c += if a then 1 else 2 end end
+    while if a then b else c do
+        local d: Array<number> = {}
+        if d then break end
+    end
+    local s = `{if a then b else c} and {(function() do end end)()}`
+    return s, { if a then b else c, [if b then 1 else 2] = if c then a else b }
+end
+
+return f
+)");
+
+    REQUIRE(fix.result.errors.empty());
+    REQUIRE(fix.result.skippedFunctions.size() == 1);
+
+    fix.parseSkippedFunctions();
+    fix.checkFullParse();
+}
+
+TEST_CASE("skipped_function_bodies_use_enclosing_locals")
+{
+    SkippedFunctionFixture fix(R"(
+local x = 1
+
+local function f(y)
+    local z = x + y
+    return function() return z end
+end
+)");
+
+    REQUIRE(fix.result.errors.empty());
+    REQUIRE(fix.result.skippedFunctions.size() == 1);
+
+    fix.parseSkippedFunctions();
+    REQUIRE(fix.result.skippedFunctions.size() == 2);
+
+    AstStatLocal* x = fix.result.root->body.data[0]->as<AstStatLocal>();
+    AstStatLocalFunction* f = fix.result.root->body.data[1]->as<AstStatLocalFunction>();
+    REQUIRE(x);
+    REQUIRE(f);
+
+    AstStatLocal* z = f->func->body->body.data[0]->as<AstStatLocal>();
+    REQUIRE(z);
+
+    AstExprBinary* value = z->values.data[0]->as<AstExprBinary>();
+    REQUIRE(value);
+    REQUIRE(value->left->is<AstExprLocal>());
+    REQUIRE(value->right->is<AstExprLocal>());
+
+    CHECK(value->left->as<AstExprLocal>()->local == x->vars.data[0]);
+    CHECK(value->left->as<AstExprLocal>()->upvalue);
+    CHECK(value->right->as<AstExprLocal>()->local == f->func->args.data[0]);
+    CHECK(!value->right->as<AstExprLocal>()->upvalue);
+
+    AstStatReturn* ret = f->func->body->body.data[1]->as<AstStatReturn>();
+    REQUIRE(ret);
+    REQUIRE(ret->list.data[0]->is<AstExprFunction>());
+
+    AstStatReturn* inner = ret->list.data[0]->as<AstExprFunction>()->body->body.data[0]->as<AstStatReturn>();
+    REQUIRE(inner);
+    REQUIRE(inner->list.data[0]->is<AstExprLocal>());
+    CHECK(inner->list.data[0]->as<AstExprLocal>()->local == z->vars.data[0]);
+    CHECK(inner->list.data[0]->as<AstExprLocal>()->local->functionDepth == 1);
+}
+
+TEST_CASE("skipped_function_body_errors")
+{
+    // errors in balanced bodies are reported when the body is parsed
+    SkippedFunctionFixture balanced(R"(
+local function f()
+    local x = = 1
+end
+)");
+
+    CHECK(balanced.result.errors.empty());
+    CHECK(balanced.result.skippedFunctions.size() == 1);
+
+    balanced.parseSkippedFunctions();
+    balanced.checkFullParse();
+
+    // when the bodies can't be matched, the source is parsed without skipping them
+    SkippedFunctionFixture unbalanced(R"(
+local function f()
+    if x then
+end
+
+local function g()
+end
+)");
+
+    CHECK(!unbalanced.result.errors.empty());
+    CHECK(unbalanced.result.skippedFunctions.empty());
+
+    unbalanced.checkFullParse();
+
+    // a '>' followed by an 'if' expression is scanned as a block, which is detected by the parse that follows
+    SkippedFunctionFixture ambiguous(R"(
+local function f(a)
+    return a > if a then 1 else 2
+end
+
+do
+    local function g() end
+end
+)");
+
+    CHECK(ambiguous.result.errors.empty());
+    CHECK(ambiguous.result.skippedFunctions.empty());
+
+    ambiguous.checkFullParse();
+}
+
+TEST_SUITE_END();
+
+TEST_SUITE_BEGIN("ParseBatchTests");
+
+TEST_CASE("shared_name_tables")
+{
+    Allocator sharedAllocator;
+    AstNameTable shared(sharedAllocator);
+    std::mutex sharedMutex;
+
+    Allocator allocator1, allocator2;
+    AstNameTable names1(allocator1, shared, sharedMutex);
+    AstNameTable names2(allocator2, shared, sharedMutex);
+
+    AstName foo = names1.getOrAdd("foo");
+
+    CHECK(foo == names2.getOrAdd("foo"));
+    CHECK(foo == shared.get("foo"));
+    CHECK(names2.get("foo") == foo);
+    CHECK(names2.get("bar") == AstName());
+
+    // reserved words are added to every table
+    CHECK(names1.getOrAddWithType("while", 5).second == Lexeme::ReservedWhile);
+    CHECK(names2.getOrAddWithType("while", 5).second == Lexeme::ReservedWhile);
+}
+
+TEST_CASE("parse_batch")
+{
+    std::vector<std::string> sources = {
+        "local x = print(1)\nreturn x",
+        "print('hello')",
+        "local function f(",
+        "return { print = print }",
+    };
+
+    std::vector<std::string_view> views(sources.begin(), sources.end());
+
+    for (unsigned int threads : {1, 3})
+    {
+        Allocator allocator;
+        AstNameTable names(allocator);
+
+        std::vector<BatchParseResult> results = Parser::parseBatch(views, threads, &names);
+        REQUIRE(results.size() == sources.size());
+
+        CHECK(results[0].result.root->body.size == 2);
+        CHECK(results[1].result.root->body.size == 1);
+        CHECK(!results[2].result.errors.empty());
+        CHECK(results[3].result.errors.empty());
+
+        // names from all sources are in the shared table
+        AstName print = names.get("print");
+        REQUIRE(print.value);
+
+        for (size_t i : {0, 1})
+        {
+            CHECK(results[i].result.errors.empty());
+            CHECK(!results[i].names);
+
+            AstExprGlobal* global = nullptr;
+
+            if (AstStatLocal* stat = results[i].result.root->body.data[0]->as<AstStatLocal>())
+                global = stat->values.data[0]->as<AstExprCall>()->func->as<AstExprGlobal>();
+            else if (AstStatExpr* stat = results[i].result.root->body.data[0]->as<AstStatExpr>())
+                global = stat->expr->as<AstExprCall>()->func->as<AstExprGlobal>();
+
+            REQUIRE(global);
+            CHECK(global->name == print);
+        }
+    }
+
+    // without a shared table, every source gets its own name table
+    std::vector<BatchParseResult> results = Parser::parseBatch(views, 2);
+    REQUIRE(results.size() == sources.size());
+
+    for (const BatchParseResult& result : results)
+        REQUIRE(result.names);
+
+    CHECK(results[0].names->get("print").value);
+    CHECK(results[0].names->get("print") != results[1].names->get("print"));
+}
+
+TEST_SUITE_END();
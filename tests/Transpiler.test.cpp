@@ -693,4 +693,24 @@ TEST_CASE_FIXTURE(Fixture, "transpile_string_literal_escape")
     CHECK_EQ(code, transpile(code, {}, true).code);
 }
 
+TEST_CASE_FIXTURE(Fixture, "transpile_to_output")
+{
+    std::string code = "local t: {string} = {}\n";
+    for (int i = 0; i < 5000; ++i)
+        code += "t[" + std::to_string(i) + "] = 'line\\n' .. 'value' .. 0.5\n";
+
+    AstStatBlock* root = parse(code);
+
+    std::string output;
+    size_t chunks = 0;
+
+    transpileWithTypes(*root, [&](std::string_view chunk) {
+        output.append(chunk.data(), chunk.size());
+        chunks++;
+    });
+
+    CHECK_EQ(code, output);
+    CHECK(chunks > 1);
+}
+
 TEST_SUITE_END();
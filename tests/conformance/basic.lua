@@ -953,6 +953,25 @@ assert((function()
     return concat(type(ud),typeof(ud))
 end)() == "userdata,userdata")
 
+-- returned locals are read before the values that follow them are evaluated
+assert((function()
+    local b = 1
+    return b, (function() b = 2 end)()
+end)() == 1)
+
+assert(concat((function()
+    local f
+    local a = 1
+    f = function() a = 2 return 3 end
+    return a, f()
+end)()) == "1,3")
+
+-- 0 and -0 are equal but distinct constants, so functions that use them can't share constants
+local function addzero(x) return x + 0 end
+local function addnegzero(x) return x + -0 end
+assert(1 / addzero(-0) == math.huge)
+assert(1 / addnegzero(-0) == -math.huge)
+
 testgetfenv() -- DONT MOVE THIS LINE
 
 return 'OK'
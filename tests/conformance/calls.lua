@@ -226,6 +226,52 @@ assert((function () return nil end)(4) == nil)
 assert((function () local a; return a end)(4) == nil)
 assert((function (a) return a end)() == nil)
 
+-- self-recursive tail calls (compiled as loops at -O2)
+do
+  local function fact(n, acc)
+    if n <= 1 then return acc end
+    return fact(n - 1, acc * n)
+  end
+  assert(fact(10, 1) == 3628800)
+
+  -- arguments are evaluated before any of them is reassigned
+  local function swap(a, b, n)
+    if n == 0 then return a, b end
+    return swap(b, a, n - 1)
+  end
+  assert(select('#', swap(1, 2, 3)) == 2)
+  local a, b = swap(1, 2, 3)
+  assert(a == 2 and b == 1)
+
+  -- missing arguments are nil and extra arguments are evaluated
+  local log = {}
+  local function reset(x, y)
+    if x then return reset(nil, nil, table.insert(log, x)) end
+    if y then return reset() end
+    return x, y
+  end
+  assert(reset(1, 2) == nil and #log == 1)
+
+  -- each iteration has its own locals
+  local function collect(n, fns)
+    if n == 0 then return fns end
+    local v = n
+    fns[n] = function() v += 1; return v end
+    return collect(n - 1, fns)
+  end
+  local fns = collect(3, {})
+  assert(fns[1]() == 2 and fns[2]() == 3 and fns[3]() == 4 and fns[1]() == 3)
+
+  -- arguments captured by reference keep the value of their own iteration
+  local function collectargs(n, fns)
+    if n == 0 then return fns end
+    fns[n] = function() n += 0; return n end
+    return collectargs(n - 1, fns)
+  end
+  local fns = collectargs(3, {})
+  assert(fns[1]() == 1 and fns[2]() == 2 and fns[3]() == 3)
+end
+
 -- C-stack overflow while handling C-stack overflow
 if not limitedstack then
   local function loop ()
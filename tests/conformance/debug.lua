@@ -111,4 +111,24 @@ end
 
 testlinedefined()
 
+-- capture produces the same text as traceback, lazily
+function capt(...)
+	return debug.capture(...), debug.traceback()
+end
+
+local snap, tb = capt()
+assert(typeof(snap) == "table")
+assert(tostring(snap) == tb)
+assert(tostring(snap):find("capt") > 0)
+assert(tostring(debug.capture(co)) == debug.traceback(co))
+assert(tostring(debug.capture(co2)) == "debug.lua:31 function halp\n")
+assert(tostring(debug.capture(co, 2)) == "")
+assert(table.isfrozen(snap))
+assert(getmetatable(snap) ~= nil)
+assert(not pcall(setmetatable, snap, nil))
+assert(not pcall(debug.capture, -1))
+
+local ok, err = xpcall(function() error("boom") end, function(e) return debug.capture() end)
+assert(not ok and tostring(err):find("debug.lua") > 0)
+
 return 'OK'
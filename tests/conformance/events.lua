@@ -124,6 +124,8 @@ assert(5-a == 5)
 assert(cap[0] == "sub" and cap[1] == 5 and cap[2] == a and cap[3]==nil)
 assert('5'-a == '5')
 assert(cap[0] == "sub" and cap[1] == '5' and cap[2] == a and cap[3]==nil)
+assert(5/a == 5)
+assert(cap[0] == "div" and cap[1] == 5 and cap[2] == a and cap[3]==nil)
 assert(a*a == a)
 assert(cap[0] == "mul" and cap[1] == a and cap[2] == a and cap[3]==nil)
 assert(a/0 == a)
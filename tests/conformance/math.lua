@@ -334,6 +334,21 @@ assert(math.sign("-2") == -1)
 assert(math.sign("0") == 0)
 assert(math.round("1.8") == 2)
 
+-- test that arithmetic with a constant on the left hand side works for non-number operands
+do
+  local function rsub(x) return 1 - x end
+  local function rdiv(x) return 1 / x end
+
+  assert(rsub(4) == -3)
+  assert(rsub("4") == -3)
+  assert(rdiv(4) == 0.25)
+  assert(rdiv("4") == 0.25)
+  assert(rdiv(0) == math.huge)
+  assert(rdiv(-0) == -math.huge)
+  assert(pcall(rsub, {}) == false)
+  assert(pcall(rdiv, nil) == false)
+end
+
 -- test that fastcalls return correct number of results
 assert(select('#', math.floor(1.4)) == 1)
 assert(select('#', math.ceil(1.6)) == 1)
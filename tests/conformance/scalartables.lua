@@ -0,0 +1,120 @@
+-- This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+print('testing tables that are replaced with registers')
+
+-- basic field access
+local function area(w, h)
+  local r = {w = w, h = h}
+  return r.w * r.h
+end
+
+assert(area(3, 4) == 12)
+
+-- fields assigned after construction and fields that are never assigned
+local function build(a)
+  local t = {}
+  t.x = a
+  t.y = t.x + 1
+  return t.x, t.y, t.z
+end
+
+assert(select('#', build(1)) == 3)
+assert(build(1) == 1)
+assert(select(2, build(1)) == 2)
+assert(select(3, build(1)) == nil)
+
+-- multiple assignment follows the usual evaluation order
+local function swap(a, b)
+  local p = {x = a, y = b}
+  p.x, p.y = p.y, p.x
+  return p.x, p.y
+end
+
+local sx, sy = swap(1, 2)
+assert(sx == 2 and sy == 1)
+
+-- compound assignment and nested field access
+local function accumulate(n)
+  local acc = {sum = 0, count = 0, inner = {value = 0}}
+  for i = 1, n do
+    acc.sum += i
+    acc.count += 1
+    acc.inner.value = acc.inner.value + i
+  end
+  return acc.sum, acc.count, acc.inner.value
+end
+
+local asum, acount, ainner = accumulate(10)
+assert(asum == 55 and acount == 10 and ainner == 55)
+
+-- constructor values are evaluated in order
+local function order()
+  local log = {}
+  local function f(v) table.insert(log, v) return v end
+  local t = {a = f(1), b = f(2), c = f(3)}
+  return table.concat(log, ","), t.a + t.b + t.c
+end
+
+local olog, osum = order()
+assert(olog == "1,2,3" and osum == 6)
+
+-- each loop iteration gets a fresh table
+local function fresh()
+  local sum = 0
+  for i = 1, 3 do
+    local v = {}
+    assert(v.value == nil)
+    v.value = i
+    sum += v.value
+  end
+  return sum
+end
+
+assert(fresh() == 6)
+
+-- functions stored in fields
+local function methods()
+  local m = {}
+  function m.double(x) return x * 2 end
+  return m.double(21)
+end
+
+assert(methods() == 42)
+
+-- tables that escape must keep behaving like tables
+local function escapes()
+  local a = {x = 1}
+  local b = {x = 2}
+  local c = {x = 3}
+  local d = {x = 4}
+  setmetatable(a, {__index = function() return 10 end})
+  local function get() return b.x end
+  c.x = 5
+  local list = {c}
+  return a.y, get(), list[1].x, d["x"]
+end
+
+local e1, e2, e3, e4 = escapes()
+assert(e1 == 10 and e2 == 2 and e3 == 5 and e4 == 4)
+
+-- method calls pass the table itself
+local function selfcall()
+  local obj = {value = 7, get = function(self) return self.value end}
+  return obj:get()
+end
+
+assert(selfcall() == 7)
+
+-- repeat..until conditions can refer to replaced tables
+local function untilcond()
+  local i = 0
+  repeat
+    local s = {done = i >= 3}
+    i += 1
+    if not s.done then continue end
+  until s.done
+  return i
+end
+
+assert(untilcond() == 4)
+
+return 'OK'
@@ -219,6 +219,42 @@ do
   assert(eq(string.split("abc", "c"), {'ab', ''}))
 end
 
+-- base64 and hex
+do
+  -- RFC 4648 test vectors
+  local vectors = { [""] = "", f = "Zg==", fo = "Zm8=", foo = "Zm9v", foob = "Zm9vYg==", fooba = "Zm9vYmE=", foobar = "Zm9vYmFy" }
+  for k, v in pairs(vectors) do
+    assert(string.base64encode(k) == v)
+    assert(string.base64decode(v) == k)
+  end
+
+  assert(string.base64encode("\0\255\254") == "AP/+")
+  assert(("hello"):base64encode() == "aGVsbG8=")
+
+  assert(string.base64decode("Zg=") == nil)
+  assert(string.base64decode("Zg") == nil)
+  assert(string.base64decode("Z===") == nil)
+  assert(string.base64decode("====") == nil)
+  assert(string.base64decode("Zm=v") == nil)
+  assert(string.base64decode("Zg==Zg==") == nil)
+  assert(string.base64decode("Zm9v!m9v") == nil)
+
+  assert(string.hexencode("") == "")
+  assert(string.hexencode("\0\1\127\128\255") == "00017f80ff")
+  assert(string.hexdecode("00017F80ff") == "\0\1\127\128\255")
+  assert(string.hexdecode("abc") == nil)
+  assert(string.hexdecode("0g") == nil)
+
+  -- long strings go through the heap buffer
+  local all = {}
+  for i = 0, 255 do all[#all + 1] = string.char(i) end
+  local s = string.rep(table.concat(all), 33) .. "xy"
+  assert(string.base64decode(string.base64encode(s)) == s)
+  assert(string.hexdecode(string.hexencode(s)) == s)
+  assert(#string.base64encode(s) == math.ceil(#s / 3) * 4)
+  assert(string.hexencode(s):upper():lower() == string.hexencode(s))
+end
+
 --[[
 local locales = { "ptb", "ISO-8859-1", "pt_BR" }
 local function trylocale (w)
@@ -326,4 +326,63 @@ do    -- testing out of range values
   checkerror("missing size", unpack, "c-2", "")
 end
 
+do    -- testing unpackmany and format caching
+  local unpackmany = string.unpackmany
+  local fmt = "<i2 B d"
+  local parts = {}
+  for i = 1, 10 do
+    parts[#parts + 1] = pack(fmt, -i, i, i / 4)
+  end
+  local data = table.concat(parts)
+
+  local t, p = unpackmany(fmt, data, 10)
+  assert(#t == 30 and p == #data + 1)
+  for i = 1, 10 do
+    assert(t[i * 3 - 2] == -i and t[i * 3 - 1] == i and t[i * 3] == i / 4)
+  end
+
+  -- records start at given position, and match unpack results
+  local t, p = unpackmany(fmt, data, 3, packsize(fmt) + 1)
+  assert(#t == 9 and p == packsize(fmt) * 4 + 1)
+  assert(t[1] == unpack(fmt, data, packsize(fmt) + 1))
+
+  local t, p = unpackmany(fmt, data, 0)
+  assert(#t == 0 and p == 1)
+
+  -- variable-length records
+  local s = pack("s1z", "a", "bc") .. pack("s1z", "def", "")
+  local t, p = unpackmany("s1z", s, 2)
+  assert(t[1] == "a" and t[2] == "bc" and t[3] == "def" and t[4] == "" and p == #s + 1)
+
+  checkerror("data string too short", unpackmany, fmt, data, 11)
+  checkerror("data string too short", unpackmany, fmt, data, 2^28)
+  checkerror("negative", unpackmany, fmt, data, -1)
+  checkerror("invalid format option", unpackmany, "r", data, 1)
+
+  -- native and non-native layouts of all sizes agree with each other
+  for _, size in {1, 2, 4, 8} do
+    local v = size == 8 and -0x12345678 or -(2 ^ (size * 8 - 2))
+    local u = 2 ^ (size * 8 - 1) + 3
+    if size == 8 then u = 2 ^ 52 + 3 end
+    for _, e in {"<", ">", "="} do
+      local f = e .. "i" .. size
+      assert(unpack(f, pack(f, v)) == v)
+      local f = e .. "I" .. size
+      assert(unpack(f, pack(f, u)) == u)
+    end
+    assert(pack("<i" .. size, v):reverse() == pack(">i" .. size, v))
+  end
+  for _, e in {"<", ">", "="} do
+    assert(unpack(e .. "f", pack(e .. "f", 0.5)) == 0.5)
+    assert(unpack(e .. "d", pack(e .. "d", -1.25)) == -1.25)
+  end
+  assert(pack("<d", 1.5):reverse() == pack(">d", 1.5))
+
+  -- the format cache is bounded and entries are independent of each other
+  for i = 1, 200 do
+    local f = "<i" .. (i % 8 + 1) .. string.rep(" ", i)
+    assert(unpack(f, pack(f, i % 100)) == i % 100)
+  end
+end
+
 return "OK"
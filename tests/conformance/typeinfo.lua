@@ -0,0 +1,99 @@
+-- This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+print('testing functions with argument type information')
+
+type Num = number
+
+local function add(a: number, b: Num)
+	return a + b
+end
+
+local function sum(t: {number}, n: number)
+	local s = 0
+	for i = 1, n do
+		s += t[i]
+	end
+	return s
+end
+
+local function len(t: {number})
+	return #t
+end
+
+-- arguments that match the annotations
+assert(add(1, 2) == 3)
+assert(sum({1, 2, 3}, 3) == 6)
+assert(len({1, 2, 3}) == 3)
+
+-- annotations are not checked at runtime, so arguments that don't match them must still work
+local mt = { __add = function(a, b) return "added" end, __len = function() return 42 end, __index = function(t, k) return 10 end }
+
+assert(add(setmetatable({}, mt), 2) == "added")
+assert(add("1", "2") == 3)
+assert(len(setmetatable({}, mt)) == 42)
+assert(sum(setmetatable({}, mt), 2) == 20)
+
+assert(pcall(add, nil, 1) == false)
+assert(pcall(sum, {}, "x") == false)
+
+-- after a mismatch, functions must keep working with matching arguments
+assert(add(3, 4) == 7)
+assert(sum({4, 5}, 2) == 9)
+assert(len({}) == 0)
+
+-- mismatch in a recursive call while outer calls with matching arguments are still running
+local function fib(n: number)
+	if type(n) == "string" then
+		return fib(tonumber(n))
+	end
+
+	if n < 2 then
+		return n
+	end
+
+	if n == 10 then
+		return fib(tostring(n - 1)) + fib(n - 2)
+	end
+
+	return fib(n - 1) + fib(n - 2)
+end
+
+assert(fib(12) == 144)
+assert(fib(8) == 21)
+
+-- arguments that are modified in the function body
+local function clamp(x: number, lo: number, hi: number)
+	if x < lo then
+		x = lo
+	elseif x > hi then
+		x = "hi"
+	end
+	return x
+end
+
+assert(clamp(5, 1, 10) == 5)
+assert(clamp(-5, 1, 10) == 1)
+assert(clamp(50, 1, 10) == "hi")
+
+-- arguments captured by reference
+local function counter(n: number)
+	local function inc()
+		n = tostring(n + 1)
+	end
+	inc()
+	return n
+end
+
+assert(counter(1) == "2")
+
+-- methods and varargs
+local obj = { value = 5 }
+
+function obj:scale(k: number, ...)
+	return self.value * k, select('#', ...)
+end
+
+assert(select(1, obj:scale(2)) == 10)
+assert(select(2, obj:scale(2, 1, 2, 3)) == 3)
+assert(select(1, obj:scale("3")) == 15)
+
+return 'OK'
@@ -205,4 +205,52 @@ for p, c in string.gmatch(x, "()(" .. utf8.charpattern .. ")") do
   end
 end
 
+-- long strings exercise word-at-a-time paths
+do
+  local parts = {}
+  for k = 1, 50 do
+    parts[#parts + 1] = string.rep("ascii text ", k % 4)
+    parts[#parts + 1] = x
+    parts[#parts + 1] = "\u{10FFFF}"
+  end
+  local long = table.concat(parts)
+
+  local starts = {}
+  for p in string.gmatch(long, "()" .. utf8.charpattern) do
+    starts[#starts + 1] = p
+  end
+
+  assert(utf8.len(long) == #starts)
+  assert(utf8.len(long, 3, -3) == #string.gsub(string.sub(long, 3, -3), "[\x80-\xBF]", ""))
+  assert(utf8.len(string.rep("a", 100) .. "\xFF") == nil)
+  assert(select(2, utf8.len(string.rep("a", 100) .. "\xFF")) == 101)
+
+  -- forward, backward and random access
+  for k = 1, #starts do
+    assert(utf8.offset(long, k) == starts[k])
+  end
+  for k = #starts, 1, -1 do
+    assert(utf8.offset(long, k) == starts[k])
+  end
+  for k = 1, #starts, 7 do
+    assert(utf8.offset(long, k) == starts[k])
+    assert(utf8.offset(long, #starts - k + 1) == starts[#starts - k + 1])
+    assert(utf8.offset(long, k, starts[2]) == starts[k + 1])
+  end
+  assert(utf8.offset(long, #starts + 1) == #long + 1)
+  assert(utf8.offset(long, #starts + 2) == nil)
+
+  -- results for one string don't affect another
+  local other = string.rep("é", 100)
+  assert(utf8.offset(long, 60) == starts[60])
+  assert(utf8.offset(other, 60) == 119)
+
+  local n = 0
+  for p, c in utf8.codes(long) do
+    n = n + 1
+    assert(p == starts[n])
+  end
+  assert(n == #starts)
+end
+
 return 'OK'
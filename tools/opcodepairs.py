@@ -0,0 +1,120 @@
+#!/usr/bin/python3
+# This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+
+# Given a set of Luau source files, this tool displays the most frequent pairs of adjacent bytecode instructions
+# Pairs where the second instruction is a jump target are excluded since they can't be fused into a single instruction
+# When a coverage file produced by 'luau --coverage' is provided, each pair is weighted by the number of times its line executed
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+argumentParser = argparse.ArgumentParser(description='Display statistics for pairs of adjacent bytecode instructions')
+argumentParser.add_argument('paths', nargs='+', help='Source files or directories to compile')
+argumentParser.add_argument('--luau', dest='luau', default='luau', help='Path to luau executable')
+argumentParser.add_argument('-O', dest='optimize', type=int, default=1, help='Optimization level to compile with')
+argumentParser.add_argument('--coverage', dest='coverage', type=open, help='Coverage file used to weigh instruction pairs by line hit counts')
+argumentParser.add_argument('--limit', dest='limit', type=int, default=30, help='Display top N pairs')
+argumentParser.add_argument('--single', dest='single', action='store_true', help='Display individual instruction statistics as well')
+
+arguments = argumentParser.parse_args()
+
+instructionRe = re.compile(r'^(L\d+: )?([A-Z][A-Z0-9_]*)\b')
+sourceLineRe = re.compile(r'^\s+(\d+): ')
+
+def collectFiles(paths):
+    for path in paths:
+        if os.path.isdir(path):
+            for root, dirs, files in os.walk(path):
+                for name in sorted(files):
+                    if name.endswith(".lua") or name.endswith(".luau"):
+                        yield os.path.join(root, name)
+        else:
+            yield path
+
+def parseCoverage(lines):
+    hits = {}
+    current = None
+
+    for l in lines:
+        l = l.strip()
+
+        if l.startswith("SF:"):
+            current = hits.setdefault(os.path.normpath(l[3:]), {})
+        elif l.startswith("DA:") and current is not None:
+            line, count = l[3:].split(",")
+            current[int(line)] = current.get(int(line), 0) + int(count)
+
+    return hits
+
+def findCoverage(hits, path):
+    path = os.path.normpath(path)
+
+    for source, lines in hits.items():
+        if source == path or source.endswith(os.sep + path) or path.endswith(os.sep + source):
+            return lines
+
+    return None
+
+coverage = parseCoverage(arguments.coverage.readlines()) if arguments.coverage else None
+
+pairs = {}
+singles = {}
+total = 0
+
+for path in collectFiles(arguments.paths):
+    try:
+        output = subprocess.check_output([arguments.luau, "--compile=text", "-O" + str(arguments.optimize), path], stderr=subprocess.STDOUT).decode("utf-8", errors="replace")
+    except subprocess.CalledProcessError as e:
+        print("Skipping {}: {}".format(path, e.output.decode("utf-8", errors="replace").strip()), file=sys.stderr)
+        continue
+
+    lines = coverage and findCoverage(coverage, path)
+
+    if coverage and lines is None:
+        print("Skipping {}: no coverage information".format(path), file=sys.stderr)
+        continue
+
+    previous = None
+    line = 0
+
+    for l in output.splitlines():
+        if l.startswith("Function "):
+            previous = None
+            continue
+
+        m = sourceLineRe.match(l)
+        if m:
+            line = int(m.group(1))
+            continue
+
+        m = instructionRe.match(l)
+        if not m or m.group(2) == "REMARK":
+            continue
+
+        op = m.group(2)
+        weight = lines.get(line, 0) if lines is not None else 1
+
+        singles[op] = singles.get(op, 0) + weight
+        total += weight
+
+        # jump targets start a new sequence since control can enter the second instruction without executing the first one
+        if previous and not m.group(1):
+            key = previous + " + " + op
+            pairs[key] = pairs.get(key, 0) + weight
+
+        previous = op
+
+def display(title, stats):
+    print("{:>12} {:>7}  {}".format("Count", "%", title))
+
+    for key, count in sorted(stats.items(), key=lambda e: e[1], reverse=True)[:arguments.limit]:
+        print("{:>12} {:>6.2f}%  {}".format(count, count * 100.0 / total if total else 0, key))
+
+if arguments.single:
+    display("Instruction", singles)
+    print()
+
+display("Instruction pair", pairs)